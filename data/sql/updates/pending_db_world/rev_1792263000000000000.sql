@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name` = 'server snapshot rebuild';
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('server snapshot rebuild', 4, 'Syntax: .server snapshot rebuild\r\n\r\nRead every world database query served from a snapshot during startup again and rewrite its snapshot file in the background. Use after editing world tables by hand, the next startup then loads the new contents.');
@@ -53,7 +53,7 @@ public:
         //sTransmogrification->Load();
 
         // ChatHandler could be Console or Player session
-        handler->PSendSysMessage("Cache Reloaded");
+        handler->PSendSysMessage("Cache reload scheduled for the next world update");
         return true;
     }
 
@@ -3,15 +3,23 @@
 
 #include <string>
 #include "AreaTriggerDataStore.h"
+#include "AsyncCallbackProcessor.h"
 #include "ScriptMgr.h"
 #include "Player.h"
 #include "Config.h"
 #include "Chat.h"
 #include "WorldPacket.h"
 #include "DatabaseEnv.h"
+#include "GameTime.h"
+#include "QueryHolder.h"
+#include "QuerySnapshot.h"
 #include "SharedDefines.h"
 #include "Gamemode.h"
+#include "ForgeFlatMap.h"
+#include <array>
+#include <atomic>
 #include <unordered_map>
+#include <unordered_set>
 #include <list>
 #include <tuple>
 
@@ -99,10 +107,10 @@ struct ForgeCharacterSpec
     SpecVisibility Visability;
     uint32 CharacterSpecTabId; // like holy ret pro
     // TabId, Spellid
-    std::unordered_map<uint32, std::unordered_map<uint32, ForgeCharacterTalent*>> Talents;
+    ForgeFlatMap<uint32, ForgeFlatMap<uint32, ForgeCharacterTalent>> Talents;
     // tabId
-    std::unordered_map<uint32, uint8> PointsSpent;
-    std::unordered_map<uint32 /*node id*/, uint32/*spell picked*/> ChoiceNodesChosen;
+    ForgeFlatMap<uint32, uint8> PointsSpent;
+    ForgeFlatMap<uint32 /*node id*/, uint32/*spell picked*/> ChoiceNodesChosen;
 };
 
 struct ForgeTalentChoice
@@ -162,6 +170,87 @@ struct ForgeCharacterXmog
 #define MAINSTATS 3
 #define TANKDIST 0
 
+enum ForgeAccountQueryIndex
+{
+    FORGE_ACCOUNT_QUERY_CHARACTERS,
+    FORGE_ACCOUNT_QUERY_SPECS,
+    FORGE_ACCOUNT_QUERY_TALENTS_SPENT,
+    FORGE_ACCOUNT_QUERY_TALENTS,
+    FORGE_ACCOUNT_QUERY_POINTS,
+    FORGE_ACCOUNT_QUERY_XMOG_SETS,
+    FORGE_ACCOUNT_QUERY_LOADOUTS,
+
+    MAX_FORGE_ACCOUNT_QUERY
+};
+
+typedef std::array<PreparedQueryResult, MAX_FORGE_ACCOUNT_QUERY> ForgeAccountQueryResults;
+
+class ForgeAccountQueryHolder : public CharacterDatabaseQueryHolder
+{
+public:
+    ForgeAccountQueryHolder(uint32 accountId) : _accountId(accountId) { }
+
+    uint32 GetAccountId() const { return _accountId; }
+
+    bool Initialize()
+    {
+        SetSize(MAX_FORGE_ACCOUNT_QUERY);
+
+        bool res = true;
+        for (uint8 i = 0; i < MAX_FORGE_ACCOUNT_QUERY; ++i)
+            res &= SetPreparedQuery(i, GetStatement(ForgeAccountQueryIndex(i), _accountId));
+
+        return res;
+    }
+
+    static CharacterDatabasePreparedStatement* GetStatement(ForgeAccountQueryIndex index, uint32 accountId)
+    {
+        CharacterDatabasePreparedStatement* stmt = nullptr;
+
+        switch (index)
+        {
+            case FORGE_ACCOUNT_QUERY_CHARACTERS:
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_FORGE_ACCOUNT_CHARACTERS);
+                stmt->SetData(0, accountId);
+                break;
+            case FORGE_ACCOUNT_QUERY_SPECS:
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_FORGE_ACCOUNT_SPECS);
+                stmt->SetData(0, accountId);
+                break;
+            case FORGE_ACCOUNT_QUERY_TALENTS_SPENT:
+            case FORGE_ACCOUNT_QUERY_TALENTS:
+            case FORGE_ACCOUNT_QUERY_POINTS:
+                if (index == FORGE_ACCOUNT_QUERY_TALENTS_SPENT)
+                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_FORGE_ACCOUNT_TALENTS_SPENT);
+                else if (index == FORGE_ACCOUNT_QUERY_TALENTS)
+                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_FORGE_ACCOUNT_TALENTS);
+                else
+                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_FORGE_ACCOUNT_POINTS);
+
+                stmt->SetData(0, accountId);
+                stmt->SetData(1, ACCOUNT_WIDE_KEY);
+                stmt->SetData(2, ACCOUNT_WIDE_KEY);
+                stmt->SetData(3, accountId);
+                break;
+            case FORGE_ACCOUNT_QUERY_XMOG_SETS:
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_FORGE_ACCOUNT_XMOG_SETS);
+                stmt->SetData(0, accountId);
+                break;
+            case FORGE_ACCOUNT_QUERY_LOADOUTS:
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_FORGE_ACCOUNT_LOADOUTS);
+                stmt->SetData(0, accountId);
+                break;
+            default:
+                break;
+        }
+
+        return stmt;
+    }
+
+private:
+    uint32 _accountId;
+};
+
 class ForgeCache : public DatabaseScript
 {
 public:
@@ -246,7 +335,7 @@ public:
         return true;
     }
 
-    bool TryGetCharacterTalents(Player* player, uint32 tabId, OUT std::unordered_map<uint32, ForgeCharacterTalent*>& spec)
+    bool TryGetCharacterTalents(Player* player, uint32 tabId, OUT ForgeFlatMap<uint32, ForgeCharacterTalent>*& spec)
     {
         ForgeCharacterSpec* charSpec;
 
@@ -258,7 +347,7 @@ public:
         if (tabItt == charSpec->Talents.end())
             return false;
 
-        spec = tabItt->second;
+        spec = &tabItt->second;
         return true;
     }
 
@@ -323,7 +412,7 @@ public:
             if (spellItt == talTabItt->second.end())
                 return nullptr;
 
-            return spellItt->second;
+            return &spellItt->second;
         }
 
         return nullptr;
@@ -498,27 +587,29 @@ public:
         std::list<ForgeTalentTab*> tabs;
         if (TryGetForgeTalentTabs(player, CharacterPointType::TALENT_TREE, tabs)) {
             for (auto tab : tabs) {
-                for (auto talent : tab->Talents) {
-                    ForgeCharacterTalent* ct = new ForgeCharacterTalent();
-                    ct->CurrentRank = 0;
-                    ct->SpellId = talent.second->SpellId;
-                    ct->TabId = tab->Id;
-                    ct->type = talent.second->nodeType;
+                auto& specTab = spec->Talents[tab->Id];
+                specTab.reserve(tab->Talents.size());
 
-                    spec->Talents[tab->Id][ct->SpellId] = ct;
+                for (auto talent : tab->Talents) {
+                    ForgeCharacterTalent& ct = specTab[talent.second->SpellId];
+                    ct.CurrentRank = 0;
+                    ct.SpellId = talent.second->SpellId;
+                    ct.TabId = tab->Id;
+                    ct.type = talent.second->nodeType;
                 }
             }
         }
         if (TryGetForgeTalentTabs(player, CharacterPointType::CLASS_TREE, tabs)) {
             for (auto tab : tabs) {
-                for (auto talent : tab->Talents) {
-                    ForgeCharacterTalent* ct = new ForgeCharacterTalent();
-                    ct->CurrentRank = 0;
-                    ct->SpellId = talent.second->SpellId;
-                    ct->TabId = tab->Id;
-                    ct->type = talent.second->nodeType;
+                auto& specTab = spec->Talents[tab->Id];
+                specTab.reserve(tab->Talents.size());
 
-                    spec->Talents[tab->Id][ct->SpellId] = ct;
+                for (auto talent : tab->Talents) {
+                    ForgeCharacterTalent& ct = specTab[talent.second->SpellId];
+                    ct.CurrentRank = 0;
+                    ct.SpellId = talent.second->SpellId;
+                    ct.TabId = tab->Id;
+                    ct.type = talent.second->nodeType;
                 }
             }
         }
@@ -548,9 +639,97 @@ public:
         UpdateCharacterSpec(player, spec);
     }
 
+    // commands may run on a map thread, the cache is rebuilt by the next UpdateAccounts
     void ReloadDB()
     {
-        BuildForgeCache();
+        _reloadPending = true;
+    }
+
+    // Character data is only cached for accounts in use. It is requested when the account asks for its
+    // character list and dropped again once none of its characters has been online for a while.
+    //
+    // Account states and the per-account containers are only loaded and dropped on the world thread
+    // outside of the map updates (character list and login requests, logout, UpdateAccounts), so the
+    // Forge handlers running on map threads never see them change underneath them.
+    void RequestAccountData(uint32 accountId)
+    {
+        ForgeAccountState& state = _accountStates[accountId];
+        state.UnloadTime = GameTime::GetGameTime() + _accountUnloadDelay;
+
+        if (state.Loaded)
+            return;
+
+        std::shared_ptr<ForgeAccountQueryHolder> holder = std::make_shared<ForgeAccountQueryHolder>(accountId);
+        if (!holder->Initialize())
+            return;
+
+        // not the session's callbacks, those also run in map updates once the character is in the world
+        _accountQueryProcessor.AddCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& holder)
+        {
+            HandleAccountDataLoaded(static_cast<ForgeAccountQueryHolder const&>(holder));
+        });
+    }
+
+    // Blocking fallback, used when the data is needed before the asynchronous request returned.
+    // Also keeps the account from being unloaded while a character of it is being created or logged in.
+    void EnsureAccountLoaded(uint32 accountId)
+    {
+        ForgeAccountState& state = _accountStates[accountId];
+        state.UnloadTime = GameTime::GetGameTime() + _accountUnloadDelay;
+
+        if (state.Loaded)
+            return;
+
+        ForgeAccountQueryResults results;
+        for (uint8 i = 0; i < MAX_FORGE_ACCOUNT_QUERY; ++i)
+            results[i] = CharacterDatabase.Query(ForgeAccountQueryHolder::GetStatement(ForgeAccountQueryIndex(i), accountId));
+
+        LoadAccountData(accountId, results);
+    }
+
+    void OnCharacterLogin(Player* player)
+    {
+        _accountStates[player->GetSession()->GetAccountId()].Online.insert(player->GetGUID());
+    }
+
+    void OnCharacterLogout(Player* player)
+    {
+        auto stateItt = _accountStates.find(player->GetSession()->GetAccountId());
+
+        if (stateItt == _accountStates.end())
+            return;
+
+        stateItt->second.Online.erase(player->GetGUID());
+
+        if (stateItt->second.Online.empty())
+            stateItt->second.UnloadTime = GameTime::GetGameTime() + _accountUnloadDelay;
+    }
+
+    // world thread, outside of the map updates
+    void UpdateAccounts()
+    {
+        if (_reloadPending.exchange(false))
+            BuildForgeCache();
+
+        _accountQueryProcessor.ProcessReadyCallbacks();
+    }
+
+    void UnloadIdleAccounts()
+    {
+        Seconds now = GameTime::GetGameTime();
+
+        for (auto stateItt = _accountStates.begin(); stateItt != _accountStates.end();)
+        {
+            if (stateItt->second.Online.empty() && stateItt->second.UnloadTime <= now)
+            {
+                if (stateItt->second.Loaded)
+                    UnloadAccountData(stateItt->first);
+
+                stateItt = _accountStates.erase(stateItt);
+            }
+            else
+                ++stateItt;
+        }
     }
 
     void UpdateCharPoints(Player* player, ForgeCharacterPoint*& fp)
@@ -580,7 +759,7 @@ public:
         else
             trans->Append("INSERT INTO `forge_character_points` (`guid`,`type`,`spec`,`sum`,`max`) VALUES ({},{},{},{},{}) ON DUPLICATE KEY UPDATE `sum` = {}, `max` = {}", acct, (int)fp->PointType, ACCOUNT_WIDE_KEY, fp->Sum, fp->Max, fp->Sum, fp->Max);
 
-        CharacterDatabase.CommitTransaction(trans);
+        CharacterDatabase.CommitTransaction(trans, charGuid.GetCounter());
     }
 
     void UpdateCharacterSpec(Player* player, ForgeCharacterSpec* spec)
@@ -597,9 +776,9 @@ public:
 
         for (auto& tabIdKvp : spec->Talents)
             for (auto& tabTypeKvp : tabIdKvp.second)
-                UpdateCharacterTalentInternal(acct, charId, trans, spec->Id, tabTypeKvp.second->SpellId, tabTypeKvp.second->TabId, tabTypeKvp.second->CurrentRank);
+                UpdateCharacterTalentInternal(acct, charId, trans, spec->Id, tabTypeKvp.second.SpellId, tabTypeKvp.second.TabId, tabTypeKvp.second.CurrentRank);
 
-        CharacterDatabase.CommitTransaction(trans);
+        CharacterDatabase.CommitTransaction(trans, charId);
     }
 
     void UpdateCharacterSpecDetailsOnly(Player* player, ForgeCharacterSpec*& spec)
@@ -608,7 +787,7 @@ public:
         auto trans = CharacterDatabase.BeginTransaction();
         UpdateForgeSpecInternal(player, trans, spec);
 
-        CharacterDatabase.CommitTransaction(trans);
+        CharacterDatabase.CommitTransaction(trans, charId);
     }
 
     void ApplyAccountBoundTalents(Player* player)
@@ -640,7 +819,7 @@ public:
 
                                 if (spellItt != talItt->second.end())
                                 {
-                                    uint32 currentRank = spell.second->Ranks[spellItt->second->CurrentRank];
+                                    uint32 currentRank = spell.second->Ranks[spellItt->second.CurrentRank];
 
                                     for (auto rank : spell.second->Ranks)
                                         if (currentRank != rank.second)
@@ -780,13 +959,19 @@ public:
     }
 
 
-    bool isNumber(const std::string& s)
+    bool isNumber(std::string_view s)
     {
         return std::ranges::all_of(s.begin(), s.end(), [](char c) { return isdigit(c) != 0; });
     }
 
     void UpdateCharacters(uint32 account, Player* player)
     {
+        auto stateItt = _accountStates.find(account);
+
+        // not cached, picked up again on the next load of the account
+        if (stateItt == _accountStates.end() || !stateItt->second.Loaded)
+            return;
+
         if (PlayerCharacterMap.find(account) != PlayerCharacterMap.end())
             PlayerCharacterMap.erase(account);
 
@@ -914,13 +1099,12 @@ public:
     {
         ForgeCharacterSpec* spec;
         if (TryGetCharacterActiveSpec(player, spec)) {
-            auto foundActions = _playerActiveTalentLoadouts.find(player->GetGUID().GetCounter());
-            if (foundActions != _playerActiveTalentLoadouts.end()) {
+            if (PlayerLoadout* active = GetActiveLoadout(player->GetGUID().GetCounter())) {
                 // SELECT button, action, type FROM forge_character_action WHERE guid = ? AND spec = ? and loadout = ? ORDER BY button;
                 CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_ACTIONS_SPEC_LOADOUT);
                 stmt->SetData(0, player->GetGUID().GetCounter());
                 stmt->SetData(1, spec->CharacterSpecTabId);
-                stmt->SetData(2, foundActions->second->id);
+                stmt->SetData(2, active->id);
 
                 WorldSession* mySess = player->GetSession();
                 mySess->GetQueryProcessor().AddCallback(CharacterDatabase.AsyncQuery(stmt)
@@ -941,6 +1125,7 @@ public:
 
     // tabId
     std::unordered_map<uint32, ForgeTalentTab*> TalentTabs;
+    std::unordered_map<uint32 /*tabId*/, std::vector<std::string>> _cacheTalentTreeLayouts;
 
     // choiceNodeId is the id of the node in forge_talents
     std::unordered_map<uint32 /*nodeid*/, std::vector<uint32/*choice spell id*/>> _choiceNodes;
@@ -975,6 +1160,17 @@ public:
     };
     std::unordered_map<uint32 /*tabId*/, TreeMetaData*> _cacheTreeMetaData;
 
+    bool TryGetTalentTreeLayout(uint32 tabId, OUT std::vector<std::string> const*& parts)
+    {
+        auto itr = _cacheTalentTreeLayouts.find(tabId);
+
+        if (itr == _cacheTalentTreeLayouts.end())
+            return false;
+
+        parts = &itr->second;
+        return true;
+    }
+
     void ForgetTalents(Player* player, ForgeCharacterSpec* spec, CharacterPointType pointType) {
         std::list<ForgeTalentTab*> tabs;
         if (TryGetForgeTalentTabs(player, pointType, tabs))
@@ -996,9 +1192,10 @@ public:
                                     player->removeSpell(rank.second, SPEC_MASK_ALL, false);
                                 }
 
-                    auto talent = spec->Talents[tab->Id].find(spell.first);
-                    if (talent != spec->Talents[tab->Id].end())
-                        talent->second->CurrentRank = 0;
+                    auto& specTab = spec->Talents[tab->Id];
+                    auto talent = specTab.find(spell.first);
+                    if (talent != specTab.end())
+                        talent->second.CurrentRank = 0;
                 }
                 spec->PointsSpent[tab->Id] = 0;
             }
@@ -1059,8 +1256,34 @@ public:
         std::string talentString;
     };
     // hater: player loadout storage
-    std::unordered_map<uint32 /*guid*/, std::unordered_map<uint32 /*tabId*/, std::unordered_map<uint8 /*id*/, PlayerLoadout*>>> _playerTalentLoadouts;
-    std::unordered_map<uint32 /*guid*/,PlayerLoadout*> _playerActiveTalentLoadouts;
+    std::unordered_map<uint32 /*guid*/, ForgeFlatMap<uint32 /*tabId*/, ForgeFlatMap<uint8 /*id*/, PlayerLoadout>>> _playerTalentLoadouts;
+    std::unordered_map<uint32 /*guid*/, std::pair<uint32 /*tabId*/, uint8 /*id*/>> _playerActiveTalentLoadouts;
+
+    PlayerLoadout* GetActiveLoadout(uint32 guid)
+    {
+        auto active = _playerActiveTalentLoadouts.find(guid);
+        if (active == _playerActiveTalentLoadouts.end())
+            return nullptr;
+
+        auto player = _playerTalentLoadouts.find(guid);
+        if (player == _playerTalentLoadouts.end())
+            return nullptr;
+
+        auto tab = player->second.find(active->second.first);
+        if (tab == player->second.end())
+            return nullptr;
+
+        auto loadout = tab->second.find(active->second.second);
+        if (loadout == tab->second.end())
+            return nullptr;
+
+        return &loadout->second;
+    }
+
+    void SetActiveLoadout(uint32 guid, PlayerLoadout const& loadout)
+    {
+        _playerActiveTalentLoadouts[guid] = { loadout.tabId, loadout.id };
+    }
 
     std::unordered_map<uint32 /*class*/, uint32 /*spec*/> _playerClassFirstSpec;
 
@@ -1089,18 +1312,17 @@ public:
 
                 auto guid = player->GetGUID().GetCounter();
 
-                PlayerLoadout* plo = new PlayerLoadout();
-                plo->active = true;
-                plo->id = 1;
-                plo->name = "Default";
-                plo->tabId = tab->Id;
-                plo->talentString = loadout;
+                PlayerLoadout& plo = _playerTalentLoadouts[guid][tab->Id][1];
+                plo.active = true;
+                plo.id = 1;
+                plo.name = "Default";
+                plo.tabId = tab->Id;
+                plo.talentString = loadout;
 
-                _playerTalentLoadouts[guid][tab->Id][plo->id] = plo;
-                _playerActiveTalentLoadouts[guid] = plo;
+                SetActiveLoadout(guid, plo);
 
                 CharacterDatabase.Execute("insert into `forge_character_talent_loadouts` (`guid`, `id`, `talentTabId`, `name`, `talentString`, `active`) values ({}, {}, {}, '{}', '{}', {})",
-                    guid, plo->id, tab->Id, plo->name, loadout, true);
+                    guid, plo.id, tab->Id, plo.name, loadout, true);
             }
         }
     }
@@ -1120,31 +1342,42 @@ public:
             
             auto guid = player->GetGUID().GetCounter();
 
-            PlayerLoadout* plo = new PlayerLoadout();
-            plo->active = true;
-            plo->id = 1;
-            plo->name = "Default";
-            plo->tabId = 1;
-            plo->talentString = loadout;
+            PlayerLoadout& plo = _playerTalentLoadouts[guid][1][1];
+            plo.active = true;
+            plo.id = 1;
+            plo.name = "Default";
+            plo.tabId = 1;
+            plo.talentString = loadout;
 
-            _playerTalentLoadouts[guid][1][plo->id] = plo;
-            _playerActiveTalentLoadouts[guid] = plo;
+            SetActiveLoadout(guid, plo);
 
             CharacterDatabase.Execute("insert into `forge_character_talent_loadouts` (`guid`, `id`, `talentTabId`, `name`, `talentString`, `active`) values ({}, {}, {}, '{}', '{}', {})",
-                guid, plo->id, 1, plo->name, loadout, true);
+                guid, plo.id, 1, plo.name, loadout, true);
         }
     }
 
 private:
+    struct ForgeAccountState
+    {
+        bool Loaded = false;
+        Seconds UnloadTime = 0s;
+        std::unordered_set<ObjectGuid> Online;
+    };
+
+    std::unordered_map<uint32 /*account*/, ForgeAccountState> _accountStates;
+    Seconds _accountUnloadDelay = 600s;
+    AsyncCallbackProcessor<SQLQueryHolderCallback> _accountQueryProcessor;
+    std::atomic<bool> _reloadPending = false;
+
     std::unordered_map<ObjectGuid, uint32> CharacterActiveSpecs;
     std::unordered_map<std::string, uint32> CONFIG;
 
     // charId, specId
-    std::unordered_map<ObjectGuid, std::unordered_map<uint32, ForgeCharacterSpec*>> CharacterSpecs;
+    std::unordered_map<ObjectGuid, ForgeFlatMap<uint32, ForgeCharacterSpec*>> CharacterSpecs;
     std::unordered_map<uint32, ForgeCharacterSpec*> AccountWideCharacterSpecs;
 
     // charId, PointType, specid
-    std::unordered_map<ObjectGuid, std::unordered_map<CharacterPointType, std::unordered_map<uint32, ForgeCharacterPoint*>>> CharacterPoints;
+    std::unordered_map<ObjectGuid, ForgeFlatMap<CharacterPointType, ForgeFlatMap<uint32, ForgeCharacterPoint*>>> CharacterPoints;
     std::unordered_map<CharacterPointType, ForgeCharacterPoint*> MaxPointDefaults;
     std::unordered_map < uint32, std::unordered_map<uint32, ForgeCharacterPoint*>> AccountWidePoints;
     // skillid
@@ -1178,7 +1411,13 @@ private:
     {
         CharacterActiveSpecs.clear();
         CharacterSpecs.clear();
+        AccountWideCharacterSpecs.clear();
         CharacterPoints.clear();
+        AccountWidePoints.clear();
+        PlayerCharacterMap.clear();
+        XmogSets.clear();
+        _playerTalentLoadouts.clear();
+        _playerActiveTalentLoadouts.clear();
         MaxPointDefaults.clear();
         SpellToTalentTabMap.clear();
         TalentTabToSpellMap.clear();
@@ -1198,8 +1437,9 @@ private:
             }
         }
 
+        _accountUnloadDelay = Seconds(sConfigMgr->GetOption<uint32>("Forge.Cache.AccountUnloadDelay", 600));
+
         try {
-            GetCharacters();
             GetConfig();
             AddTalentTrees();
             AddTalentsToTrees();
@@ -1208,17 +1448,12 @@ private:
             AddTalentChoiceNodes();
             AddTalentRanks();
             AddTalentUnlearn();
-            AddCharacterSpecs();
-            AddTalentSpent();
-            AddCharacterTalents();
+            AddTalentTreeLayouts();
             //AddCharacterChoiceNodes();
 
-            AddPlayerTalentLoadouts();
-
-            LOG_INFO("server.load", "Loading characters points...");
-            AddCharacterPointsFromDB();
+            LOG_INFO("server.load", "Loading default character points...");
+            AddMaxPointDefaults();
             AddCharacterClassSpecs();
-            AddCharacterXmogSets();
 
             LOG_INFO("server.load", "Loading m+ difficulty multipliers...");
             sObjectMgr->LoadInstanceDifficultyMultiplier();
@@ -1238,6 +1473,13 @@ private:
             AddSpellUnlearnFlags();
             LOG_INFO("server.load", "Loading character spell learn additional spells...");
             AddSpellLearnAdditionalSpells();
+
+            // character data of accounts in use was dropped above, load it again against the new world data
+            for (auto& state : _accountStates)
+                state.second.Loaded = false;
+
+            for (auto& state : _accountStates)
+                EnsureAccountLoaded(state.first);
         }
         catch (std::exception & ex) {
             std::string error = ex.what();
@@ -1246,9 +1488,118 @@ private:
         }
     }
 
-    void GetCharacters()
+    void HandleAccountDataLoaded(ForgeAccountQueryHolder const& holder)
     {
-        QueryResult query = CharacterDatabase.Query("SELECT guid, account FROM characters");
+        auto stateItt = _accountStates.find(holder.GetAccountId());
+
+        // unloaded meanwhile, or the blocking fallback got there first
+        if (stateItt == _accountStates.end() || stateItt->second.Loaded)
+            return;
+
+        ForgeAccountQueryResults results;
+        for (uint8 i = 0; i < MAX_FORGE_ACCOUNT_QUERY; ++i)
+            results[i] = holder.GetPreparedResult(i);
+
+        LoadAccountData(holder.GetAccountId(), results);
+    }
+
+    void LoadAccountData(uint32 accountId, ForgeAccountQueryResults const& results)
+    {
+        ForgeAccountState& state = _accountStates[accountId];
+        state.Loaded = true;
+
+        if (state.Online.empty())
+            state.UnloadTime = GameTime::GetGameTime() + _accountUnloadDelay;
+
+        AddAccountCharacters(accountId, results[FORGE_ACCOUNT_QUERY_CHARACTERS]);
+        AddCharacterSpecs(results[FORGE_ACCOUNT_QUERY_SPECS]);
+        AddTalentSpent(results[FORGE_ACCOUNT_QUERY_TALENTS_SPENT]);
+        AddCharacterTalents(results[FORGE_ACCOUNT_QUERY_TALENTS]);
+        AddPlayerTalentLoadouts(results[FORGE_ACCOUNT_QUERY_LOADOUTS]);
+        AddCharacterPointsFromDB(results[FORGE_ACCOUNT_QUERY_POINTS]);
+        AddCharacterXmogSets(results[FORGE_ACCOUNT_QUERY_XMOG_SETS]);
+    }
+
+    void UnloadAccountData(uint32 accountId)
+    {
+        // account wide points are shared between all specs of the account, free everything once
+        std::unordered_set<ForgeCharacterSpec*> specs;
+        std::unordered_set<ForgeCharacterPoint*> points;
+
+        auto charItt = PlayerCharacterMap.find(accountId);
+
+        if (charItt != PlayerCharacterMap.end())
+        {
+            for (ObjectGuid const& guid : charItt->second)
+            {
+                auto specItt = CharacterSpecs.find(guid);
+
+                if (specItt != CharacterSpecs.end())
+                {
+                    for (auto& spec : specItt->second)
+                        specs.insert(spec.second);
+
+                    CharacterSpecs.erase(specItt);
+                }
+
+                auto pointItt = CharacterPoints.find(guid);
+
+                if (pointItt != CharacterPoints.end())
+                {
+                    for (auto& pointType : pointItt->second)
+                        for (auto& point : pointType.second)
+                            points.insert(point.second);
+
+                    CharacterPoints.erase(pointItt);
+                }
+
+                auto xmogItt = XmogSets.find(guid.GetCounter());
+
+                if (xmogItt != XmogSets.end())
+                {
+                    for (auto& set : xmogItt->second)
+                        delete set.second;
+
+                    XmogSets.erase(xmogItt);
+                }
+
+                _playerTalentLoadouts.erase(guid.GetCounter());
+                _playerActiveTalentLoadouts.erase(guid.GetCounter());
+                CharacterActiveSpecs.erase(guid);
+            }
+
+            PlayerCharacterMap.erase(charItt);
+        }
+
+        auto awsItt = AccountWideCharacterSpecs.find(accountId);
+
+        if (awsItt != AccountWideCharacterSpecs.end())
+        {
+            specs.insert(awsItt->second);
+            AccountWideCharacterSpecs.erase(awsItt);
+        }
+
+        auto awpItt = AccountWidePoints.find(accountId);
+
+        if (awpItt != AccountWidePoints.end())
+        {
+            for (auto& point : awpItt->second)
+                points.insert(point.second);
+
+            AccountWidePoints.erase(awpItt);
+        }
+
+        for (ForgeCharacterSpec* spec : specs)
+            delete spec;
+
+        for (ForgeCharacterPoint* point : points)
+            delete point;
+    }
+
+    void AddAccountCharacters(uint32 accountId, PreparedQueryResult query)
+    {
+        std::vector<ObjectGuid>& characters = PlayerCharacterMap[accountId];
+        characters.clear();
 
         if (!query)
             return;
@@ -1256,14 +1607,14 @@ private:
         do
         {
             Field* field = query->Fetch();
-            PlayerCharacterMap[field[1].Get<uint32>()].push_back(ObjectGuid::Create<HighGuid::Player>(field[0].Get<uint32>()));
+            characters.push_back(ObjectGuid::Create<HighGuid::Player>(field[0].Get<uint32>()));
 
         } while (query->NextRow());
     }
 
     void GetConfig()
     {
-        QueryResult query = WorldDatabase.Query("SELECT * FROM forge_config");
+        QueryResult query = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_config");
 
         if (!query)
             return;
@@ -1278,7 +1629,7 @@ private:
 
     void GetMaxLevelQuests()
     {
-        QueryResult query = WorldDatabase.Query("SELECT spellid FROM forge_prestige_ignored_spells");
+        QueryResult query = sWorldDatabaseSnapshot->Query("SELECT spellid FROM forge_prestige_ignored_spells");
 
         if (!query)
             return;
@@ -1298,24 +1649,36 @@ private:
         CharacterSpecs[charId][spec->Id] = spec;
 
         // check for account wide info, apply to other specs for all other characters of the account in the cache.
-        for (auto& actChr : PlayerCharacterMap[actId])
-            for (auto& sp : CharacterSpecs[actChr])
+        // talents are stored by value per spec, so the account wide copy has to be kept in sync as well.
+        auto applyAccountWide = [&](ForgeCharacterSpec* target)
+        {
+            if (target == spec)
+                return;
+
+            for (auto& ts : spec->PointsSpent)
             {
-                for (auto& ts : spec->PointsSpent)
-                {
-                    if (TalentTabs[ts.first]->TalentType == ACCOUNT_WIDE_TYPE)
-                        CharacterSpecs[charId][sp.first]->PointsSpent[ts.first] = spec->PointsSpent[ts.first];
-                }
+                if (TalentTabs[ts.first]->TalentType == ACCOUNT_WIDE_TYPE)
+                    target->PointsSpent[ts.first] = ts.second;
+            }
 
-                for (auto& tals : spec->Talents)
-                {
-                    if (tals.first > 0) {
-                        if (TalentTabs[tals.first]->TalentType == ACCOUNT_WIDE_TYPE)
-                            for (auto& tal : tals.second)
-                                sp.second->Talents[tals.first][tal.first] = tal.second;
-                    }
+            for (auto& tals : spec->Talents)
+            {
+                if (tals.first > 0) {
+                    if (TalentTabs[tals.first]->TalentType == ACCOUNT_WIDE_TYPE)
+                        for (auto& tal : tals.second)
+                            target->Talents[tals.first][tal.first] = tal.second;
                 }
             }
+        };
+
+        for (auto& actChr : PlayerCharacterMap[actId])
+            for (auto& sp : CharacterSpecs[actChr])
+                applyAccountWide(sp.second);
+
+        auto awsItt = AccountWideCharacterSpecs.find(actId);
+
+        if (awsItt != AccountWideCharacterSpecs.end())
+            applyAccountWide(awsItt->second);
 
         auto activeSpecItt = CharacterActiveSpecs.find(charId);
 
@@ -1367,16 +1730,11 @@ private:
         // TODO trans->Append("DELETE FROM character_perks WHERE spellId = {} and specId = {}", spellId, spec);
     }
 
-    void AddCharacterXmogSets()
+    void AddCharacterXmogSets(PreparedQueryResult xmogSets)
     {
-        LOG_INFO("server.load", "Loading character xmog sets...");
-        QueryResult xmogSets = CharacterDatabase.Query("SELECT * FROM `forge_character_transmogsets`");
-        
         if (!xmogSets)
             return;
 
-        XmogSets.clear();
-
         do
         {
             Field* xmogSet = xmogSets->Fetch();
@@ -1446,7 +1804,7 @@ private:
 
     void AddTalentTrees()
     {
-        QueryResult talentTab = WorldDatabase.Query("SELECT * FROM forge_talent_tabs order by `id` asc");
+        QueryResult talentTab = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_talent_tabs order by `id` asc");
 
         if (!talentTab)
             return;
@@ -1509,7 +1867,7 @@ private:
 
     void AddTalentsToTrees()
     {
-        QueryResult talents = WorldDatabase.Query("SELECT * FROM forge_talents order by `talentTabId` asc, `rowIndex` asc, `columnIndex` asc");
+        QueryResult talents = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_talents order by `talentTabId` asc, `rowIndex` asc, `columnIndex` asc");
 
         _cacheTreeMetaData.clear();
         _cacheSpecNodeToSpell.clear();
@@ -1593,7 +1951,7 @@ private:
 
     void AddTalentPrereqs()
     {
-        QueryResult preReqTalents = WorldDatabase.Query("SELECT * FROM forge_talent_prereq");
+        QueryResult preReqTalents = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_talent_prereq");
 
         if (!preReqTalents)
             return;
@@ -1645,7 +2003,7 @@ private:
 
     void AddTalentChoiceNodes()
     {
-        QueryResult exclTalents = WorldDatabase.Query("SELECT * FROM forge_talent_choice_nodes");
+        QueryResult exclTalents = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_talent_choice_nodes");
 
         _choiceNodes.clear();
         _choiceNodesRev.clear();
@@ -1708,9 +2066,126 @@ private:
         } while (choiceQuery->NextRow());
     }
 
+    // TALENT_TREE_LAYOUT only depends on world data, frame it once per tab instead of on every login
+    void AddTalentTreeLayouts()
+    {
+        _cacheTalentTreeLayouts.clear();
+
+        std::string msg;
+
+        for (auto& tabKvp : TalentTabs)
+        {
+            ForgeTalentTab* tab = tabKvp.second;
+
+            if (!tab)
+                continue;
+
+            msg.clear();
+            BuildTalentTreeLayout(tab, msg);
+            Player::BuildForgeUIMsgParts(ForgeTopic::TALENT_TREE_LAYOUT, msg, _cacheTalentTreeLayouts[tab->Id]);
+        }
+    }
+
+    void BuildTalentTreeLayout(ForgeTalentTab* tab, std::string& msg)
+    {
+        auto field = [&msg](auto value, char const* delimiter)
+        {
+            msg.append(std::to_string(value)).append(delimiter);
+        };
+
+        field(tab->Id, "^");
+        msg.append(tab->Name).append("^");
+        field(tab->SpellIconId, "^");
+        msg.append(tab->Background).append("^");
+        msg.append(tab->Description).append("^");
+        field(tab->Role, "^");
+        msg.append(tab->SpellString).append("^");
+        field((int)tab->TalentType, "^");
+        field(tab->TabIndex, "^");
+
+        int i = 0;
+
+        for (auto& talentKvp : tab->Talents)
+        {
+            ForgeTalent* talent = talentKvp.second;
+
+            if (!talent)
+                continue;
+
+            if (i)
+                msg.append("*");
+
+            field(tab->Id, "&");
+            field(talent->SpellId, "&");
+            field(talent->ColumnIndex, "&");
+            field(talent->RowIndex, "&");
+            field(talent->RankCost, "&");
+            field(talent->RequiredLevel, "&");
+            field(talent->TabPointReq, "&");
+            field(talent->NumberOfRanks, "&");
+            field((int)talent->PreReqType, "&");
+
+            int j = 0;
+
+            for (auto& preReq : talent->Prereqs)
+            {
+                if (j)
+                    msg.append("@");
+
+                field(preReq->Talent, "$");
+                field(preReq->TalentTabId, "$");
+                field(preReq->RequiredRank, "");
+                j++;
+            }
+
+            msg.append("&"); // delimit the field
+
+            j = 0;
+
+            for (auto& rank : talent->Ranks)
+            {
+                if (j)
+                    msg.append("%");
+
+                field(rank.first, "~");
+                field(rank.second, "");
+                j++;
+            }
+
+            msg.append("&"); // delimit the field
+
+            j = 0;
+
+            for (auto& unlearn : talent->UnlearnSpells)
+            {
+                if (j)
+                    msg.append("`");
+
+                field(unlearn, "");
+                j++;
+            }
+
+            msg.append("&");
+            field((int)talent->nodeType, "&");
+            field(talent->nodeIndex, "&");
+
+            // choices keep counting from the unlearn spells, as the addon has always received them
+            for (auto& choice : talent->Choices)
+            {
+                if (j)
+                    msg.append("!");
+
+                field(choice.second->spellId, "");
+                j++;
+            }
+
+            i++;
+        }
+    }
+
     void AddTalentRanks()
     {
-        QueryResult talentRanks = WorldDatabase.Query("SELECT * FROM forge_talent_ranks");
+        QueryResult talentRanks = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_talent_ranks");
 
         if (!talentRanks)
             return;
@@ -1740,7 +2215,7 @@ private:
 
     void AddTalentUnlearn()
     {
-        QueryResult exclTalents = WorldDatabase.Query("SELECT * FROM forge_talent_unlearn");
+        QueryResult exclTalents = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_talent_unlearn");
 
         if (!exclTalents)
             return;
@@ -1766,10 +2241,8 @@ private:
         } while (exclTalents->NextRow());
     }
 
-    void AddCharacterSpecs()
+    void AddCharacterSpecs(PreparedQueryResult charSpecs)
     {
-        QueryResult charSpecs = CharacterDatabase.Query("SELECT * FROM forge_character_specs");
-
         if (!charSpecs)
             return;
         
@@ -1793,10 +2266,8 @@ private:
         } while (charSpecs->NextRow());
     }
 
-    void AddTalentSpent()
+    void AddTalentSpent(PreparedQueryResult exclTalents)
     {
-        QueryResult exclTalents = CharacterDatabase.Query("SELECT * FROM forge_character_talents_spent");
-
         if (!exclTalents)
             return;
 
@@ -1831,10 +2302,8 @@ private:
         } while (exclTalents->NextRow());
     }
 
-    void AddCharacterTalents()
+    void AddCharacterTalents(PreparedQueryResult talentsQuery)
     {
-        QueryResult talentsQuery = CharacterDatabase.Query("SELECT * FROM forge_character_talents");
-
         if (!talentsQuery)
             return;
 
@@ -1844,43 +2313,75 @@ private:
             uint32 id = talentFields[0].Get<uint32>();
             ObjectGuid characterGuid = ObjectGuid::Create<HighGuid::Player>(id);
             uint32 specId = talentFields[1].Get<uint32>();
-            ForgeCharacterTalent* talent = new ForgeCharacterTalent();
-            talent->SpellId = talentFields[2].Get<uint32>();
-            talent->TabId = talentFields[3].Get<uint32>();
-            talent->CurrentRank = talentFields[4].Get<uint8>();
+            ForgeCharacterTalent talent;
+            talent.SpellId = talentFields[2].Get<uint32>();
+            talent.TabId = talentFields[3].Get<uint32>();
+            talent.CurrentRank = talentFields[4].Get<uint8>();
 
-            auto invalid = false;
+            // tabs and talents removed from the world data can still have character rows
+            auto tabItt = TalentTabs.find(talent.TabId);
+            if (tabItt == TalentTabs.end())
+            {
+                LOG_ERROR("FORGE.ForgeCache", "Talent {} of {} {} is in unknown tab {}, skipped.", talent.SpellId, specId == ACCOUNT_WIDE_KEY ? "account" : "character", id, talent.TabId);
+                continue;
+            }
+
+            auto talentItt = tabItt->second->Talents.find(talent.SpellId);
+            if (talentItt == tabItt->second->Talents.end())
+            {
+                LOG_ERROR("FORGE.ForgeCache", "Unknown talent {} in tab {} of {} {}, skipped.", talent.SpellId, talent.TabId, specId == ACCOUNT_WIDE_KEY ? "account" : "character", id);
+                continue;
+            }
+
+            talent.type = talentItt->second->nodeType;
 
             if (specId != ACCOUNT_WIDE_KEY)
             {
-                ForgeTalent* ft = TalentTabs[talent->TabId]->Talents[talent->SpellId];
                 ForgeCharacterSpec * spec = CharacterSpecs[characterGuid][specId];
-                talent->type = ft->nodeType;
-                spec->Talents[talent->TabId][talent->SpellId] = talent;
+                spec->Talents[talent.TabId][talent.SpellId] = talent;
             }
             else
             {
-                AccountWideCharacterSpecs[id]->Talents[talent->TabId][talent->SpellId] = talent;
+                auto aws = AccountWideCharacterSpecs.find(id);
+
+                if (aws == AccountWideCharacterSpecs.end())
+                    AccountWideCharacterSpecs[id] = new ForgeCharacterSpec();
+
+                AccountWideCharacterSpecs[id]->Talents[talent.TabId][talent.SpellId] = talent;
 
                 for (auto& ch : PlayerCharacterMap[id])
                     for (auto& spec : CharacterSpecs[ch])
-                    {
-                        ForgeTalent* ft = TalentTabs[talent->TabId]->Talents[talent->SpellId];
-                        talent->type = ft->nodeType;
-                        spec.second->Talents[talent->TabId][talent->SpellId] = talent;
-                    }
+                        spec.second->Talents[talent.TabId][talent.SpellId] = talent;
             }
 
         } while (talentsQuery->NextRow());
     }
 
-    void AddCharacterPointsFromDB()
+    void AddMaxPointDefaults()
     {
-        QueryResult pointsQuery = CharacterDatabase.Query("SELECT * FROM forge_character_points");
+        QueryResult pointsQuery = CharacterDatabase.Query("SELECT * FROM forge_character_points WHERE guid = {}", UINT_MAX);
+
+        if (!pointsQuery)
+            return;
+
+        do
+        {
+            Field* pointsFields = pointsQuery->Fetch();
+            CharacterPointType pt = (CharacterPointType)pointsFields[1].Get<uint8>();
+            ForgeCharacterPoint* cp = new ForgeCharacterPoint();
+            cp->PointType = pt;
+            cp->SpecId = pointsFields[2].Get<uint32>();
+            cp->Sum = pointsFields[3].Get<uint32>();
+            cp->Max = pointsFields[4].Get<uint32>();
+
+            MaxPointDefaults[pt] = cp;
+        } while (pointsQuery->NextRow());
+    }
 
+    void AddCharacterPointsFromDB(PreparedQueryResult pointsQuery)
+    {
         if (!pointsQuery)
             return;
-        uint32 almostMax = UINT_MAX - 1;
 
         do
         {
@@ -1893,28 +2394,19 @@ private:
             cp->Sum = pointsFields[3].Get<uint32>();
             cp->Max = pointsFields[4].Get<uint32>();
 
-            if (guid == UINT_MAX)
+            if (cp->SpecId == ACCOUNT_WIDE_KEY)
             {
-                MaxPointDefaults[pt] = cp;
+                AccountWidePoints[guid][pt] = cp;
+
+                for (auto& ch : PlayerCharacterMap[guid])
+                    for (auto& spec : CharacterSpecs[ch])
+                        CharacterPoints[ch][cp->PointType][spec.first] = cp;
             }
             else
             {
-                if (cp->SpecId == ACCOUNT_WIDE_KEY)
-                {
-                    AccountWidePoints[guid][pt] = cp;
-
-                    for (auto& ch : PlayerCharacterMap[guid])
-                        for (auto& spec : CharacterSpecs[ch])
-                            CharacterPoints[ch][cp->PointType][spec.first] = cp;
-                        
-                }
-                else
-                {
-                    ObjectGuid og = ObjectGuid::Create<HighGuid::Player>(guid);
-                    CharacterPoints[og][cp->PointType][cp->SpecId] = cp;
-                }
+                ObjectGuid og = ObjectGuid::Create<HighGuid::Player>(guid);
+                CharacterPoints[og][cp->PointType][cp->SpecId] = cp;
             }
-            
         } while (pointsQuery->NextRow());
     }
 
@@ -1952,7 +2444,7 @@ private:
 
     void AddPlayerSpellScaler()
     {
-        QueryResult scale = WorldDatabase.Query("SELECT * FROM forge_player_spell_scale");
+        QueryResult scale = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_player_spell_scale");
 
         if (!scale)
             return;
@@ -1973,7 +2465,7 @@ private:
         FlaggedForUnlearn.clear();
 
         std::unordered_map<uint32 /*guid*/, std::vector<uint32 /*spell*/>> SpellLearnedAdditionalSpells;
-        QueryResult flag = WorldDatabase.Query("SELECT * FROM `forge_talent_spell_flagged_unlearn`");
+        QueryResult flag = sWorldDatabaseSnapshot->Query("SELECT * FROM `forge_talent_spell_flagged_unlearn`");
 
         if (!flag)
             return;
@@ -1994,7 +2486,7 @@ private:
         SpellLearnedAdditionalSpells.clear();
 
         std::unordered_map<uint32 /*guid*/, std::vector<uint32 /*spell*/>> SpellLearnedAdditionalSpells;
-        QueryResult added = WorldDatabase.Query("SELECT * FROM `forge_talent_learn_additional_spell`");
+        QueryResult added = sWorldDatabaseSnapshot->Query("SELECT * FROM `forge_talent_learn_additional_spell`");
 
         if (!added)
             return;
@@ -2014,7 +2506,7 @@ private:
     {
         _levelClassSpellMap.clear();
 
-        QueryResult maQuery = WorldDatabase.Query("select * from `acore_world`.`forge_character_spec_spells` order by `class` asc, `race` asc, `level` asc, `spell` asc");
+        QueryResult maQuery = sWorldDatabaseSnapshot->Query("select * from `acore_world`.`forge_character_spec_spells` order by `class` asc, `race` asc, `level` asc, `spell` asc");
 
         if (!maQuery)
             return;
@@ -2031,13 +2523,8 @@ private:
         } while (maQuery->NextRow());
     }
 
-    void AddPlayerTalentLoadouts()
+    void AddPlayerTalentLoadouts(PreparedQueryResult loadouts)
     {
-        _playerTalentLoadouts.clear();
-        _playerActiveTalentLoadouts.clear();
-
-        QueryResult loadouts = WorldDatabase.Query("select * from `acore_characters`.`forge_character_talent_loadouts`");
-
         if (!loadouts)
             return;
 
@@ -2051,16 +2538,14 @@ private:
             std::string talentString = loadoutsFields[4].Get<std::string>();
             bool active = loadoutsFields[5].Get<bool>();
 
-            PlayerLoadout* plo = new PlayerLoadout();
-            plo->id = id;
-            plo->tabId = tabId;
-            plo->name = name;
-            plo->talentString = talentString;
-            plo->active = active;
-
+            PlayerLoadout& plo = _playerTalentLoadouts[guid][tabId][id];
+            plo.id = id;
+            plo.tabId = tabId;
+            plo.name = name;
+            plo.talentString = talentString;
+            plo.active = active;
 
-            _playerTalentLoadouts[guid][tabId][id] = plo;
-            _playerActiveTalentLoadouts[guid] = plo;
+            SetActiveLoadout(guid, plo);
         } while (loadouts->NextRow());
     }
 
@@ -2068,7 +2553,7 @@ private:
     void AddItemSlotValue() {
         _forgeItemSlotValues.clear();
 
-        QueryResult values = WorldDatabase.Query("select * from `acore_world`.`forge_item_slot_value`");
+        QueryResult values = sWorldDatabaseSnapshot->Query("select * from `acore_world`.`forge_item_slot_value`");
 
         if (!values)
             return;
@@ -2086,7 +2571,7 @@ private:
     void AddItemStatValue() {
         _forgeItemStatValues.clear();
 
-        QueryResult values = WorldDatabase.Query("select * from `acore_world`.`forge_item_stat_value`");
+        QueryResult values = sWorldDatabaseSnapshot->Query("select * from `acore_world`.`forge_item_stat_value`");
 
         if (!values)
             return;
@@ -2104,7 +2589,7 @@ private:
     void AddItemStatPools() {
         _forgeItemSecondaryStatPools.clear();
 
-        QueryResult values = WorldDatabase.Query("select * from `acore_world`.`forge_item_stat_pool`");
+        QueryResult values = sWorldDatabaseSnapshot->Query("select * from `acore_world`.`forge_item_stat_pool`");
 
         if (!values)
             return;
@@ -44,106 +44,13 @@ void ForgeCommonMessage::SendTalentTreeLayout(Player* player, uint32 tab)
 
 std::string ForgeCommonMessage::BuildTree(Player* player, CharacterPointType pointType, std::list<ForgeTalentTab*> tabs)
 {
-
+    // layouts are built with the cache, see ForgeCache::AddTalentTreeLayouts
     for (const auto& tab : tabs)
     {
-        std::string msg;
-
-        msg = msg + std::to_string(tab->Id) + "^" +
-            tab->Name + "^" + std::to_string(tab->SpellIconId) + "^" +
-            tab->Background + "^" +
-            tab->Description + "^" +
-            std::to_string(tab->Role) + "^" +
-            tab->SpellString + "^" +
-            std::to_string((int)tab->TalentType) + "^" +
-            std::to_string(tab->TabIndex) + "^";
-
-        int i = 0;
-
-        for (auto& talentKvp : tab->Talents)
-        {
-            if (talentKvp.second) {
-                std::string delimiter = "*";
-
-                if (i == 0)
-                    delimiter = "";
-
-                msg = msg + delimiter + std::to_string(tab->Id) + "&" +
-                    std::to_string(talentKvp.second->SpellId) + "&" +
-                    std::to_string(talentKvp.second->ColumnIndex) + "&" +
-                    std::to_string(talentKvp.second->RowIndex) + "&" +
-                    std::to_string(talentKvp.second->RankCost) + "&" +
-                    std::to_string(talentKvp.second->RequiredLevel) + "&" +
-                    std::to_string(talentKvp.second->TabPointReq) + "&" +
-                    std::to_string(talentKvp.second->NumberOfRanks) + "&" +
-                    std::to_string((int)talentKvp.second->PreReqType) + "&";
-
-                int j = 0;
-
-                for (auto& preReq : talentKvp.second->Prereqs)
-                {
-                    std::string reqDel = "@";
-
-                    if (j == 0)
-                        reqDel = "";
-
-                    msg = msg + reqDel + std::to_string(preReq->Talent) + "$" +
-                        std::to_string(preReq->TalentTabId) + "$" +
-                        std::to_string(preReq->RequiredRank);
-
-                    j++;
-                }
-
-                msg = msg + "&"; // delimit the field
-
-                j = 0;
-
-                for (auto& preReq : talentKvp.second->Ranks)
-                {
-                    std::string reqDel = "%";
-
-                    if (j == 0)
-                        reqDel = "";
-
-                    msg = msg + reqDel + std::to_string(preReq.first) + "~" +
-                        std::to_string(preReq.second);
+        std::vector<std::string> const* parts;
 
-                    j++;
-                }
-
-                msg = msg + "&"; // delimit the field
-
-                j = 0;
-
-                for (auto& preReq : talentKvp.second->UnlearnSpells)
-                {
-                    std::string reqDel = "`";
-
-                    if (j == 0)
-                        reqDel = "";
-
-                    msg = msg + reqDel + std::to_string(preReq);
-
-                    j++;
-                }
-
-                msg = msg + "&" + std::to_string(talentKvp.second->nodeType) + "&"
-                    + std::to_string(talentKvp.second->nodeIndex) + "&";
-
-                for (auto& choice : talentKvp.second->Choices)
-                {
-                    std::string choiceDel = "!";
-
-                    if (j == 0)
-                        choiceDel = "";
-
-                    msg = msg + choiceDel + std::to_string(choice.second->spellId);
-                    j++;
-                }
-                i++;
-            }
-        }
-        player->SendForgeUIMsg(ForgeTopic::TALENT_TREE_LAYOUT, msg);
+        if (fc->TryGetTalentTreeLayout(tab->Id, parts))
+            player->SendForgeUIMsgParts(*parts);
     }
 
     return "";
@@ -160,9 +67,9 @@ void ForgeCommonMessage::ApplyKnownForgeSpells(Player* player)
 
             for (auto& spellKvp : tabkvp.second)
             {
-                ForgeTalentTab* tab = fc->TalentTabs[spellKvp.second->TabId];
-                auto spell = tab->Talents[spellKvp.second->SpellId];
-                auto fsId = spell->Ranks[spellKvp.second->CurrentRank];
+                ForgeTalentTab* tab = fc->TalentTabs[spellKvp.second.TabId];
+                auto spell = tab->Talents[spellKvp.second.SpellId];
+                auto fsId = spell->Ranks[spellKvp.second.CurrentRank];
 
                 player->removeSpell(fsId, SPEC_MASK_ALL, false);
 
@@ -218,13 +125,7 @@ bool ForgeCommonMessage::CanLearnTalent(Player* player, uint32 tabId, uint32 spe
             return false;
 
 
-        auto sklTItt = spec->Talents.find(tabId);
-        std::unordered_map<uint32, ForgeCharacterTalent*> skillTabs;
-
-        if (sklTItt == spec->Talents.end())
-            skillTabs = spec->Talents[tabId];
-        else
-            skillTabs = sklTItt->second;
+        auto& skillTabs = spec->Talents[tabId];
 
         int reqsNotMet = 0;
         bool anyPrereq = false;
@@ -245,7 +146,7 @@ bool ForgeCommonMessage::CanLearnTalent(Player* player, uint32 tabId, uint32 spe
             {
                 auto skillItt = skillTabs.find(preReq->Talent);
 
-                if ((skillItt == skillTabs.end() || preReq->RequiredRank > skillItt->second->CurrentRank) && !anyPrereq)
+                if ((skillItt == skillTabs.end() || preReq->RequiredRank > skillItt->second.CurrentRank) && !anyPrereq)
                 {
                     continue;
                 }
@@ -273,7 +174,7 @@ bool ForgeCommonMessage::CanLearnTalent(Player* player, uint32 tabId, uint32 spe
                         continue;
                     }
 
-                    if (typeItt->second->CurrentRank < preReq->RequiredRank)
+                    if (typeItt->second.CurrentRank < preReq->RequiredRank)
                     {
                         reqsNotMet++;
                         continue;
@@ -289,7 +190,7 @@ bool ForgeCommonMessage::CanLearnTalent(Player* player, uint32 tabId, uint32 spe
                         continue;
                     }
 
-                    if (typeItt->second->CurrentRank < preReq->RequiredRank)
+                    if (typeItt->second.CurrentRank < preReq->RequiredRank)
                     {
                         reqsNotMet++;
                         continue;
@@ -326,27 +227,42 @@ void ForgeCommonMessage::SendTalents(Player* player)
     {
         auto pClass = player->getClass();
         auto cSpec = spec->CharacterSpecTabId;
+
+        // look up without inserting: growing spec->Talents would invalidate references into it
+        static ForgeFlatMap<uint32, ForgeCharacterTalent> const noTalents;
+        auto treeOf = [spec](uint32 tabId) -> ForgeFlatMap<uint32, ForgeCharacterTalent> const&
+        {
+            auto tree = spec->Talents.find(tabId);
+            return tree != spec->Talents.end() ? tree->second : noTalents;
+        };
+
+        auto rankOf = [](ForgeFlatMap<uint32, ForgeCharacterTalent> const& tree, uint32 spellId) -> uint32
+        {
+            auto talent = tree.find(spellId);
+            return talent != tree.end() ? talent->second.CurrentRank : 0;
+        };
+
         for (auto tpt : fc->TALENT_POINT_TYPES) {
             std::string clientMsg = base64_char.substr(tpt+1, 1)+base64_char.substr(cSpec, 1)+base64_char.substr(pClass, 1);
             switch (tpt) {
             case CharacterPointType::TALENT_TREE: {
                 if (!sConfigMgr->GetBoolDefault("echos", false)) {
                     uint32 i = 0;
-                    auto classTree = spec->Talents[fc->_cacheClassNodeToClassTree[player->getClassMask()]];
-                    auto classMap = fc->_cacheClassNodeToSpell[player->getClassMask()];
+                    auto& classTree = treeOf(fc->_cacheClassNodeToClassTree[player->getClassMask()]);
+                    auto& classMap = fc->_cacheClassNodeToSpell[player->getClassMask()];
 
-                    auto specTree = spec->Talents[spec->CharacterSpecTabId];
-                    auto specMap = fc->_cacheSpecNodeToSpell[spec->CharacterSpecTabId];
+                    auto& specTree = treeOf(spec->CharacterSpecTabId);
+                    auto& specMap = fc->_cacheSpecNodeToSpell[spec->CharacterSpecTabId];
 
                     if (classTree.size() == classMap.size()) {
                         for (int i = 1; i <= classMap.size(); i++) {
-                            clientMsg += base64_char.substr(classTree[classMap[i]]->CurrentRank + 1, 1);
+                            clientMsg += base64_char.substr(rankOf(classTree, classMap[i]) + 1, 1);
                         }
                     }
 
                     if (specTree.size() == specMap.size()) {
                         for (int i = 1; i <= specMap.size(); i++) {
-                            clientMsg += base64_char.substr(specTree[specMap[i]]->CurrentRank + 1, 1);
+                            clientMsg += base64_char.substr(rankOf(specTree, specMap[i]) + 1, 1);
                         }
                     }
                 }
@@ -354,10 +270,10 @@ void ForgeCommonMessage::SendTalents(Player* player)
                     std::list<ForgeTalentTab*> tabs;
                     if (fc->TryGetForgeTalentTabs(player, tpt, tabs)) {
                         for (auto tab : tabs) {
-                            auto specTree = spec->Talents[tab->Id];
-                            auto specMap = fc->_cacheSpecNodeToSpell[tab->Id];
+                            auto& specTree = treeOf(tab->Id);
+                            auto& specMap = fc->_cacheSpecNodeToSpell[tab->Id];
                             for (int i = 1; i <= specMap.size(); i++) {
-                                clientMsg += base64_char.substr(specTree[specMap[i]]->CurrentRank + 1, 1);
+                                clientMsg += base64_char.substr(rankOf(specTree, specMap[i]) + 1, 1);
                             }
                         }
                     }
@@ -372,9 +288,9 @@ void ForgeCommonMessage::SendTalents(Player* player)
                 if (fc->TryGetForgeTalentTabs(player, tpt, tabs)) {
 
                     for (auto tab : tabs) {
-                        auto specTree = spec->Talents[tab->Id];
-                        for (auto talent : specTree) {
-                            clientMsg += base64_char.substr(talent.second->CurrentRank + 1, 1);
+                        auto& specTree = treeOf(tab->Id);
+                        for (auto& talent : specTree) {
+                            clientMsg += base64_char.substr(talent.second.CurrentRank + 1, 1);
                         }
                     }
 
@@ -405,7 +321,7 @@ void ForgeCommonMessage::SendXmogSets(Player* player) {
     player->SendForgeUIMsg(ForgeTopic::GET_XMOG_SETS, msg);
 }
 
-std::string ForgeCommonMessage::DoBuildRanks(std::unordered_map<uint32, ForgeCharacterTalent*>& spec, Player* player, std::string clientMsg, uint32 tabId)
+std::string ForgeCommonMessage::DoBuildRanks(ForgeFlatMap<uint32, ForgeCharacterTalent>& spec, Player* player, std::string clientMsg, uint32 tabId)
 {
     int i = 0;
     ForgeTalentTab* tab;
@@ -420,13 +336,13 @@ std::string ForgeCommonMessage::DoBuildRanks(std::unordered_map<uint32, ForgeCha
             auto itt = spec.find(sp.first);
 
             if (itt != spec.end()) {
-                if (itt->second->type == NodeType::CHOICE)
-                    if (itt->second->CurrentRank == 0)
+                if (itt->second.type == NodeType::CHOICE)
+                    if (itt->second.CurrentRank == 0)
                         clientMsg = clientMsg + delimiter + std::to_string(sp.second->SpellId) + "~0";
                     else
-                        clientMsg = clientMsg + delimiter + std::to_string(itt->second->SpellId) + "~" + std::to_string(fs->ChoiceNodesChosen.at(itt->second->SpellId));
+                        clientMsg = clientMsg + delimiter + std::to_string(itt->second.SpellId) + "~" + std::to_string(fs->ChoiceNodesChosen.at(itt->second.SpellId));
                 else
-                    clientMsg = clientMsg + delimiter + std::to_string(itt->second->SpellId) + "~" + std::to_string(itt->second->CurrentRank);
+                    clientMsg = clientMsg + delimiter + std::to_string(itt->second.SpellId) + "~" + std::to_string(itt->second.CurrentRank);
             }
             else
                 clientMsg = clientMsg + delimiter + std::to_string(sp.second->SpellId) + "~0";
@@ -560,13 +476,13 @@ void ForgeCommonMessage::SendLoadouts(Player* player)
     if (found != fc->_playerTalentLoadouts.end()) {
         std::string msg;
         std::string delim = "";
-        for (auto spec : found->second) {
+        for (auto& spec : found->second) {
             msg += delim + std::to_string(spec.first) + "$";
             auto idDelim = "";
-            for (auto loadout : spec.second) {
+            for (auto& loadout : spec.second) {
                 msg += idDelim + std::to_string(loadout.first) + "^"
-                    + std::to_string(loadout.second->active) + "^"
-                    + loadout.second->name + "^" + loadout.second->talentString;
+                    + std::to_string(loadout.second.active) + "^"
+                    + loadout.second.name + "^" + loadout.second.talentString;
                 idDelim = "~";
             }
             delim = "*";
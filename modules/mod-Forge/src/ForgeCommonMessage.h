@@ -42,7 +42,7 @@ public:
     std::string EncodeTalentString(Player* player);
     void DecodeTalentString(std::string talent_str);
 private:
-    std::string DoBuildRanks(std::unordered_map<uint32, ForgeCharacterTalent*>& spec, Player* player, std::string clientMsg, uint32 tabId);
+    std::string DoBuildRanks(ForgeFlatMap<uint32, ForgeCharacterTalent>& spec, Player* player, std::string clientMsg, uint32 tabId);
 
     // hater: talent string encoding
     const std::string base64_char = "|ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
@@ -0,0 +1,100 @@
+#ifndef FORGE_FLAT_MAP_H
+#define FORGE_FLAT_MAP_H
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Associative container backed by a single sorted vector.
+// Character talent data holds a few dozen entries per tree and is mostly iterated or looked up,
+// which a contiguous block serves far better than a node based hash map.
+// Like std::vector, inserting or erasing invalidates iterators and references to the entries.
+template<typename K, typename V>
+class ForgeFlatMap
+{
+public:
+    typedef std::pair<K, V> value_type;
+    typedef typename std::vector<value_type>::iterator iterator;
+    typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+    iterator begin() { return _entries.begin(); }
+    iterator end() { return _entries.end(); }
+    const_iterator begin() const { return _entries.begin(); }
+    const_iterator end() const { return _entries.end(); }
+
+    size_t size() const { return _entries.size(); }
+    bool empty() const { return _entries.empty(); }
+    void clear() { _entries.clear(); }
+    void reserve(size_t size) { _entries.reserve(size); }
+
+    iterator find(K const& key)
+    {
+        iterator itr = LowerBound(key);
+        return itr != _entries.end() && itr->first == key ? itr : _entries.end();
+    }
+
+    const_iterator find(K const& key) const
+    {
+        const_iterator itr = LowerBound(key);
+        return itr != _entries.end() && itr->first == key ? itr : _entries.end();
+    }
+
+    V& operator[](K const& key)
+    {
+        iterator itr = LowerBound(key);
+
+        if (itr == _entries.end() || itr->first != key)
+            itr = _entries.emplace(itr, key, V());
+
+        return itr->second;
+    }
+
+    V& at(K const& key)
+    {
+        iterator itr = find(key);
+
+        if (itr == _entries.end())
+            throw std::out_of_range("ForgeFlatMap::at");
+
+        return itr->second;
+    }
+
+    V const& at(K const& key) const
+    {
+        const_iterator itr = find(key);
+
+        if (itr == _entries.end())
+            throw std::out_of_range("ForgeFlatMap::at");
+
+        return itr->second;
+    }
+
+    iterator erase(iterator itr) { return _entries.erase(itr); }
+
+    size_t erase(K const& key)
+    {
+        iterator itr = find(key);
+
+        if (itr == _entries.end())
+            return 0;
+
+        _entries.erase(itr);
+        return 1;
+    }
+
+private:
+    iterator LowerBound(K const& key)
+    {
+        return std::lower_bound(_entries.begin(), _entries.end(), key, [](value_type const& entry, K const& k) { return entry.first < k; });
+    }
+
+    const_iterator LowerBound(K const& key) const
+    {
+        return std::lower_bound(_entries.begin(), _entries.end(), key, [](value_type const& entry, K const& k) { return entry.first < k; });
+    }
+
+    std::vector<value_type> _entries;
+};
+
+#endif
@@ -45,7 +45,22 @@
 class ForgePlayerMessageHandler : public PlayerScript
 {
 public:
-    ForgePlayerMessageHandler(ForgeCache* cache, ForgeCommonMessage* cmh) : PlayerScript("ForgePlayerMessageHandler")
+    ForgePlayerMessageHandler(ForgeCache* cache, ForgeCommonMessage* cmh) : PlayerScript("ForgePlayerMessageHandler", {
+        PLAYERHOOK_ON_CREATE,
+        PLAYERHOOK_ON_EQUIP,
+        PLAYERHOOK_ON_FIRST_LOGIN,
+        PLAYERHOOK_ON_LOGIN,
+        PLAYERHOOK_ON_LOGOUT,
+        PLAYERHOOK_ON_DELETE,
+        PLAYERHOOK_ON_BEFORE_SEND_CHAT_MESSAGE,
+        PLAYERHOOK_ON_LEVEL_CHANGED,
+        PLAYERHOOK_ON_LEARN_SPELL,
+        PLAYERHOOK_ON_LOOT_ITEM,
+        PLAYERHOOK_ON_ADD_ITEM,
+        PLAYERHOOK_ON_CREATE_ITEM,
+        PLAYERHOOK_ON_QUEST_REWARD_ITEM,
+        PLAYERHOOK_GENERATE_ITEM,
+    })
     {
         fc = cache;
         cm = cmh;
@@ -53,6 +68,8 @@ public:
 
     void OnCreate(Player* player) override
     {
+        fc->EnsureAccountLoaded(player->GetSession()->GetAccountId());
+
         // setup DB
         player->SetSpecsCount(0);
         fc->AddCharacterSpecSlot(player);
@@ -83,6 +100,8 @@ public:
         if (!player)
             return;
 
+        fc->OnCharacterLogin(player);
+
         LearnSpellsForLevel(player);
         fc->ApplyAccountBoundTalents(player);
         fc->UnlearnFlaggedSpells(player);
@@ -97,10 +116,11 @@ public:
 
         ForgeCharacterSpec* spec;
         if (fc->TryGetCharacterActiveSpec(player, spec)) {
-            auto active = fc->_playerActiveTalentLoadouts.find(player->GetGUID().GetCounter());
-            if (active != fc->_playerActiveTalentLoadouts.end())
-                player->SaveLoadoutActions(spec->CharacterSpecTabId, active->second->id);
+            if (ForgeCache::PlayerLoadout* active = fc->GetActiveLoadout(player->GetGUID().GetCounter()))
+                player->SaveLoadoutActions(spec->CharacterSpecTabId, active->id);
         }
+
+        fc->OnCharacterLogout(player);
     }
 
     void OnDelete(ObjectGuid guid, uint32 accountId) override
@@ -274,6 +294,56 @@ private:
     }
 };
 
+// Forge character data is cached per account, load it once the account reaches the character list
+class ForgeAccountDataLoader : public AccountScript
+{
+public:
+    ForgeAccountDataLoader(ForgeCache* cache) : AccountScript("ForgeAccountDataLoader")
+    {
+        fc = cache;
+    }
+
+    void OnCharacterListRequest(uint32 accountId) override
+    {
+        fc->RequestAccountData(accountId);
+    }
+
+    void OnBeforeCharacterLogin(uint32 accountId) override
+    {
+        fc->EnsureAccountLoaded(accountId);
+    }
+
+private:
+    ForgeCache* fc;
+};
+
+class ForgeAccountDataUpdater : public WorldScript
+{
+public:
+    ForgeAccountDataUpdater(ForgeCache* cache) : WorldScript("ForgeAccountDataUpdater")
+    {
+        fc = cache;
+    }
+
+    // runs on the world thread while no map is updated, see ForgeCache::RequestAccountData
+    void OnUpdate(uint32 diff) override
+    {
+        fc->UpdateAccounts();
+
+        if (_unloadTimer <= diff)
+        {
+            fc->UnloadIdleAccounts();
+            _unloadTimer = MINUTE * IN_MILLISECONDS;
+        }
+        else
+            _unloadTimer -= diff;
+    }
+
+private:
+    ForgeCache* fc;
+    uint32 _unloadTimer = MINUTE * IN_MILLISECONDS;
+};
+
 // Add all scripts in one
 void AddForgePlayerMessageHandler()
 {
@@ -281,6 +351,8 @@ void AddForgePlayerMessageHandler()
     ForgeCommonMessage* cm = new ForgeCommonMessage(cache);
 
     new ForgePlayerMessageHandler(cache, cm);
+    new ForgeAccountDataLoader(cache);
+    new ForgeAccountDataUpdater(cache);
     sTopicRouter->AddHandler(new ActivateSpecHandler(cache, cm));
     sTopicRouter->AddHandler(new GetTalentsHandler(cache, cm));
     sTopicRouter->AddHandler(new GetCharacterSpecsHandler(cache, cm));
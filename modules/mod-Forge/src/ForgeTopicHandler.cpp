@@ -6,12 +6,7 @@
 #include "WorldPacket.h"
 #include <string>
 
-ForgeTopicHandler::ForgeTopicHandler(const std::string& topic)
-{
-    HandlesTopic = topic;
-}
-
 ForgeTopicHandler::ForgeTopicHandler(ForgeTopic topic)
 {
-    HandlesTopic = std::to_string((int)topic);
+    HandlesTopic = topic;
 }
@@ -4,8 +4,7 @@
 class ForgeTopicHandler
 {
 public:
-    ForgeTopicHandler(const std::string&);
     ForgeTopicHandler(ForgeTopic);
     virtual void HandleMessage(ForgeAddonMessage&) {};
-    std::string HandlesTopic;
+    ForgeTopic HandlesTopic;
 };
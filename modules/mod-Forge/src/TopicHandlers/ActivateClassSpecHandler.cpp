@@ -5,6 +5,7 @@
 #include "WorldPacket.h"
 #include "TopicRouter.h"
 #include "ForgeCommonMessage.h"
+#include "StringConvert.h"
 #include <ForgeCache.cpp>
 
 class ActivateClassSpecHandler : public ForgeTopicHandler
@@ -23,7 +24,7 @@ public:
             if (!fc->isNumber(iam.message))
                 return;
 
-            uint32 tabId = static_cast<uint32>(std::stoul(iam.message));
+            uint32 tabId = Acore::StringTo<uint32>(iam.message).value_or(0);
             ForgeCharacterSpec* spec;
 
             if (iam.player->IsInCombat() || iam.player->isDead()) {
@@ -5,6 +5,7 @@
 #include "WorldPacket.h"
 #include "TopicRouter.h"
 #include "ForgeCommonMessage.h"
+#include "StringConvert.h"
 #include <ForgeCache.cpp>
 
 class ActivateSpecHandler : public ForgeTopicHandler
@@ -21,7 +22,7 @@ public:
         if (iam.message == "" || !fc->isNumber(iam.message))
             return;
 
-        uint32 id = static_cast<uint32>(std::stoul(iam.message));
+        uint32 id = Acore::StringTo<uint32>(iam.message).value_or(0);
         ForgeCharacterSpec* spec;
         ForgeCharacterSpec* currentSpec;
 
@@ -39,7 +40,7 @@ public:
                 if (fc->TryGetTalentTab(iam.player, talTab.first, ftt))
                 {
                     for (auto& talSp : talTab.second)
-                        iam.player->removeSpell(ftt->Talents[talSp.second->SpellId]->Ranks[talSp.second->CurrentRank], SPEC_MASK_ALL, false);
+                        iam.player->removeSpell(ftt->Talents[talSp.second.SpellId]->Ranks[talSp.second.CurrentRank], SPEC_MASK_ALL, false);
                 }
             }
 
@@ -55,7 +56,7 @@ public:
                 if (fc->TryGetTalentTab(iam.player, talTab.first, ftt))
                 {
                     for (auto& talSp : talTab.second)
-                        iam.player->learnSpell(ftt->Talents[talSp.second->SpellId]->Ranks[talSp.second->CurrentRank], false);
+                        iam.player->learnSpell(ftt->Talents[talSp.second.SpellId]->Ranks[talSp.second.CurrentRank], false);
                 }
             }
 
@@ -5,6 +5,7 @@
 #include "WorldPacket.h"
 #include "TopicRouter.h"
 #include "ForgeCommonMessage.h"
+#include "StringConvert.h"
 #include <ForgeCache.cpp>
 
 class DeleteLoadoutHandler : public ForgeTopicHandler
@@ -19,7 +20,7 @@ public:
     void HandleMessage(ForgeAddonMessage& iam) override
     {
         if (fc->isNumber(iam.message)) {
-            uint32 id = static_cast<uint32>(std::stoul(iam.message));
+            uint32 id = Acore::StringTo<uint32>(iam.message).value_or(0);
             ForgeCharacterSpec* spec;
             if (fc->TryGetCharacterActiveSpec(iam.player, spec) && id > 1) {
                 auto player = fc->_playerTalentLoadouts.find(iam.player->GetGUID().GetCounter());
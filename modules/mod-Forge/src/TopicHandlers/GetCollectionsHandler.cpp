@@ -5,6 +5,7 @@
 #include "WorldPacket.h"
 #include "TopicRouter.h"
 #include "ForgeCommonMessage.h"
+#include "StringConvert.h"
 #include <ForgeCache.cpp>
 
 class GetCollectionsHandler : public ForgeTopicHandler
@@ -24,7 +25,7 @@ public:
         }
         else
         {
-            uint32 slotId = static_cast<uint32>(std::stoul(iam.message));
+            uint32 slotId = Acore::StringTo<uint32>(iam.message).value_or(0);
             SendCollections(iam.player, slotId, "");
         }
     }
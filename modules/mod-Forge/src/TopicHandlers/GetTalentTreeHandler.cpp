@@ -5,6 +5,7 @@
 #include "WorldPacket.h"
 #include "TopicRouter.h"
 #include "ForgeCommonMessage.h"
+#include "StringConvert.h"
 #include <ForgeCache.cpp>
 
 class GetTalentTreeHandler : public ForgeTopicHandler
@@ -24,7 +25,7 @@ public:
         }
         else
         {
-            uint32 tabId = static_cast<uint32>(std::stoul(iam.message));
+            uint32 tabId = Acore::StringTo<uint32>(iam.message).value_or(0);
             cm->SendTalentTreeLayout(iam.player, tabId);
         }
     }
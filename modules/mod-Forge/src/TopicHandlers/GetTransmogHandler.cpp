@@ -5,6 +5,7 @@
 #include "WorldPacket.h"
 #include "TopicRouter.h"
 #include "ForgeCommonMessage.h"
+#include "StringConvert.h"
 #include <ForgeCache.cpp>
 
 class GetTransmogHandler : public ForgeTopicHandler
@@ -21,7 +22,7 @@ public:
         if (iam.message == "-1" || iam.message == "" || !fc->isNumber(iam.message))
             return;
 
-        uint32 setId = static_cast<uint32>(std::stoul(iam.message));
+        uint32 setId = Acore::StringTo<uint32>(iam.message).value_or(0);
         cm->SendXmogSet(iam.player, setId);
     }
 
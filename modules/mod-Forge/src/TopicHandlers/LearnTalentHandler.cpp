@@ -28,6 +28,7 @@ public:
         if (fc->TryGetCharacterActiveSpec(iam.player, spec)) {
             if (iam.message.size() > fc->META_PREFIX) {
                 _treeMetaData.clear();
+                _simplifiedTreeMap.clear();
                 auto echos = sConfigMgr->GetBoolDefault("echos", false);
 
                 auto classinfo = iam.message.substr(0, fc->META_PREFIX);
@@ -119,31 +120,31 @@ public:
                             fc->ForgetTalents(iam.player, spec, foundType);
                             std::list<uint32> tabs = {};
 
-                            for (auto ct : toLearn) {
-                                if (std::find(tabs.begin(), tabs.end(), ct->TabId) == tabs.end()) {
-                                    spec->Talents[ct->TabId].clear();
-                                    tabs.push_back(ct->TabId);
+                            for (auto& ct : toLearn) {
+                                if (std::find(tabs.begin(), tabs.end(), ct.TabId) == tabs.end()) {
+                                    spec->Talents[ct.TabId].clear();
+                                    tabs.push_back(ct.TabId);
                                 }
 
-                                bool choiceNode = ct->type == NodeType::CHOICE;
-                                spec->Talents[ct->TabId][ct->SpellId] = ct;
-                                if (ct->CurrentRank > 0) {
+                                bool choiceNode = ct.type == NodeType::CHOICE;
+                                spec->Talents[ct.TabId][ct.SpellId] = ct;
+                                if (ct.CurrentRank > 0) {
                                     ForgeTalentTab* ThisTab;
-                                    if (fc->TryGetTalentTab(iam.player, ct->TabId, ThisTab)) {
+                                    if (fc->TryGetTalentTab(iam.player, ct.TabId, ThisTab)) {
                                         ForgeCharacterPoint* points = fc->GetSpecPoints(iam.player, ThisTab->TalentType, spec->Id);
-                                        auto ft = ThisTab->Talents[ct->SpellId];
-                                        spec->PointsSpent[ct->TabId] += ft->RankCost * ct->CurrentRank;
+                                        auto ft = ThisTab->Talents[ct.SpellId];
+                                        spec->PointsSpent[ct.TabId] += ft->RankCost * ct.CurrentRank;
                                         points->Sum -= ft->RankCost;
 
                                         for (auto s : ft->UnlearnSpells)
                                             iam.player->removeSpell(s, SPEC_MASK_ALL, false);
 
-                                        auto rankedSpell = ft->Ranks[ct->CurrentRank];
-                                        if (!iam.player->HasSpell(ct->SpellId)) {
+                                        auto rankedSpell = ft->Ranks[ct.CurrentRank];
+                                        if (!iam.player->HasSpell(ct.SpellId)) {
                                             if (choiceNode) {
-                                                auto choice = fc->_choiceNodes[ct->SpellId][ct->CurrentRank - 1];
+                                                auto choice = fc->_choiceNodes[ct.SpellId][ct.CurrentRank - 1];
                                                 iam.player->learnSpell(choice);
-                                                spec->ChoiceNodesChosen[ct->SpellId] = choice;
+                                                spec->ChoiceNodesChosen[ct.SpellId] = choice;
                                             }
                                             else {
                                                 iam.player->learnSpell(rankedSpell);
@@ -194,12 +195,12 @@ public:
         unlocked.clear();
         if (tab->ClassMask == player->getClassMask()) {
             std::unordered_map <uint32 /*tabId*/, uint8 /*spent*/> spend;
-                for (auto tab : _simplifiedTreeMap) {
+                for (auto& tab : _simplifiedTreeMap) {
                     ForgeTalentTab* specTab;
                     if (fc->TryGetTalentTab(player, tab.first, specTab)) {
                         ForgeCharacterPoint* points = fc->GetSpecPoints(player, specTab->TalentType, spec->Id);
-                        for (auto row : tab.second) {
-                            for (auto col : row.second) {
+                        for (auto& row : tab.second) {
+                            for (auto& col : row.second) {
                                 if (auto metaData = _treeMetaData[tab.first]) {
                                     if (row.first > metaData->MaxYDim || col.first > metaData->MaxXDim)
                                         return false;
@@ -246,11 +247,11 @@ public:
                                                         for (auto unlock : node->unlocks)
                                                             unlocked.push_back(unlock->spellId);
                                                     }
-                                                    ForgeCharacterTalent* ct = new ForgeCharacterTalent();
-                                                    ct->CurrentRank = col.second;
-                                                    ct->SpellId = talent->SpellId;
-                                                    ct->TabId = tab.first;
-                                                    ct->type = talent->nodeType;
+                                                    ForgeCharacterTalent ct;
+                                                    ct.CurrentRank = col.second;
+                                                    ct.SpellId = talent->SpellId;
+                                                    ct.TabId = tab.first;
+                                                    ct.type = talent->nodeType;
 
                                                     toLearn.push_back(ct);
                                                 }
@@ -277,7 +278,8 @@ private:
     const std::string base64_char = "|ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"; // | is to offset string to base 1
 
     std::unordered_map<uint32, ForgeCache::TreeMetaData*> _treeMetaData;
-    std::unordered_map<uint32 /*tabId*/, std::unordered_map<uint8 /*row*/, std::unordered_map<uint8/*col*/, uint32 /*rank*/>>> _simplifiedTreeMap;
-    std::vector<ForgeCharacterTalent*> toLearn = {};
+    // sorted so rows are validated top down, before the nodes they unlock
+    ForgeFlatMap<uint32 /*tabId*/, ForgeFlatMap<uint8 /*row*/, ForgeFlatMap<uint8/*col*/, uint32 /*rank*/>>> _simplifiedTreeMap;
+    std::vector<ForgeCharacterTalent> toLearn = {};
     std::vector<uint32> unlocked = {};
 };
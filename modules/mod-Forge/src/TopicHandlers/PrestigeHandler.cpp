@@ -56,10 +56,10 @@ public:
                     if (fc->TryGetTalentTab(iam.player, tab.first, ftt))
                     {
                         spec->PointsSpent[ftt->Id] = 0;
-                        for (auto t : tab.second)
+                        for (auto& t : tab.second)
                         {
-                            iam.player->removeSpell(ftt->Talents[t.second->SpellId]->Ranks[t.second->CurrentRank], SPEC_MASK_ALL, false); // Remove all spells.
-                            t.second->CurrentRank = 0; // only remove talents here.
+                            iam.player->removeSpell(ftt->Talents[t.second.SpellId]->Ranks[t.second.CurrentRank], SPEC_MASK_ALL, false); // Remove all spells.
+                            t.second.CurrentRank = 0; // only remove talents here.
                         }
                     }
                     break;
@@ -68,9 +68,9 @@ public:
                     ForgeTalentTab* fftt;
 
                     if (fc->TryGetTalentTab(iam.player, tab.first, fftt))
-                        for (auto t : tab.second)
+                        for (auto& t : tab.second)
                         {
-                            iam.player->removeSpell(fftt->Talents[t.second->SpellId]->Ranks[t.second->CurrentRank], SPEC_MASK_ALL, false); // Remove all spells.
+                            iam.player->removeSpell(fftt->Talents[t.second.SpellId]->Ranks[t.second.CurrentRank], SPEC_MASK_ALL, false); // Remove all spells.
                         }
                     break;
                 default:
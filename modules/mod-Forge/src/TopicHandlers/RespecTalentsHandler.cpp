@@ -5,6 +5,7 @@
 #include "WorldPacket.h"
 #include "TopicRouter.h"
 #include "ForgeCommonMessage.h"
+#include "StringConvert.h"
 #include <ForgeCache.cpp>
 #include <unordered_map>
 
@@ -29,7 +30,7 @@ public:
         if (iam.message.empty() || !fc->isNumber(iam.message))
             return;
 
-        CharacterPointType pointT = (CharacterPointType)std::stoi(iam.message);
+        CharacterPointType pointT = (CharacterPointType)Acore::StringTo<int32>(iam.message).value_or(0);
 
         auto pointItt = RESPEC_POINT_TYPE.find(pointT);
 
@@ -60,8 +61,8 @@ public:
 
                     for (auto& tKvp : tabKvp.second)
                     {
-                        iam.player->removeSpell(tab->Talents[skillId]->Ranks[tKvp.second->CurrentRank], SPEC_MASK_ALL, false);
-                        tKvp.second->CurrentRank = 0;
+                        iam.player->removeSpell(tab->Talents[skillId]->Ranks[tKvp.second.CurrentRank], SPEC_MASK_ALL, false);
+                        tKvp.second.CurrentRank = 0;
                     }
                 }
             }
@@ -60,31 +60,29 @@ public:
 
                     auto exists = spec->second.find(id);
                     if (exists != spec->second.end()) {
-                        exists->second->name = name;
-                        exists->second->talentString = talentString;
+                        exists->second.name = name;
+                        exists->second.talentString = talentString;
 
-                        if (fc->_playerActiveTalentLoadouts[guid]->id != exists->second->id)
-                            fc->_playerActiveTalentLoadouts[guid] = exists->second;
+                        if (fc->GetActiveLoadout(guid) != &exists->second)
+                            fc->SetActiveLoadout(guid, exists->second);
                     }
                     else {
                         if (spec->second.size() >= fc->MAX_LOADOUTS_PER_SPEC)
                             return;
 
-                        auto active = fc->_playerActiveTalentLoadouts[guid];
-                        active->active = false;
-                        fc->_playerActiveTalentLoadouts[guid] = active;
-                        fc->_playerTalentLoadouts[guid][specId][active->id] = active;
-                        iam.player->SaveLoadoutActions(specId, active->id);
-
-                        ForgeCache::PlayerLoadout* plo = new ForgeCache::PlayerLoadout();
-                        plo->active = true;
-                        plo->id = id;
-                        plo->tabId = specId;
-                        plo->name = name;
-                        plo->talentString = talentString;
-
-                        fc->_playerActiveTalentLoadouts[guid] = plo;
-                        fc->_playerTalentLoadouts[guid][specId][id] = plo;
+                        if (ForgeCache::PlayerLoadout* active = fc->GetActiveLoadout(guid)) {
+                            active->active = false;
+                            iam.player->SaveLoadoutActions(specId, active->id);
+                        }
+
+                        ForgeCache::PlayerLoadout& plo = spec->second[id];
+                        plo.active = true;
+                        plo.id = id;
+                        plo.tabId = specId;
+                        plo.name = name;
+                        plo.talentString = talentString;
+
+                        fc->SetActiveLoadout(guid, plo);
                         fc->LoadLoadoutActions(iam.player);
                     }
 
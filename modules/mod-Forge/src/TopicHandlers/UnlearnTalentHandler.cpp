@@ -91,13 +91,13 @@ public:
                         return;
                     }
 
-                    uint32 refund = spellItt->second->CurrentRank * tab->Talents[spellId]->RankCost;
+                    uint32 refund = spellItt->second.CurrentRank * tab->Talents[spellId]->RankCost;
                     spec->PointsSpent[tabId] -= refund;
 
                     sfp->Sum += refund;
                     sfp->Max -= refund;
 
-                    if (spellItt->second->type == NodeType::CHOICE) {
+                    if (spellItt->second.type == NodeType::CHOICE) {
                         auto chosen = spec->ChoiceNodesChosen.find(spellId);
 
                         if (chosen == spec->ChoiceNodesChosen.end()) {
@@ -114,13 +114,13 @@ public:
                     else {
                         auto spellInfo = sSpellMgr->GetSpellInfo(spellId);
                         if (spellInfo->HasAttribute(SPELL_ATTR0_PASSIVE))
-                            iam.player->RemoveOwnedAura(tab->Talents[spellId]->Ranks[spellItt->second->CurrentRank]);
+                            iam.player->RemoveOwnedAura(tab->Talents[spellId]->Ranks[spellItt->second.CurrentRank]);
                         else
-                            iam.player->removeSpell(tab->Talents[spellId]->Ranks[spellItt->second->CurrentRank], SPEC_MASK_ALL, false);
+                            iam.player->removeSpell(tab->Talents[spellId]->Ranks[spellItt->second.CurrentRank], SPEC_MASK_ALL, false);
                     }
 
                     iam.player->UpdateAllStats();
-                    spellItt->second->CurrentRank = 0;
+                    spellItt->second.CurrentRank = 0;
 
                     fc->UpdateCharPoints(iam.player, sfp);
                     fc->UpdateCharacterSpec(iam.player, spec);
@@ -147,13 +147,11 @@ private:
                     {
                         for (auto spell : tab.second)
                         {
-                            if (spell.second->CurrentRank > 0)
+                            if (spell.second.CurrentRank > 0)
                             {
-                                ForgeAddonMessage* msg = new ForgeAddonMessage();
-                                msg->topic = 2;
-                                msg->player = player;
-                                msg->message = std::to_string(tab.first) + ";" + std::to_string(spell.first);
-                                HandleMessage(*msg);
+                                std::string payload = std::to_string(tab.first) + ";" + std::to_string(spell.first);
+                                ForgeAddonMessage msg{ player, ForgeTopic::UNLEARN_TALENT, payload };
+                                HandleMessage(msg);
                             }
                         }
                     }
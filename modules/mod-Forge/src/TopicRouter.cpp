@@ -1,4 +1,5 @@
 #include "TopicRouter.h"
+#include "StringConvert.h"
 
 TopicRouter* TopicRouter::get_instance()
 {
@@ -12,54 +13,51 @@ TopicRouter* TopicRouter::get_instance()
 
 TopicRouter::TopicRouter()
 {
-
+    handlers.fill(nullptr);
 }
 
 void TopicRouter::AddHandler(ForgeTopicHandler* handler)
 {
-    handlers[handler->HandlesTopic] = handler;
+    ASSERT(handler->HandlesTopic < ForgeTopic::MAX_FORGE_TOPIC);
+    handlers[size_t(handler->HandlesTopic)] = handler;
 }
 
 void TopicRouter::Route(Player* player, uint32& type, uint32& lang, std::string& msg)
 {
     if (lang == LANG_ADDON && type == CHAT_MSG_WHISPER)
     {
-        int addonTypeIndex = msg.find("\t");
+        // FORGE\t<topic>|<message>
+        std::string_view view(msg);
 
-        if (addonTypeIndex == std::string::npos)
+        if (!view.starts_with(MSG_TYPE_FORGE) || view.size() <= MSG_TYPE_FORGE.size() || view[MSG_TYPE_FORGE.size()] != '\t')
             return;
 
-        std::string addonType = msg.substr(0, addonTypeIndex);
+        view.remove_prefix(MSG_TYPE_FORGE.size() + 1);
+
+        std::size_t delimeterIndex = view.find('|');
 
-        if (addonType != MSG_TYPE_FORGE)
+        if (delimeterIndex == std::string_view::npos)
             return;
 
-        int delimeterIndex = msg.find('|');
+        Optional<uint32> topic = Acore::StringTo<uint32>(view.substr(0, delimeterIndex));
 
-        if (delimeterIndex == std::string::npos)
-            return;
+        if (topic && *topic < uint32(ForgeTopic::MAX_FORGE_TOPIC))
+        {
+            ForgeAddonMessage iam;
+            iam.player = player;
+            iam.topic = ForgeTopic(*topic);
+            iam.message = view.substr(delimeterIndex + 1);
+            Route(iam);
+        }
 
-        addonTypeIndex++;
-        auto evnt = msg.substr(addonTypeIndex, delimeterIndex - addonTypeIndex);
-        delimeterIndex++; // advance past the delimiter
-        ForgeAddonMessage iam;
-        iam.player = player;
-        iam.message = msg.substr(delimeterIndex);
-        iam.topic = evnt;
-        Route(iam, msg);
-        msg = ""; // clearing the message will stop it from being used in chat handler.
+        msg.clear(); // clearing the message will stop it from being used in chat handler.
     }
 }
 
-void TopicRouter::Route(ForgeAddonMessage& msg, std::string& msgStr)
+void TopicRouter::Route(ForgeAddonMessage& msg)
 {
-    std::unordered_map<std::string, ForgeTopicHandler*>::iterator topic = handlers.find(msg.topic);
-
-    if (topic != handlers.end())
-    {
-        msgStr = "";
-        topic->second->HandleMessage(msg);
-    }
+    if (ForgeTopicHandler* handler = handlers[size_t(msg.topic)])
+        handler->HandleMessage(msg);
 }
 
 
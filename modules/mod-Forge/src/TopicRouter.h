@@ -6,6 +6,7 @@
 #include "Chat.h"
 #include "WorldPacket.h"
 #include <ForgeTopicHandler.h>
+#include <array>
 #include <unordered_map>
 
 class TopicRouter
@@ -16,10 +17,10 @@ public:
 
         void AddHandler(ForgeTopicHandler*);
         void Route(Player* player, uint32& type, uint32& lang, std::string& msg);
-        void Route(ForgeAddonMessage& msg, std::string& msgStr);
+        void Route(ForgeAddonMessage& msg);
 
 private:
-    std::unordered_map<std::string, ForgeTopicHandler*> handlers;
+    std::array<ForgeTopicHandler*, size_t(ForgeTopic::MAX_FORGE_TOPIC)> handlers;
     // Player, topic, message#, message
     std::unordered_map<ObjectGuid, std::unordered_map<std::string, std::map<int, ForgeAddonMessage, std::greater<int>>>> messages;
 };
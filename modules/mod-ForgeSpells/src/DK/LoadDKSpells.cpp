@@ -461,7 +461,7 @@ class spell_dk_festering_strike : public SpellScript
             {
                 auto damage = GetHitDamage();
                 if (Player* caster = GetCaster()->ToPlayer()) {
-                    std::vector<SpellInfo*> spellInfos = sSpellMgr->GetSpellInfosForDummyA(GetSpellInfo()->Id);
+                    auto spellInfos = sSpellMgr->GetSpellInfosForDummyA(GetSpellInfo()->Id);
                     for (auto* info : spellInfos) {
                         if (SpellInfo* spell = caster->GetLatestSpellEffectForEnhacement(info->Effects[0].MiscValueB)) {
                             switch (spell->Effects[0].MiscValueB) {
@@ -519,7 +519,7 @@ class spell_dk_deaths_embrace : public SpellScript
             {
                 auto damage = GetHitDamage();
                 if (Player* caster = GetCaster()->ToPlayer()) {
-                    std::vector<SpellInfo*> spellInfos = sSpellMgr->GetSpellInfosForDummyA(GetSpellInfo()->Id);
+                    auto spellInfos = sSpellMgr->GetSpellInfosForDummyA(GetSpellInfo()->Id);
                     for (auto* info : spellInfos) {
                         if (SpellInfo* spell = caster->GetLatestSpellEffectForEnhacement(info->Effects[0].MiscValueB)) {
                             switch (spell->Effects[0].MiscValueB) {
@@ -570,7 +570,7 @@ class spell_dk_plague_scythe : public SpellScript
         if (GetSpellInfo()->Id) {
             if (Unit* unitTarget = GetHitUnit()) {
                 if (Player* caster = GetCaster()->ToPlayer()) {
-                    std::vector<SpellInfo*> spellInfos = sSpellMgr->GetSpellInfosForDummyA(GetSpellInfo()->Id);
+                    auto spellInfos = sSpellMgr->GetSpellInfosForDummyA(GetSpellInfo()->Id);
                     for (auto* info : spellInfos) {
                         if (SpellInfo* spell = caster->GetLatestSpellEffectForEnhacement(info->Effects[0].MiscValueB)) {
                             int32 value = 0;
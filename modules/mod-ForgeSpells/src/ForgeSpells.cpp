@@ -33,7 +33,11 @@ public:
     // char id, spell id
     std::unordered_map<uint32, std::unordered_map<uint32, SpellTooltipInfo*>> m_tooltipInfo;
 
-    ForgePlayerSpellCache() : PlayerScript("ForgePlayerSpellCache")
+    ForgePlayerSpellCache() : PlayerScript("ForgePlayerSpellCache", {
+        PLAYERHOOK_ON_LOGIN,
+        PLAYERHOOK_ON_LEARN_SPELL,
+        PLAYERHOOK_ON_FORGOT_SPELL,
+    })
     {
 
     }
@@ -46,11 +50,9 @@ public:
     void OnLearnSpell(Player* player, uint32 spellID) override
     {
         uint32 charId = player->GetGUID().GetCounter();
-        auto forgeSpellMap = sSpellMgr->GetDummyMap();
+        auto forgeSpells = sSpellMgr->GetSpellInfosForDummyId(spellID);
 
-        auto spellItt = forgeSpellMap.find(spellID);
-
-        if (spellItt == forgeSpellMap.end())
+        if (forgeSpells.empty())
         {
             auto* si = sSpellMgr->GetSpellInfo(spellID);
 
@@ -60,23 +62,22 @@ public:
 
                 if (fs.size() > 0)
                 {
-                    spellItt = forgeSpellMap.find(si->Effects[0].MiscValue);
                     spellID = si->Effects[0].MiscValue;
+                    forgeSpells = sSpellMgr->GetSpellInfosForDummyId(spellID);
                 }
             }
         }
 
-        if (spellItt != forgeSpellMap.end())
+        if (!forgeSpells.empty())
         {
             m_tooltipInfo[charId][spellID] = new SpellTooltipInfo();
 
-            for (auto& enchKvp : spellItt->second)
-                for (auto& rankKvp : enchKvp.second)
-                {
-                    auto* tti = m_tooltipInfo[charId][spellID];
-                    tti->AddedTooltipEffects.push_back(rankKvp->Id);
-                    CacheTokens(spellID, player, tti);
-                }
+            for (auto* rank : forgeSpells)
+            {
+                auto* tti = m_tooltipInfo[charId][spellID];
+                tti->AddedTooltipEffects.push_back(rank->Id);
+                CacheTokens(spellID, player, tti);
+            }
 
             SendSpellTooltip(player, spellID);
         }
@@ -202,11 +203,7 @@ public:
 
     void RecalcTooltips(Player* player)
     {
-        // Spell ID, Effect ID, list of ranks
-       // std::unordered_map<uint32, std::unordered_map<uint32, std::vector<SpellInfo*>>>
-       // we get all the forge spells to setup tooltip info
-        auto forgeSpellMap = sSpellMgr->GetDummyMap();
-
+        // we walk the shared forge dummy index to setup tooltip info, ranks of every effect of a spell are adjacent
         auto knownSpells = player->GetKnownSpells();
         uint32 charId = player->GetGUID().GetCounter();
 
@@ -217,34 +214,26 @@ public:
         {
             if (sIdKvp.second->Active)
             {
-                auto spellItt = forgeSpellMap.find(sIdKvp.first);
-                
-                if (spellItt != forgeSpellMap.end())
+                for (auto* rank : sSpellMgr->GetSpellInfosForDummyId(sIdKvp.first))
                 {
-                    for (auto& enchKvp : spellItt->second)
+                    if (player->HasSpell(rank->Id))
                     {
-                        for (auto& rankKvp : enchKvp.second)
-                        {
-                            if (player->HasSpell(rankKvp->Id))
-                            {
-                                auto pItt = m_tooltipInfo.find(charId);
+                        auto pItt = m_tooltipInfo.find(charId);
 
-                                if (pItt == m_tooltipInfo.end())
-                                {
-                                    m_tooltipInfo[charId][sIdKvp.first] = new SpellTooltipInfo();
-                                }
-                                else if (pItt->second.find(sIdKvp.first) == pItt->second.end())
-                                {
-                                    m_tooltipInfo[charId][sIdKvp.first] = new SpellTooltipInfo();
-                                }
+                        if (pItt == m_tooltipInfo.end())
+                        {
+                            m_tooltipInfo[charId][sIdKvp.first] = new SpellTooltipInfo();
+                        }
+                        else if (pItt->second.find(sIdKvp.first) == pItt->second.end())
+                        {
+                            m_tooltipInfo[charId][sIdKvp.first] = new SpellTooltipInfo();
+                        }
 
-                                auto* tti = m_tooltipInfo[charId][sIdKvp.first];
+                        auto* tti = m_tooltipInfo[charId][sIdKvp.first];
 
-                                tti->AddedTooltipEffects.push_back(rankKvp->Id);
+                        tti->AddedTooltipEffects.push_back(rank->Id);
 
-                                CacheTokens(sIdKvp.first, player, tti);
-                            }
-                        }
+                        CacheTokens(sIdKvp.first, player, tti);
                     }
                 }
             }
@@ -16,7 +16,11 @@ class PS_Accountwide : public PlayerScript
 public:
     Accountwide* aw;
 
-    PS_Accountwide(Accountwide* instance) : PlayerScript("PS_Accountwide")
+    PS_Accountwide(Accountwide* instance) : PlayerScript("PS_Accountwide", {
+        PLAYERHOOK_ON_LEARN_SPELL,
+        PLAYERHOOK_ON_REPUTATION_CHANGE,
+        PLAYERHOOK_ON_LOGIN,
+    })
     {
         aw = instance;
     }
@@ -30,7 +30,18 @@ class PS_Gamemode : public PlayerScript
 {
 public:
 
-    PS_Gamemode() : PlayerScript("PS_Gamemode")
+    PS_Gamemode() : PlayerScript("PS_Gamemode", {
+        PLAYERHOOK_ON_LOGIN,
+        PLAYERHOOK_ON_BEFORE_QUEST_COMPLETE,
+        PLAYERHOOK_ON_LEVEL_CHANGED,
+        PLAYERHOOK_ON_EQUIP,
+        PLAYERHOOK_ON_PLAYER_KILLED_BY_CREATURE,
+        PLAYERHOOK_CAN_JOIN_LFG,
+        PLAYERHOOK_CAN_GROUP_ACCEPT,
+        PLAYERHOOK_CAN_INIT_TRADE,
+        PLAYERHOOK_CAN_ENTER_MAP,
+        PLAYERHOOK_CAN_SEND_MAIL,
+    })
     {
        
     }
@@ -259,7 +259,7 @@ public:
 class GOMove_player_track : public PlayerScript
 {
 public:
-    GOMove_player_track() : PlayerScript("GOMove_player_track") { }
+    GOMove_player_track() : PlayerScript("GOMove_player_track", { PLAYERHOOK_ON_LOGOUT }) { }
 
     void OnLogout(Player* player) override
     {
@@ -20,12 +20,135 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MapDefines.h"
+#include <algorithm>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <cmath>
 
 namespace MMAP
 {
     static char const* const MAP_FILE_NAME_FORMAT = "%s/mmaps/%03i.mmap";
     static char const* const TILE_FILE_NAME_FORMAT = "%s/mmaps/%03i%02i%02i.mmtile";
 
+    static float const PATH_CACHE_GRID_SIZE = 1.0f;
+    static std::size_t const MAX_PREFETCHED_TILES = 64;
+
+    // dtNavMeshQuery keeps its search state inside the object, so every thread gets its own one per map
+    // instead of all instances of a map sharing one that map update threads would race on
+    struct ThreadNavMeshQuery
+    {
+        uint32 meshSerial = 0;
+        dtNavMeshQuery* query = nullptr;
+    };
+
+    struct ThreadNavMeshQueryPool
+    {
+        ~ThreadNavMeshQueryPool()
+        {
+            for (auto& itr : queries)
+            {
+                dtFreeNavMeshQuery(itr.second.query);
+            }
+        }
+
+        std::unordered_map<uint32, ThreadNavMeshQuery> queries; // mapId to query
+    };
+
+    static thread_local ThreadNavMeshQueryPool threadNavMeshQueries;
+
+    static void QuantizePathPoint(float const* point, int32* out)
+    {
+        for (uint8 i = 0; i < 3; ++i)
+        {
+            out[i] = int32(std::floor(point[i] / PATH_CACHE_GRID_SIZE));
+        }
+    }
+
+    static PathCacheKey MakePathCacheKey(uint32 mapId, uint32 instanceId, float const* startPos, float const* endPos, dtQueryFilter const& filter)
+    {
+        PathCacheKey key;
+        key.mapId = mapId;
+        key.instanceId = instanceId;
+        QuantizePathPoint(startPos, key.start);
+        QuantizePathPoint(endPos, key.end);
+        key.includeFlags = filter.getIncludeFlags();
+        key.excludeFlags = filter.getExcludeFlags();
+        return key;
+    }
+
+    struct MappedTile
+    {
+        boost::iostreams::mapped_file file;
+    };
+
+    MMapData::MMapData(dtNavMesh* mesh, uint32 serial) : navMesh(mesh), meshSerial(serial), tileGeneration(serial) { }
+
+    MMapData::~MMapData()
+    {
+        // tiles still in the mesh may point into mappedTiles, which are only released after this
+        if (navMesh)
+        {
+            dtFreeNavMesh(navMesh);
+        }
+    }
+
+    PrefetchedTile::PrefetchedTile() : data(nullptr), size(0) { }
+
+    PrefetchedTile::PrefetchedTile(PrefetchedTile&& right) noexcept : data(right.data), size(right.size), mapping(std::move(right.mapping))
+    {
+        right.data = nullptr;
+    }
+
+    PrefetchedTile& PrefetchedTile::operator=(PrefetchedTile&& right) noexcept
+    {
+        if (this != &right)
+        {
+            if (data && !mapping)
+            {
+                dtFree(data);
+            }
+
+            data = right.data;
+            size = right.size;
+            mapping = std::move(right.mapping);
+            right.data = nullptr;
+        }
+
+        return *this;
+    }
+
+    PrefetchedTile::~PrefetchedTile()
+    {
+        // heap tiles are owned until they are handed to the navMesh
+        if (data && !mapping)
+        {
+            dtFree(data);
+        }
+    }
+
+    bool PathCacheKey::operator==(PathCacheKey const& right) const
+    {
+        return mapId == right.mapId && instanceId == right.instanceId &&
+            start[0] == right.start[0] && start[1] == right.start[1] && start[2] == right.start[2] &&
+            end[0] == right.end[0] && end[1] == right.end[1] && end[2] == right.end[2] &&
+            includeFlags == right.includeFlags && excludeFlags == right.excludeFlags;
+    }
+
+    std::size_t PathCacheKeyHash::operator()(PathCacheKey const& key) const
+    {
+        std::size_t hash = std::hash<uint32>()(key.mapId);
+        auto combine = [&hash](std::size_t value) { hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2); };
+
+        combine(key.instanceId);
+        for (uint8 i = 0; i < 3; ++i)
+        {
+            combine(std::hash<int32>()(key.start[i]));
+            combine(std::hash<int32>()(key.end[i]));
+        }
+
+        combine((uint32(key.includeFlags) << 16) | key.excludeFlags);
+        return hash;
+    }
+
     // ######################## MMapMgr ########################
     MMapMgr::~MMapMgr()
     {
@@ -115,7 +238,7 @@ namespace MMAP
         LOG_DEBUG("maps", "MMAP:loadMapData: Loaded {:03}.mmap", mapId);
 
         // store inside our map list
-        MMapData* mmap_data = new MMapData(mesh);
+        MMapData* mmap_data = new MMapData(mesh, ++meshGeneration);
         itr->second = mmap_data;
         return true;
     }
@@ -145,12 +268,58 @@ namespace MMAP
             return false;
         }
 
+        PrefetchedTile tile;
+        if (takePrefetchedTile(mapId, x, y, tile))
+        {
+            ++prefetchHits;
+        }
+        else if (readTile(mapId, x, y, tile))
+        {
+            ++prefetchMisses;
+        }
+        else
+        {
+            return false;
+        }
+
+        unsigned char* data = tile.data;
+        dtTileRef tileRef = 0;
+
+        // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
+        // mapped tiles stay owned by us, detour only patches the links of the private copy-on-write pages
+        if (dtStatusSucceed(mmap->navMesh->addTile(data, tile.size, tile.mapping ? 0 : DT_TILE_FREE_DATA, 0, &tileRef)))
+        {
+            tile.data = nullptr;
+            if (tile.mapping)
+            {
+                mmap->mappedTiles[packedGridPos] = std::move(tile.mapping);
+            }
+
+            mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
+            mmap->tileGeneration = ++meshGeneration;
+            ++loadedTiles;
+            dtMeshHeader* header = (dtMeshHeader*)data;
+            LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:03}[{:02},{:02}] into {:03}[{:02},{:02}]", mapId, x, y, mapId, header->x, header->y);
+            return true;
+        }
+
+        LOG_ERROR("maps", "MMAP:loadMap: Could not load {:03}{:02}{:02}.mmtile into navmesh", mapId, x, y);
+        return false;
+    }
+
+    bool MMapMgr::readTile(uint32 mapId, int32 x, int32 y, PrefetchedTile& tile) const
+    {
+        if (memoryMappedTiles)
+        {
+            return mapTile(mapId, x, y, tile);
+        }
+
         // load this tile :: mmaps/MMMXXYY.mmtile
         std::string fileName = Acore::StringFormat(TILE_FILE_NAME_FORMAT, sConfigMgr->GetOption<std::string>("DataDir", ".").c_str(), mapId, x, y);
         FILE* file = fopen(fileName.c_str(), "rb");
         if (!file)
         {
-            LOG_DEBUG("maps", "MMAP:loadMap: Could not open mmtile file '{}'", fileName);
+            LOG_DEBUG("maps", "MMAP:readTile: Could not open mmtile file '{}'", fileName);
             return false;
         }
 
@@ -158,14 +327,14 @@ namespace MMAP
         MmapTileHeader fileHeader;
         if (fread(&fileHeader, sizeof(MmapTileHeader), 1, file) != 1 || fileHeader.mmapMagic != MMAP_MAGIC)
         {
-            LOG_ERROR("maps", "MMAP:loadMap: Bad header in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+            LOG_ERROR("maps", "MMAP:readTile: Bad header in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
             fclose(file);
             return false;
         }
 
         if (fileHeader.mmapVersion != MMAP_VERSION)
         {
-            LOG_ERROR("maps", "MMAP:loadMap: {:03}{:02}{:02}.mmtile was built with generator v{}, expected v{}",
+            LOG_ERROR("maps", "MMAP:readTile: {:03}{:02}{:02}.mmtile was built with generator v{}, expected v{}",
                            mapId, x, y, fileHeader.mmapVersion, MMAP_VERSION);
             fclose(file);
             return false;
@@ -175,30 +344,132 @@ namespace MMAP
         ASSERT(data);
 
         size_t result = fread(data, fileHeader.size, 1, file);
+        fclose(file);
+
         if (!result)
         {
-            LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
-            fclose(file);
+            LOG_ERROR("maps", "MMAP:readTile: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+            dtFree(data);
             return false;
         }
 
-        fclose(file);
+        tile.data = data;
+        tile.size = fileHeader.size;
+        return true;
+    }
 
-        dtTileRef tileRef = 0;
+    bool MMapMgr::mapTile(uint32 mapId, int32 x, int32 y, PrefetchedTile& tile) const
+    {
+        std::string fileName = Acore::StringFormat(TILE_FILE_NAME_FORMAT, sConfigMgr->GetOption<std::string>("DataDir", ".").c_str(), mapId, x, y);
 
-        // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
+        std::unique_ptr<MappedTile> mapping = std::make_unique<MappedTile>();
+        try
         {
-            mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
-            ++loadedTiles;
-            dtMeshHeader* header = (dtMeshHeader*)data;
-            LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:03}[{:02},{:02}] into {:03}[{:02},{:02}]", mapId, x, y, mapId, header->x, header->y);
+            // private mapping: pages stay shared through the page cache with every other process mapping the file
+            // until detour writes the links into them, the written pages are then copied for this process only
+            boost::iostreams::mapped_file_params params(fileName);
+            params.flags = boost::iostreams::mapped_file::priv;
+            mapping->file.open(params);
+        }
+        catch (std::exception const& e)
+        {
+            LOG_DEBUG("maps", "MMAP:mapTile: Could not map mmtile file '{}': {}", fileName, e.what());
+            return false;
+        }
+
+        if (mapping->file.size() < sizeof(MmapTileHeader))
+        {
+            LOG_ERROR("maps", "MMAP:mapTile: Bad header in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+            return false;
+        }
+
+        MmapTileHeader fileHeader;
+        memcpy(&fileHeader, mapping->file.const_data(), sizeof(MmapTileHeader));
+        if (fileHeader.mmapMagic != MMAP_MAGIC)
+        {
+            LOG_ERROR("maps", "MMAP:mapTile: Bad header in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+            return false;
+        }
+
+        if (fileHeader.mmapVersion != MMAP_VERSION)
+        {
+            LOG_ERROR("maps", "MMAP:mapTile: {:03}{:02}{:02}.mmtile was built with generator v{}, expected v{}",
+                           mapId, x, y, fileHeader.mmapVersion, MMAP_VERSION);
+            return false;
+        }
+
+        if (mapping->file.size() - sizeof(MmapTileHeader) < fileHeader.size)
+        {
+            LOG_ERROR("maps", "MMAP:mapTile: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+            return false;
+        }
+
+        tile.data = reinterpret_cast<unsigned char*>(mapping->file.data()) + sizeof(MmapTileHeader);
+        tile.size = fileHeader.size;
+        tile.mapping = std::move(mapping);
+        return true;
+    }
+
+    bool MMapMgr::prefetchTile(uint32 mapId, int32 x, int32 y)
+    {
+        uint64 key = (uint64(mapId) << 32) | packTileID(x, y);
+        {
+            std::lock_guard<std::mutex> guard(prefetchLock);
+            if (prefetchedTiles.find(key) != prefetchedTiles.end())
+            {
+                return true;
+            }
+        }
+
+        PrefetchedTile tile;
+        if (!readTile(mapId, x, y, tile))
+        {
+            return false;
+        }
+
+        if (tile.mapping)
+        {
+            // fault the pages in now, so the grid load does not wait for the disk
+            volatile unsigned char touch = 0;
+            for (uint32 offset = 0; offset < tile.size; offset += 4096)
+            {
+                touch = touch + tile.data[offset];
+            }
+        }
+
+        std::lock_guard<std::mutex> guard(prefetchLock);
+        if (!prefetchedTiles.emplace(key, std::move(tile)).second)
+        {
+            // another thread was faster
             return true;
         }
 
-        LOG_ERROR("maps", "MMAP:loadMap: Could not load {:03}{:02}{:02}.mmtile into navmesh", mapId, x, y);
-        dtFree(data);
-        return false;
+        prefetchOrder.push_back(key);
+        while (prefetchOrder.size() > MAX_PREFETCHED_TILES)
+        {
+            prefetchedTiles.erase(prefetchOrder.front());
+            prefetchOrder.pop_front();
+        }
+
+        LOG_DEBUG("maps", "MMAP:prefetchTile: Read mmtile {:03}[{:02},{:02}] ahead of grid load", mapId, x, y);
+        return true;
+    }
+
+    bool MMapMgr::takePrefetchedTile(uint32 mapId, int32 x, int32 y, PrefetchedTile& tile)
+    {
+        uint64 key = (uint64(mapId) << 32) | packTileID(x, y);
+
+        std::lock_guard<std::mutex> guard(prefetchLock);
+        PrefetchedTileMap::iterator itr = prefetchedTiles.find(key);
+        if (itr == prefetchedTiles.end())
+        {
+            return false;
+        }
+
+        tile = std::move(itr->second);
+        prefetchedTiles.erase(itr);
+        prefetchOrder.erase(std::find(prefetchOrder.begin(), prefetchOrder.end(), key));
+        return true;
     }
 
     bool MMapMgr::unloadMap(uint32 mapId, int32 x, int32 y)
@@ -236,6 +507,8 @@ namespace MMAP
         }
 
         mmap->loadedTileRefs.erase(packedGridPos);
+        mmap->mappedTiles.erase(packedGridPos);
+        mmap->tileGeneration = ++meshGeneration;
         --loadedTiles;
         LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:03}[{:02},{:02}] from {:03}", mapId, x, y, mapId);
         return true;
@@ -271,6 +544,7 @@ namespace MMAP
 
         delete mmap;
         itr->second = nullptr;
+        purgePathCache(mapId, 0);
         LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded {:03}.mmap", mapId);
 
         return true;
@@ -287,17 +561,8 @@ namespace MMAP
             return false;
         }
 
-        MMapData* mmap = itr->second;
-        if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
-        {
-            LOG_DEBUG("maps", "MMAP:unloadMapInstance: Asked to unload not loaded dtNavMeshQuery mapId {:03} instanceId {}", mapId, instanceId);
-            return false;
-        }
-
-        dtNavMeshQuery* query = mmap->navMeshQueries[instanceId];
-
-        dtFreeNavMeshQuery(query);
-        mmap->navMeshQueries.erase(instanceId);
+        // queries are owned by threads, only the cached paths of this instance are left to drop
+        purgePathCache(mapId, instanceId);
         LOG_DEBUG("maps", "MMAP:unloadMapInstance: Unloaded mapId {:03} instanceId {}", mapId, instanceId);
 
         return true;
@@ -314,7 +579,7 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
-    dtNavMeshQuery const* MMapMgr::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
+    dtNavMeshQuery const* MMapMgr::GetNavMeshQuery(uint32 mapId)
     {
         MMapDataSet::const_iterator itr = GetMMapData(mapId);
         if (itr == loadedMMaps.end())
@@ -323,27 +588,149 @@ namespace MMAP
         }
 
         MMapData* mmap = itr->second;
-        if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
+        ThreadNavMeshQuery& threadQuery = threadNavMeshQueries.queries[mapId];
+        if (threadQuery.query && threadQuery.meshSerial == mmap->meshSerial)
+        {
+            return threadQuery.query;
+        }
+
+        if (!threadQuery.query)
+        {
+            // allocate mesh query
+            threadQuery.query = dtAllocNavMeshQuery();
+            ASSERT(threadQuery.query);
+        }
+
+        // a reused query only has to be bound to the new navMesh, its node pools are kept
+        if (dtStatusFailed(threadQuery.query->init(mmap->navMesh, 1024)))
         {
-            // check again after acquiring mutex
-            if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
+            threadQuery.meshSerial = 0;
+            LOG_ERROR("maps", "MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId {:03}", mapId);
+            return nullptr;
+        }
+
+        threadQuery.meshSerial = mmap->meshSerial;
+        LOG_DEBUG("maps", "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId {:03}", mapId);
+        return threadQuery.query;
+    }
+
+    bool MMapMgr::GetCachedPath(uint32 mapId, uint32 instanceId, float const* startPos, float const* endPos, dtQueryFilter const& filter,
+        dtPolyRef startPoly, dtPolyRef endPoly, dtPolyRef* path, uint32* pathLength, uint32 maxPathLength)
+    {
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end())
+        {
+            return false;
+        }
+
+        uint32 tileGeneration = itr->second->tileGeneration;
+        PathCacheKey key = MakePathCacheKey(mapId, instanceId, startPos, endPos, filter);
+
+        std::lock_guard<std::mutex> guard(pathCacheLock);
+        PathCacheIndex::iterator found = pathCacheIndex.find(key);
+        if (found == pathCacheIndex.end())
+        {
+            ++pathCacheMisses;
+            return false;
+        }
+
+        PathCacheEntry const& entry = *found->second;
+        if (entry.tileGeneration != tileGeneration)
+        {
+            // tiles were loaded or unloaded since, the poly refs may point to removed polygons
+            pathCacheEntries.erase(found->second);
+            pathCacheIndex.erase(found);
+            ++pathCacheMisses;
+            return false;
+        }
+
+        // quantized positions may fall onto a neighbour polygon, the path is only valid for the same endpoints
+        if (entry.startPoly != startPoly || entry.endPoly != endPoly || entry.path.size() > maxPathLength)
+        {
+            ++pathCacheMisses;
+            return false;
+        }
+
+        std::copy(entry.path.begin(), entry.path.end(), path);
+        *pathLength = uint32(entry.path.size());
+        pathCacheEntries.splice(pathCacheEntries.begin(), pathCacheEntries, found->second);
+        ++pathCacheHits;
+        return true;
+    }
+
+    void MMapMgr::CachePath(uint32 mapId, uint32 instanceId, float const* startPos, float const* endPos, dtQueryFilter const& filter,
+        dtPolyRef startPoly, dtPolyRef endPoly, dtPolyRef const* path, uint32 pathLength)
+    {
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end() || !pathLength)
+        {
+            return;
+        }
+
+        PathCacheEntry entry;
+        entry.key = MakePathCacheKey(mapId, instanceId, startPos, endPos, filter);
+        entry.tileGeneration = itr->second->tileGeneration;
+        entry.startPoly = startPoly;
+        entry.endPoly = endPoly;
+        entry.path.assign(path, path + pathLength);
+
+        std::lock_guard<std::mutex> guard(pathCacheLock);
+        if (!pathCacheSize)
+        {
+            return;
+        }
+
+        PathCacheIndex::iterator found = pathCacheIndex.find(entry.key);
+        if (found != pathCacheIndex.end())
+        {
+            *found->second = std::move(entry);
+            pathCacheEntries.splice(pathCacheEntries.begin(), pathCacheEntries, found->second);
+            return;
+        }
+
+        while (pathCacheIndex.size() >= pathCacheSize)
+        {
+            pathCacheIndex.erase(pathCacheEntries.back().key);
+            pathCacheEntries.pop_back();
+        }
+
+        pathCacheEntries.push_front(std::move(entry));
+        pathCacheIndex.emplace(pathCacheEntries.front().key, pathCacheEntries.begin());
+    }
+
+    void MMapMgr::SetPathCacheSize(uint32 size)
+    {
+        std::lock_guard<std::mutex> guard(pathCacheLock);
+        pathCacheSize = size;
+
+        while (pathCacheIndex.size() > pathCacheSize)
+        {
+            pathCacheIndex.erase(pathCacheEntries.back().key);
+            pathCacheEntries.pop_back();
+        }
+    }
+
+    uint32 MMapMgr::getPathCacheCount() const
+    {
+        std::lock_guard<std::mutex> guard(pathCacheLock);
+        return uint32(pathCacheIndex.size());
+    }
+
+    void MMapMgr::purgePathCache(uint32 mapId, uint32 instanceId)
+    {
+        // instanceId 0 drops the paths of every instance of the map
+        std::lock_guard<std::mutex> guard(pathCacheLock);
+        for (PathCacheList::iterator itr = pathCacheEntries.begin(); itr != pathCacheEntries.end();)
+        {
+            if (itr->key.mapId == mapId && (!instanceId || itr->key.instanceId == instanceId))
             {
-                // allocate mesh query
-                dtNavMeshQuery* query = dtAllocNavMeshQuery();
-                ASSERT(query);
-
-                if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
-                {
-                    dtFreeNavMeshQuery(query);
-                    LOG_ERROR("maps", "MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId {:03} instanceId {}", mapId, instanceId);
-                    return nullptr;
-                }
-
-                LOG_DEBUG("maps", "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId {:03} instanceId {}", mapId, instanceId);
-                mmap->navMeshQueries.insert(std::pair<uint32, dtNavMeshQuery*>(instanceId, query));
+                pathCacheIndex.erase(itr->key);
+                itr = pathCacheEntries.erase(itr);
+            }
+            else
+            {
+                ++itr;
             }
         }
-
-        return mmap->navMeshQueries[instanceId];
     }
 }
@@ -22,6 +22,11 @@
 #include "DetourAlloc.h"
 #include "DetourExtended.h"
 #include "DetourNavMesh.h"
+#include <atomic>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
 #include <vector>
@@ -41,34 +46,71 @@ inline void dtCustomFree(void* ptr)
 namespace MMAP
 {
     typedef std::unordered_map<uint32, dtTileRef> MMapTileSet;
-    typedef std::unordered_map<uint32, dtNavMeshQuery*> NavMeshQuerySet;
+
+    // .mmtile file mapped copy-on-write, see MoveMaps.MemoryMapped
+    struct MappedTile;
+    typedef std::unordered_map<uint32, std::unique_ptr<MappedTile>> MappedTileSet;
 
     // dummy struct to hold map's mmap data
     struct MMapData
     {
-        MMapData(dtNavMesh* mesh) : navMesh(mesh) { }
-
-        ~MMapData()
-        {
-            for (auto& navMeshQuerie : navMeshQueries)
-            {
-                dtFreeNavMeshQuery(navMeshQuerie.second);
-            }
-
-            if (navMesh)
-            {
-                dtFreeNavMesh(navMesh);
-            }
-        }
-
-        // we have to use single dtNavMeshQuery for every instance, since those are not thread safe
-        NavMeshQuerySet navMeshQueries; // instanceId to query
+        MMapData(dtNavMesh* mesh, uint32 serial);
+        ~MMapData();
+
         dtNavMesh* navMesh;
         MMapTileSet loadedTileRefs; // maps [map grid coords] to [dtTile]
+        MappedTileSet mappedTiles; // maps [map grid coords] to the file backing a tile that detour does not own
+        uint32 const meshSerial; // identifies this navMesh, dtNavMeshQuery objects bound to an older one must be reinitialized
+        std::atomic<uint32> tileGeneration; // changes whenever a tile is added or removed, cached poly paths of older generations are stale
     };
 
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
 
+    // poly path cache key, positions are quantized to PATH_CACHE_GRID_SIZE so nearby requests share an entry
+    struct PathCacheKey
+    {
+        uint32 mapId;
+        uint32 instanceId;
+        int32 start[3];
+        int32 end[3];
+        uint16 includeFlags;
+        uint16 excludeFlags;
+
+        bool operator==(PathCacheKey const& right) const;
+    };
+
+    struct PathCacheKeyHash
+    {
+        std::size_t operator()(PathCacheKey const& key) const;
+    };
+
+    struct PathCacheEntry
+    {
+        PathCacheKey key;
+        uint32 tileGeneration;
+        dtPolyRef startPoly;
+        dtPolyRef endPoly;
+        std::vector<dtPolyRef> path;
+    };
+
+    typedef std::list<PathCacheEntry> PathCacheList;
+    typedef std::unordered_map<PathCacheKey, PathCacheList::iterator, PathCacheKeyHash> PathCacheIndex;
+
+    // raw .mmtile contents read ahead of the grid load, ownership passes to the navMesh when the tile is added
+    struct PrefetchedTile
+    {
+        PrefetchedTile();
+        PrefetchedTile(PrefetchedTile&& right) noexcept;
+        PrefetchedTile& operator=(PrefetchedTile&& right) noexcept;
+        ~PrefetchedTile();
+
+        unsigned char* data;
+        uint32 size;
+        std::unique_ptr<MappedTile> mapping; // set when data points into a mapped file instead of the heap
+    };
+
+    typedef std::unordered_map<uint64, PrefetchedTile> PrefetchedTileMap;
+
     // singleton class
     // holds all all access to mmap loading unloading and meshes
     class MMapMgr
@@ -83,21 +125,58 @@ namespace MMAP
         bool unloadMap(uint32 mapId);
         bool unloadMapInstance(uint32 mapId, uint32 instanceId);
 
-        // the returned [dtNavMeshQuery const*] is NOT threadsafe
-        dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
+        // reads a tile from disk without touching the navMesh, safe to call from any thread
+        // a following loadMap for the same tile then only has to add it to the navMesh
+        bool prefetchTile(uint32 mapId, int32 x, int32 y);
+
+        // the returned [dtNavMeshQuery const*] belongs to the calling thread, it must not be handed over to another one
+        dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId);
         dtNavMesh const* GetNavMesh(uint32 mapId);
 
+        // poly path cache shared by all threads, bounded to pathCacheSize entries with least recently used eviction
+        bool GetCachedPath(uint32 mapId, uint32 instanceId, float const* startPos, float const* endPos, dtQueryFilter const& filter,
+            dtPolyRef startPoly, dtPolyRef endPoly, dtPolyRef* path, uint32* pathLength, uint32 maxPathLength);
+        void CachePath(uint32 mapId, uint32 instanceId, float const* startPos, float const* endPos, dtQueryFilter const& filter,
+            dtPolyRef startPoly, dtPolyRef endPoly, dtPolyRef const* path, uint32 pathLength);
+        void SetPathCacheSize(uint32 size);
+        // tiles loaded afterwards are mapped from disk instead of being copied to the heap
+        void SetMemoryMappedTiles(bool enable) { memoryMappedTiles = enable; }
+
         [[nodiscard]] uint32 getLoadedTilesCount() const { return loadedTiles; }
         [[nodiscard]] uint32 getLoadedMapsCount() const { return loadedMMaps.size(); }
+        [[nodiscard]] uint64 getPathCacheHits() const { return pathCacheHits; }
+        [[nodiscard]] uint64 getPathCacheMisses() const { return pathCacheMisses; }
+        [[nodiscard]] uint32 getPathCacheCount() const;
+        [[nodiscard]] uint64 getPrefetchHits() const { return prefetchHits; }
+        [[nodiscard]] uint64 getPrefetchMisses() const { return prefetchMisses; }
 
     private:
         bool loadMapData(uint32 mapId);
         uint32 packTileID(int32 x, int32 y);
         [[nodiscard]] MMapDataSet::const_iterator GetMMapData(uint32 mapId) const;
+        void purgePathCache(uint32 mapId, uint32 instanceId);
+        bool readTile(uint32 mapId, int32 x, int32 y, PrefetchedTile& tile) const;
+        bool mapTile(uint32 mapId, int32 x, int32 y, PrefetchedTile& tile) const;
+        bool takePrefetchedTile(uint32 mapId, int32 x, int32 y, PrefetchedTile& tile);
 
         MMapDataSet loadedMMaps;
         uint32 loadedTiles{0};
         bool thread_safe_environment{true};
+        std::atomic<uint32> meshGeneration{0};
+        std::atomic<bool> memoryMappedTiles{false};
+
+        PathCacheList pathCacheEntries; // most recently used first
+        PathCacheIndex pathCacheIndex;
+        uint32 pathCacheSize{4096};
+        mutable std::mutex pathCacheLock;
+        std::atomic<uint64> pathCacheHits{0};
+        std::atomic<uint64> pathCacheMisses{0};
+
+        PrefetchedTileMap prefetchedTiles;
+        std::deque<uint64> prefetchOrder; // oldest first, unclaimed tiles are dropped once the buffer is full
+        std::mutex prefetchLock;
+        std::atomic<uint64> prefetchHits{0};
+        std::atomic<uint64> prefetchMisses{0};
     };
 }
 
@@ -113,6 +113,16 @@ namespace VMAP
         return result;
     }
 
+    bool VMapMgr2::prefetchMap(const char* basePath, unsigned int mapId, int x, int y)
+    {
+        if (!isMapLoadingEnabled())
+        {
+            return false;
+        }
+
+        return StaticMapTree::PrefetchMapTile(basePath, mapId, x, y, this);
+    }
+
     // load one tile (internal use only)
     bool VMapMgr2::_loadMap(uint32 mapId, const std::string& basePath, uint32 tileX, uint32 tileY)
     {
@@ -339,28 +349,42 @@ namespace VMAP
 
     WorldModel* VMapMgr2::acquireModelInstance(const std::string& basepath, const std::string& filename, uint32 flags/* Only used when creating the model */)
     {
-        //! Critical section, thread safe access to iLoadedModelFiles
-        std::lock_guard<std::mutex> lock(LoadedModelFilesLock);
-
-        ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
-        if (model == iLoadedModelFiles.end())
         {
-            WorldModel* worldmodel = new WorldModel();
-            if (!worldmodel->readFile(basepath + filename + ".vmo"))
+            //! Critical section, thread safe access to iLoadedModelFiles
+            std::lock_guard<std::mutex> lock(LoadedModelFilesLock);
+
+            ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
+            if (model != iLoadedModelFiles.end())
             {
-                LOG_ERROR("maps", "VMapMgr2: could not load '{}{}.vmo'", basepath, filename);
-                delete worldmodel;
-                return nullptr;
+                return model->second.getModel();
             }
-            LOG_DEBUG("maps", "VMapMgr2: loading file '{}{}'", basepath, filename);
+        }
+
+        // read the file without holding the lock, tile prefetching threads would otherwise stall every map loading a model
+        WorldModel* worldmodel = new WorldModel();
+        if (!worldmodel->readFile(basepath + filename + ".vmo"))
+        {
+            LOG_ERROR("maps", "VMapMgr2: could not load '{}{}.vmo'", basepath, filename);
+            delete worldmodel;
+            return nullptr;
+        }
+        LOG_DEBUG("maps", "VMapMgr2: loading file '{}{}'", basepath, filename);
+
+        worldmodel->Flags = flags;
 
-            worldmodel->Flags = flags;
+        std::lock_guard<std::mutex> lock(LoadedModelFilesLock);
 
-            model = iLoadedModelFiles.insert(std::pair<std::string, ManagedModel>(filename, ManagedModel())).first;
-            model->second.setModel(worldmodel);
+        ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
+        if (model != iLoadedModelFiles.end())
+        {
+            // loaded by another thread in the meantime
+            delete worldmodel;
+            return model->second.getModel();
         }
 
-        return model->second.getModel();
+        model = iLoadedModelFiles.insert(std::pair<std::string, ManagedModel>(filename, ManagedModel())).first;
+        model->second.setModel(worldmodel);
+        return worldmodel;
     }
 
     void VMapMgr2::releaseModelInstance(const std::string& filename)
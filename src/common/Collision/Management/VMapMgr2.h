@@ -103,6 +103,8 @@ namespace VMAP
         void InitializeThreadUnsafe(const std::vector<uint32>& mapIds);
 
         int loadMap(const char* pBasePath, unsigned int mapId, int x, int y) override;
+        // loads the model files used by a tile ahead of loadMap(), safe to call from any thread
+        bool prefetchMap(const char* basePath, unsigned int mapId, int x, int y);
 
         void unloadMap(unsigned int mapId, int x, int y) override;
         void unloadMap(unsigned int mapId) override;
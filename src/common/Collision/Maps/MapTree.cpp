@@ -291,6 +291,46 @@ namespace VMAP
 
     //=========================================================
 
+    // reads the model spawns of a tile and loads their model files into the VMapMgr2 cache,
+    // without touching any tree, so that LoadMapTile() finds every model already loaded
+    bool StaticMapTree::PrefetchMapTile(const std::string& basePath, uint32 mapID, uint32 tileX, uint32 tileY, VMapMgr2* vm)
+    {
+        std::string path = basePath;
+        if (path.length() > 0 && path[path.length() - 1] != '/' && path[path.length() - 1] != '\\')
+        {
+            path.push_back('/');
+        }
+
+        std::string tilefile = path + getTileFileName(mapID, tileX, tileY);
+        FILE* tf = fopen(tilefile.c_str(), "rb");
+        if (!tf)
+        {
+            return false;
+        }
+
+        char chunk[8];
+        bool result = readChunk(tf, chunk, VMAP_MAGIC, 8);
+        uint32 numSpawns = 0;
+        if (result && fread(&numSpawns, sizeof(uint32), 1, tf) != 1)
+        {
+            result = false;
+        }
+
+        for (uint32 i = 0; i < numSpawns && result; ++i)
+        {
+            ModelSpawn spawn;
+            uint32 referencedVal;
+            result = ModelSpawn::readFromFile(tf, spawn) && fread(&referencedVal, sizeof(uint32), 1, tf) == 1;
+            if (result)
+            {
+                vm->acquireModelInstance(path, spawn.name, spawn.flags);
+            }
+        }
+
+        fclose(tf);
+        return result;
+    }
+
     bool StaticMapTree::InitMap(const std::string& fname, VMapMgr2* vm)
     {
         //VMAP_DEBUG_LOG(LOG_FILTER_MAPS, "StaticMapTree::InitMap() : initializing StaticMapTree '{}'", fname);
@@ -24,6 +24,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <mutex>
+#include <set>
 #include <unordered_map>
 
 namespace
@@ -35,6 +36,16 @@ namespace
     std::unordered_map<std::string /*name*/, std::string /*value*/> _envVarCache;
     std::mutex _configLock;
 
+    // options the code read that are missing from every loaded file, reported once each
+    std::set<std::string> _missingOptions;
+    std::mutex _missingOptionsLock;
+
+    bool AddMissingOption(std::string const& name)
+    {
+        std::lock_guard<std::mutex> lock(_missingOptionsLock);
+        return _missingOptions.insert(name).second;
+    }
+
     // Check system configs like *server.conf*
     bool IsAppConfig(std::string_view fileName)
     {
@@ -304,6 +315,12 @@ bool ConfigMgr::LoadInitial(std::string const& file, bool isReload /*= false*/)
 {
     std::lock_guard<std::mutex> lock(_configLock);
     _configOptions.clear();
+
+    {
+        std::lock_guard<std::mutex> missingLock(_missingOptionsLock);
+        _missingOptions.clear();
+    }
+
     return LoadFile(file, false, isReload);
 }
 
@@ -404,7 +421,7 @@ T ConfigMgr::GetValueDefault(std::string const& name, T const& def, bool showLog
     }
     else if (notFound)
     {
-        if (showLogs)
+        if (AddMissingOption(name) && showLogs)
         {
             LOG_ERROR("server.loading", "> Config: Missing property {} in config file {}, add \"{} = {}\" to this file or define '{}' as an environment variable.",
                     name, _filename, name, Acore::ToString(def), envVarName);
@@ -451,7 +468,7 @@ std::string ConfigMgr::GetValueDefault<std::string>(std::string const& name, std
     }
     else if (notFound)
     {
-        if (showLogs)
+        if (AddMissingOption(name) && showLogs)
         {
             LOG_ERROR("server.loading", "> Config: Missing property {} in config file {}, add \"{} = {}\" to this file or define '{}' as an environment variable.",
                     name, _filename, name, def, envVarName);
@@ -489,6 +506,12 @@ bool ConfigMgr::GetOption<bool>(std::string const& name, bool const& def, bool s
     return *boolVal;
 }
 
+std::vector<std::string> ConfigMgr::GetMissingOptions() const
+{
+    std::lock_guard<std::mutex> lock(_missingOptionsLock);
+    return { _missingOptions.begin(), _missingOptions.end() };
+}
+
 std::vector<std::string> ConfigMgr::GetKeysByString(std::string const& name)
 {
     std::lock_guard<std::mutex> lock(_configLock);
@@ -46,6 +46,8 @@ public:
     std::string const GetConfigPath();
     [[nodiscard]] std::vector<std::string> const& GetArguments() const;
     std::vector<std::string> GetKeysByString(std::string const& name);
+    /// Options read through GetOption that are not set in any loaded config file, their defaults were used
+    [[nodiscard]] std::vector<std::string> GetMissingOptions() const;
 
     template<class T>
     T GetOption(std::string const& name, T const& def, bool showLogs = true) const;
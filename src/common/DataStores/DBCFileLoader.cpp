@@ -17,6 +17,7 @@
 
 #include "DBCFileLoader.h"
 #include "Errors.h"
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <stdio.h>
 #include <string.h>
 
@@ -24,65 +25,52 @@ DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), s
 
 bool DBCFileLoader::Load(char const* filename, char const* fmt)
 {
-    uint32 header;
-    if (data)
-    {
-        delete [] data;
-        data = nullptr;
-    }
+    data = nullptr;
+    mapping.reset();
 
-    FILE* f = fopen(filename, "rb");
-    if (!f)
+    // the file is mapped copy-on-write instead of read into the heap, pages are shared with the page cache
+    // and records that do not need converting can be used without copying them, see HasStructLayout
+    std::shared_ptr<boost::iostreams::mapped_file> file = std::make_shared<boost::iostreams::mapped_file>();
+    try
     {
-        return false;
+        boost::iostreams::mapped_file_params params(filename);
+        params.flags = boost::iostreams::mapped_file::priv;
+        file->open(params);
     }
-
-    if (fread(&header, 4, 1, f) != 1)                        // Number of records
+    catch (std::exception const& /*e*/)
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(header);
-
-    if (header != 0x43424457)                                //'WDBC'
+    size_t const headerSize = 5 * sizeof(uint32);
+    if (file->size() < headerSize)
     {
-        fclose(f);
         return false;
     }
 
-    if (fread(&recordCount, 4, 1, f) != 1)                   // Number of records
+    uint32 header[5];
+    memcpy(header, file->const_data(), headerSize);
+    for (uint32& field : header)
     {
-        fclose(f);
-        return false;
+        EndianConvert(field);
     }
 
-    EndianConvert(recordCount);
-
-    if (fread(&fieldCount, 4, 1, f) != 1)                    // Number of fields
+    if (header[0] != 0x43424457)                             //'WDBC'
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(fieldCount);
+    recordCount = header[1];                                 // Number of records
+    fieldCount = header[2];                                  // Number of fields
+    recordSize = header[3];                                  // Size of a record
+    stringSize = header[4];                                  // String size
 
-    if (fread(&recordSize, 4, 1, f) != 1)                    // Size of a record
+    if (file->size() - headerSize < size_t(recordSize) * recordCount + stringSize)
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(recordSize);
-
-    if (fread(&stringSize, 4, 1, f) != 1)                    // String size
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(stringSize);
-
+    delete[] fieldsOffset;
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
 
@@ -99,24 +87,15 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
         }
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
+    data = reinterpret_cast<unsigned char*>(file->data()) + headerSize;
     stringTable = data + recordSize * recordCount;
-
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
+    mapping = file;
 
     return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
-
     delete[] fieldsOffset;
 }
 
@@ -274,6 +253,87 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
     return dataTable;
 }
 
+bool DBCFileLoader::HasStructLayout(char const* format) const
+{
+#if ACORE_ENDIAN == ACORE_BIGENDIAN
+    (void)format;
+    return false;
+#else
+    if (strlen(format) != fieldCount)
+    {
+        return false;
+    }
+
+    // pointers to strings, skipped fields and the sort field make the structure differ from the file
+    for (uint32 x = 0; x < fieldCount; ++x)
+    {
+        switch (format[x])
+        {
+            case FT_FLOAT:
+            case FT_IND:
+            case FT_INT:
+            case FT_BYTE:
+                break;
+            default:
+                return false;
+        }
+    }
+
+    return GetFormatRecordSize(format) == recordSize;
+#endif
+}
+
+char* DBCFileLoader::AutoProduceDataInPlace(char const* format, uint32& records, char**& indexTable)
+{
+    typedef char* ptr;
+    if (!HasStructLayout(format))
+    {
+        return nullptr;
+    }
+
+    int32 i;
+    GetFormatRecordSize(format, &i);
+
+    if (i >= 0)
+    {
+        uint32 maxi = 0;
+        //find max index
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            uint32 ind = getRecord(y).getUInt(i);
+            if (ind > maxi)
+            {
+                maxi = ind;
+            }
+        }
+
+        ++maxi;
+        records = maxi;
+        indexTable = new ptr[maxi];
+        memset(indexTable, 0, maxi * sizeof(ptr));
+    }
+    else
+    {
+        records = recordCount;
+        indexTable = new ptr[recordCount];
+    }
+
+    for (uint32 y = 0; y < recordCount; ++y)
+    {
+        char* record = reinterpret_cast<char*>(data + y * recordSize);
+        if (i >= 0)
+        {
+            indexTable[getRecord(y).getUInt(i)] = record;
+        }
+        else
+        {
+            indexTable[y] = record;
+        }
+    }
+
+    return reinterpret_cast<char*>(data);
+}
+
 char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
 {
     if (strlen(format) != fieldCount)
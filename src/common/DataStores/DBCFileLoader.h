@@ -21,6 +21,7 @@
 #include "Define.h"
 #include "Errors.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
 
 enum DbcFieldFormat
 {
@@ -93,9 +94,16 @@ public:
     [[nodiscard]] uint32 GetOffset(size_t id) const { return (fieldsOffset != nullptr && id < fieldCount) ? fieldsOffset[id] : 0; }
     [[nodiscard]] bool IsLoaded() const { return data != nullptr; }
     char* AutoProduceData(char const* fmt, uint32& count, char**& indexTable);
+    // builds only the index table, pointing straight at the records of the mapped file, see HasStructLayout
+    char* AutoProduceDataInPlace(char const* fmt, uint32& count, char**& indexTable);
     char* AutoProduceStrings(char const* fmt, char* dataTable);
     static uint32 GetFormatRecordSize(const char* format, int32* index_pos = nullptr);
 
+    // true when every record of the file is laid out exactly like the structure described by fmt
+    [[nodiscard]] bool HasStructLayout(char const* fmt) const;
+    // keeps the file mapped, records produced in place stay valid as long as it is held
+    [[nodiscard]] std::shared_ptr<void> const& GetMapping() const { return mapping; }
+
 private:
     uint32 recordSize;
     uint32 recordCount;
@@ -104,6 +112,7 @@ private:
     uint32* fieldsOffset;
     unsigned char* data;
     unsigned char* stringTable;
+    std::shared_ptr<void> mapping;
 
     DBCFileLoader(DBCFileLoader const& right) = delete;
     DBCFileLoader& operator=(DBCFileLoader const& right) = delete;
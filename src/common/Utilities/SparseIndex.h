@@ -0,0 +1,149 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SPARSE_INDEX_H
+#define _SPARSE_INDEX_H
+
+#include "Define.h"
+#include <iterator>
+#include <vector>
+
+/**
+    @class SparseIndex
+
+    @brief Maps ids to pointers like a plain array indexed by id, without storing the gaps.
+
+    Ids are split into pages of 2^PageBits entries and only pages holding at least one entry are
+    allocated, back to back in a single vector. Pages without entries all refer to one shared page
+    of nullptrs, so a lookup is always one bounds check and two loads.
+*/
+template<typename T, uint32 PageBits = 8>
+class SparseIndex
+{
+public:
+    static constexpr uint32 PAGE_SIZE = 1 << PageBits;
+    static constexpr uint32 PAGE_MASK = PAGE_SIZE - 1;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T* const*;
+        using reference = T*;
+
+        const_iterator(SparseIndex const* index, uint32 id) : _index(index), _id(index->FindNext(id)) { }
+
+        T* operator*() const { return (*_index)[_id]; }
+        [[nodiscard]] uint32 GetId() const { return _id; }
+
+        const_iterator& operator++() { _id = _index->FindNext(_id + 1); return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++*this; return tmp; }
+
+        bool operator==(const_iterator const& right) const { return _id == right._id; }
+        bool operator!=(const_iterator const& right) const { return _id != right._id; }
+
+    private:
+        SparseIndex const* _index;
+        uint32 _id;
+    };
+
+    SparseIndex() { clear(); }
+
+    T* operator[](uint32 id) const
+    {
+        return id < _size ? _entries[_pages[id >> PageBits] + (id & PAGE_MASK)] : nullptr;
+    }
+
+    // grows the index when needed, storing nullptr never allocates a page
+    void Set(uint32 id, T* value)
+    {
+        if (id >= _size)
+        {
+            if (!value)
+                return;
+
+            Resize(id + 1);
+        }
+
+        uint32& page = _pages[id >> PageBits];
+        if (!page)
+        {
+            if (!value)
+                return;
+
+            page = uint32(_entries.size());
+            _entries.resize(_entries.size() + PAGE_SIZE, nullptr);
+        }
+
+        _entries[page + (id & PAGE_MASK)] = value;
+    }
+
+    // ids below size are valid to look up, like the size of the plain array this replaces; never shrinks
+    void Resize(uint32 size)
+    {
+        if (size <= _size)
+            return;
+
+        _size = size;
+        _pages.resize((size + PAGE_MASK) >> PageBits, 0);
+    }
+
+    void clear()
+    {
+        _size = 0;
+        _pages.clear();
+        _entries.assign(PAGE_SIZE, nullptr);    // the shared empty page
+    }
+
+    [[nodiscard]] uint32 size() const { return _size; }
+
+    // first id >= id with an entry, size() when there is none, skipping empty pages as a whole
+    [[nodiscard]] uint32 FindNext(uint32 id) const
+    {
+        while (id < _size)
+        {
+            uint32 page = _pages[id >> PageBits];
+            if (!page)
+            {
+                id = (id | PAGE_MASK) + 1;
+                continue;
+            }
+
+            if (_entries[page + (id & PAGE_MASK)])
+                return id;
+
+            ++id;
+        }
+
+        return _size;
+    }
+
+    // entries in id order, nullptrs are skipped
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, _size); }
+
+    [[nodiscard]] std::size_t GetMemoryUsage() const { return _pages.capacity() * sizeof(uint32) + _entries.capacity() * sizeof(T*); }
+
+private:
+    std::vector<uint32> _pages;                     // offset of each page in _entries, 0 is the shared empty page
+    std::vector<T*> _entries;
+    uint32 _size;
+};
+
+#endif
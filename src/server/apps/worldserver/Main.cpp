@@ -30,10 +30,12 @@
 #include "Common.h"
 #include "Config.h"
 #include "DatabaseEnv.h"
+#include "DBUpdater.h"
 #include "DatabaseLoader.h"
 #include "DeadlineTimer.h"
 #include "GitRevision.h"
 #include "IoContext.h"
+#include "MMapFactory.h"
 #include "MapMgr.h"
 #include "Metric.h"
 #include "ModuleMgr.h"
@@ -41,7 +43,9 @@
 #include "MySQLThreading.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvPMgr.h"
+#include "Player.h"
 #include "ProcessPriority.h"
+#include "QuerySnapshot.h"
 #include "RASession.h"
 #include "RealmList.h"
 #include "Resolver.h"
@@ -291,6 +295,22 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+
+        std::vector<DatabaseShardStats> characterShards = CharacterDatabase.GetShardStats();
+        for (size_t i = 0; i < characterShards.size(); ++i)
+        {
+            METRIC_VALUE("db_shard_queue_character", uint64(characterShards[i].QueueSize), METRIC_TAG("shard", std::to_string(i)));
+            METRIC_VALUE("db_shard_latency_character", characterShards[i].AverageLatency, METRIC_TAG("shard", std::to_string(i)));
+        }
+
+        MMAP::MMapMgr* mmap = MMAP::MMapFactory::createOrGetMMapMgr();
+        METRIC_VALUE("mmap_path_cache_hits", mmap->getPathCacheHits());
+        METRIC_VALUE("mmap_path_cache_misses", mmap->getPathCacheMisses());
+        METRIC_VALUE("mmap_path_cache_size", mmap->getPathCacheCount());
+        METRIC_VALUE("mmap_prefetch_hits", mmap->getPrefetchHits());
+        METRIC_VALUE("mmap_prefetch_misses", mmap->getPrefetchMisses());
+
+        Player::LogSaveMetrics();
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
@@ -482,6 +502,11 @@ bool StartDB()
 
     LOG_INFO("server.loading", "> Version DB world:     {}", sWorld->GetDBVersion());
 
+    ///- Serve startup loaders from world database snapshots written for the same applied updates
+    std::string snapshotDirectory = sConfigMgr->GetOption<std::string>("WorldDatabase.Snapshot.Directory", "");
+    if (!snapshotDirectory.empty())
+        sWorldDatabaseSnapshot->Initialize(snapshotDirectory, DBUpdater<WorldDatabaseConnection>::GetAppliedUpdatesHash(WorldDatabase));
+
     sScriptMgr->OnAfterDatabasesLoaded(loader.GetUpdateFlags());
 
     return true;
@@ -489,6 +514,8 @@ bool StartDB()
 
 void StopDB()
 {
+    sWorldDatabaseSnapshot->WaitForRebuild();
+
     CharacterDatabase.Close();
     WorldDatabase.Close();
     LoginDatabase.Close();
@@ -25,6 +25,7 @@ BasicStatementTask::BasicStatementTask(std::string_view sql, bool async) : m_res
 {
     m_sql = std::string(sql);
     m_has_result = async; // If the operation is async, then there's a result
+    m_batchable = !async && !MySQLConnection::CausesImplicitCommit(m_sql);
 
     if (async)
         m_result = new QueryResultPromise();
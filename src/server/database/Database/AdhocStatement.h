@@ -30,11 +30,13 @@ public:
     ~BasicStatementTask();
 
     bool Execute() override;
+    [[nodiscard]] bool IsBatchable() const override { return m_batchable; }
     QueryResultFuture GetFuture() const { return m_result->get_future(); }
 
 private:
     std::string m_sql; //- Raw query to be executed
     bool m_has_result;
+    bool m_batchable;
     QueryResultPromise* m_result;
 };
 
@@ -54,8 +54,9 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
         }
 
         uint8 const synchThreads = sConfigMgr->GetOption<uint8>(name + "Database.SynchThreads", 1);
+        uint8 const batchSize = sConfigMgr->GetOption<uint8>("Database.BatchSize", 16);
 
-        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads, batchSize);
 
         if (uint32 error = pool.Open())
         {
@@ -16,14 +16,17 @@
  */
 
 #include "DatabaseWorker.h"
-#include "PCQueue.h"
+#include "Log.h"
+#include "MySQLConnection.h"
 #include "SQLOperation.h"
+#include "Timer.h"
 
-DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection)
+DatabaseWorker::DatabaseWorker(DatabaseWorkerShard* shard, MySQLConnection* connection)
 {
     _connection = connection;
-    _queue = newQueue;
+    _shard = shard;
     _cancelationToken = false;
+    _batch.reserve(_shard ? _shard->BatchSize : 0);
     _workerThread = std::thread(&DatabaseWorker::WorkerThread, this);
 }
 
@@ -31,28 +34,108 @@ DatabaseWorker::~DatabaseWorker()
 {
     _cancelationToken = true;
 
-    _queue->Cancel();
+    _shard->Queue.Cancel();
 
     _workerThread.join();
 }
 
 void DatabaseWorker::WorkerThread()
 {
-    if (!_queue)
+    if (!_shard)
         return;
 
     for (;;)
     {
         SQLOperation* operation = nullptr;
 
-        _queue->WaitAndPop(operation);
+        _shard->Queue.WaitAndPop(operation);
 
         if (_cancelationToken || !operation)
             return;
 
+        //! Prepared statements look up on the connection whether they can be batched
         operation->SetConnection(_connection);
+
+        if (_shard->BatchSize > 1 && operation->IsBatchable())
+        {
+            //! Collect the one-way statements already waiting behind this one, stop at the first operation that has to run alone
+            _batch.push_back(operation);
+            operation = nullptr;
+
+            while (_batch.size() < _shard->BatchSize && _shard->Queue.Pop(operation))
+            {
+                operation->SetConnection(_connection);
+
+                if (!operation->IsBatchable())
+                    break;
+
+                _batch.push_back(operation);
+                operation = nullptr;
+            }
+
+            ExecuteBatch();
+
+            if (!operation)
+                continue;
+        }
+
         operation->call();
 
-        delete operation;
+        Finish(operation);
+    }
+}
+
+void DatabaseWorker::ExecuteBatch()
+{
+    if (_batch.size() == 1)
+        _batch.front()->call();
+    else
+    {
+        //! One commit for the whole group instead of one per statement
+        bool failed = false;
+
+        _connection->BeginTransaction();
+
+        for (SQLOperation* operation : _batch)
+        {
+            if (!operation->Execute())
+            {
+                failed = true;
+                break;
+            }
+        }
+
+        if (!failed && _connection->CommitTransaction())
+            ++_shard->Batches;
+        else if (!failed && _connection->IsTransactionLost())
+        {
+            //! The connection went away on COMMIT, the server may have applied the group before it did.
+            //! Replaying would run the statements twice in that case, so they are dropped and reported instead.
+            LOG_ERROR("sql.sql", "Connection lost on COMMIT of a batch of {} statements, they may not have been applied and are not executed again.", _batch.size());
+        }
+        else
+        {
+            //! A failing statement must not take the others down with it, replay them one by one.
+            //! This also covers a connection lost inside the group: the server rolled back the statements
+            //! already sent, and none of them was retried on its own after the reconnect.
+            _connection->RollbackTransaction();
+
+            for (SQLOperation* operation : _batch)
+                operation->call();
+        }
     }
+
+    for (SQLOperation* operation : _batch)
+        Finish(operation);
+
+    _batch.clear();
+}
+
+void DatabaseWorker::Finish(SQLOperation* operation)
+{
+    _shard->TotalLatency += getMSTimeDiff(operation->m_queuedTime, getMSTime());
+    ++_shard->Completed;
+    --_shard->Pending;
+
+    delete operation;
 }
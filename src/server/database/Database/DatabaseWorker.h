@@ -19,30 +19,50 @@
 #define _WORKERTHREAD_H
 
 #include "Define.h"
+#include "PCQueue.h"
 #include <atomic>
 #include <thread>
-
-template <typename T>
-class ProducerConsumerQueue;
+#include <vector>
 
 class MySQLConnection;
 class SQLOperation;
 
+//! Queue of a single asynchronous connection, plus the counters exposed through DatabaseWorkerPool::GetShardStats.
+//! Operations enqueued with the same shard key always land on the same shard, so they run in order.
+struct DatabaseWorkerShard
+{
+    explicit DatabaseWorkerShard(uint8 batchSize) : BatchSize(batchSize) { }
+
+    ProducerConsumerQueue<SQLOperation*> Queue;
+
+    std::atomic<uint32> Pending{0};      //! Enqueued and not finished yet
+    std::atomic<uint64> Completed{0};    //! Finished operations
+    std::atomic<uint64> TotalLatency{0}; //! Sum of enqueue to completion time of finished operations, in ms
+    std::atomic<uint64> Batches{0};      //! Groups of one-way statements committed as a single transaction
+
+    //! Max number of consecutive one-way statements executed in one transaction, 1 disables batching
+    uint8 const BatchSize;
+};
+
 class AC_DATABASE_API DatabaseWorker
 {
 public:
-    DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection);
+    DatabaseWorker(DatabaseWorkerShard* shard, MySQLConnection* connection);
     ~DatabaseWorker();
 
 private:
-    ProducerConsumerQueue<SQLOperation*>* _queue;
+    DatabaseWorkerShard* _shard;
     MySQLConnection* _connection;
 
     void WorkerThread();
+    void ExecuteBatch();
+    void Finish(SQLOperation* operation);
     std::thread _workerThread;
 
     std::atomic<bool> _cancelationToken;
 
+    std::vector<SQLOperation*> _batch;
+
     DatabaseWorker(DatabaseWorker const& right) = delete;
     DatabaseWorker& operator=(DatabaseWorker const& right) = delete;
 };
@@ -18,19 +18,22 @@
 #include "DatabaseWorkerPool.h"
 #include "AdhocStatement.h"
 #include "CharacterDatabase.h"
+#include "DatabaseWorker.h"
 #include "Errors.h"
 #include "Log.h"
 #include "LoginDatabase.h"
 #include "MySQLPreparedStatement.h"
 #include "MySQLWorkaround.h"
-#include "PCQueue.h"
 #include "PreparedStatement.h"
 #include "QueryCallback.h"
 #include "QueryHolder.h"
 #include "QueryResult.h"
 #include "SQLOperation.h"
+#include "Timer.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
+#include <algorithm>
+#include <errmsg.h>
 #include <limits>
 #include <mysqld_error.h>
 
@@ -59,9 +62,9 @@ class PingOperation : public SQLOperation
 
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
-    _queue(new ProducerConsumerQueue<SQLOperation*>()),
     _async_threads(0),
-    _synch_threads(0)
+    _synch_threads(0),
+    _batch_size(1)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -82,16 +85,18 @@ DatabaseWorkerPool<T>::DatabaseWorkerPool() :
 template <class T>
 DatabaseWorkerPool<T>::~DatabaseWorkerPool()
 {
-    _queue->Cancel();
+    for (auto& shard : _shards)
+        shard->Queue.Cancel();
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads)
+void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads, uint8 const batchSize)
 {
     _connectionInfo = std::make_unique<MySQLConnectionInfo>(infoString);
 
     _async_threads = asyncThreads;
     _synch_threads = synchThreads;
+    _batch_size = std::max<uint8>(batchSize, 1);
 }
 
 template <class T>
@@ -279,6 +284,20 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     Enqueue(new TransactionTask(transaction));
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction, uint64 shardKey)
+{
+#ifdef ACORE_DEBUG
+    if (!transaction->GetSize())
+    {
+        LOG_DEBUG("sql.driver", "Transaction contains 0 queries. Not executing.");
+        return;
+    }
+#endif // ACORE_DEBUG
+
+    Enqueue(new TransactionTask(transaction), shardKey);
+}
+
 template <class T>
 TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction)
 {
@@ -305,12 +324,30 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
     return TransactionCallback(std::move(result));
 }
 
+template <class T>
+TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction, uint64 shardKey)
+{
+#ifdef ACORE_DEBUG
+    if (!transaction->GetSize())
+        LOG_DEBUG("sql.driver", "Transaction contains 0 queries. Not executing.");
+#endif // ACORE_DEBUG
+
+    TransactionWithResultTask* task = new TransactionWithResultTask(transaction);
+    TransactionFuture result = task->GetFuture();
+    Enqueue(task, shardKey);
+    return TransactionCallback(std::move(result));
+}
+
 template <class T>
 void DatabaseWorkerPool<T>::DirectCommitTransaction(SQLTransaction<T>& transaction)
 {
     T* connection = GetFreeConnection();
     int errorCode = connection->ExecuteTransaction(transaction);
 
+    //! The connection was lost before the commit, none of the statements was applied
+    if (errorCode == CR_SERVER_LOST)
+        errorCode = connection->ExecuteTransaction(transaction);
+
     if (!errorCode)
     {
         connection->Unlock();      // OK, operation succesful
@@ -368,13 +405,9 @@ void DatabaseWorkerPool<T>::KeepAlive()
         }
     }
 
-    //! Assuming all worker threads are free, every worker thread will receive 1 ping operation request
-    //! If one or more worker threads are busy, the ping operations will not be split evenly, but this doesn't matter
-    //! as the sole purpose is to prevent connections from idling.
-    auto const count = _connections[IDX_ASYNC].size();
-
-    for (uint8 i = 0; i < count; ++i)
-        Enqueue(new PingOperation);
+    //! Every async connection owns its queue, so each one receives exactly 1 ping operation request
+    for (auto& shard : _shards)
+        Enqueue(new PingOperation, shard.get());
 }
 
 template <class T>
@@ -388,7 +421,8 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
             switch (type)
             {
             case IDX_ASYNC:
-                return std::make_unique<T>(_queue.get(), *_connectionInfo);
+                _shards.push_back(std::make_unique<DatabaseWorkerShard>(_batch_size));
+                return std::make_unique<T>(_shards.back().get(), *_connectionInfo);
             case IDX_SYNCH:
                 return std::make_unique<T>(*_connectionInfo);
             default:
@@ -400,6 +434,10 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
         {
             // Failed to open a connection or invalid version, abort and cleanup
             _connections[type].clear();
+
+            if (type == IDX_ASYNC)
+                _shards.clear();
+
             return error;
         }
         else if (connection->GetServerVersion() < MIN_MYSQL_SERVER_VERSION)
@@ -430,13 +468,58 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char* to, char const* from, un
 template <class T>
 void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
 {
-    _queue->Push(op);
+    ASSERT(!_shards.empty());
+
+    DatabaseWorkerShard* shard = _shards.front().get();
+
+    for (auto const& candidate : _shards)
+        if (candidate->Pending < shard->Pending)
+            shard = candidate.get();
+
+    Enqueue(op, shard);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op, uint64 shardKey)
+{
+    ASSERT(!_shards.empty());
+
+    Enqueue(op, _shards[shardKey % _shards.size()].get());
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op, DatabaseWorkerShard* shard)
+{
+    op->m_queuedTime = getMSTime();
+    ++shard->Pending;
+    shard->Queue.Push(op);
 }
 
 template <class T>
 size_t DatabaseWorkerPool<T>::QueueSize() const
 {
-    return _queue->Size();
+    size_t size = 0;
+
+    for (auto const& shard : _shards)
+        size += shard->Queue.Size();
+
+    return size;
+}
+
+template <class T>
+std::vector<DatabaseShardStats> DatabaseWorkerPool<T>::GetShardStats() const
+{
+    std::vector<DatabaseShardStats> stats;
+    stats.reserve(_shards.size());
+
+    for (auto const& shard : _shards)
+    {
+        uint64 const completed = shard->Completed;
+
+        stats.push_back({ shard->Queue.Size(), completed, shard->Batches, completed ? uint32(shard->TotalLatency / completed) : 0 });
+    }
+
+    return stats;
 }
 
 template <class T>
@@ -490,6 +573,13 @@ void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
     Enqueue(task);
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt, uint64 shardKey)
+{
+    PreparedStatementTask* task = new PreparedStatementTask(stmt);
+    Enqueue(task, shardKey);
+}
+
 template <class T>
 void DatabaseWorkerPool<T>::DirectExecute(std::string_view sql)
 {
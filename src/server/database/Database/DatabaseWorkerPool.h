@@ -22,14 +22,22 @@
 #include "Define.h"
 #include "StringFormat.h"
 #include <array>
+#include <atomic>
 #include <vector>
 
-template <typename T>
-class ProducerConsumerQueue;
-
 class SQLOperation;
+struct DatabaseWorkerShard;
 struct MySQLConnectionInfo;
 
+//! Snapshot of the counters of one asynchronous connection, see DatabaseWorkerPool::GetShardStats.
+struct DatabaseShardStats
+{
+    size_t QueueSize;       //! Operations waiting to be executed
+    uint64 Completed;       //! Operations finished since startup
+    uint64 Batches;         //! Groups of one-way statements committed as a single transaction
+    uint32 AverageLatency;  //! Average time between enqueue and completion since startup, in ms
+};
+
 template <class T>
 class DatabaseWorkerPool
 {
@@ -46,7 +54,7 @@ public:
     DatabaseWorkerPool();
     ~DatabaseWorkerPool();
 
-    void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads);
+    void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads, uint8 const batchSize = 1);
 
     uint32 Open();
     void Close();
@@ -82,6 +90,10 @@ public:
     //! Statement must be prepared with CONNECTION_ASYNC flag.
     void Execute(PreparedStatement<T>* stmt);
 
+    //! Same as Execute(PreparedStatement<T>*), but always runs on the asynchronous connection owning shardKey
+    //! (e.g. an account id or character guid), so every operation enqueued with the same key keeps its order.
+    void Execute(PreparedStatement<T>* stmt, uint64 shardKey);
+
     /**
         Direct synchronous one-way statement methods.
     */
@@ -159,10 +171,17 @@ public:
     //! were appended to the transaction will be respected during execution.
     void CommitTransaction(SQLTransaction<T> transaction);
 
+    //! Same as CommitTransaction(SQLTransaction<T>), but always runs on the asynchronous connection owning shardKey
+    //! (e.g. an account id or character guid), so every operation enqueued with the same key keeps its order.
+    void CommitTransaction(SQLTransaction<T> transaction, uint64 shardKey);
+
     //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
     TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction);
 
+    //! Same as AsyncCommitTransaction(SQLTransaction<T>), but always runs on the asynchronous connection owning shardKey.
+    TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction, uint64 shardKey);
+
     //! Directly executes a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
     void DirectCommitTransaction(SQLTransaction<T>& transaction);
@@ -201,12 +220,18 @@ public:
 
     [[nodiscard]] size_t QueueSize() const;
 
+    //! Per asynchronous connection queue depth and latency.
+    [[nodiscard]] std::vector<DatabaseShardStats> GetShardStats() const;
+
 private:
     uint32 OpenConnections(InternalIndex type, uint8 numConnections);
 
     unsigned long EscapeString(char* to, char const* from, unsigned long length);
 
+    //! Operations without a shard key go to the least loaded connection.
     void Enqueue(SQLOperation* op);
+    void Enqueue(SQLOperation* op, uint64 shardKey);
+    void Enqueue(SQLOperation* op, DatabaseWorkerShard* shard);
 
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
@@ -214,12 +239,12 @@ private:
 
     [[nodiscard]] std::string_view GetDatabaseName() const;
 
-    //! Queue shared by async worker threads.
-    std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _queue;
+    //! One queue per async worker thread, must outlive the connections.
+    std::vector<std::unique_ptr<DatabaseWorkerShard>> _shards;
     std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
-    uint8 _async_threads, _synch_threads;
+    uint8 _async_threads, _synch_threads, _batch_size;
 #ifdef ACORE_DEBUG
     static inline thread_local bool _warnSyncQueries = false;
 #endif
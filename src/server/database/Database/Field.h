@@ -99,6 +99,7 @@ class AC_DATABASE_API Field
 {
 friend class ResultSet;
 friend class PreparedResultSet;
+friend class QuerySnapshot;
 
 public:
     Field();
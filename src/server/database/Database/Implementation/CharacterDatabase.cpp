@@ -119,6 +119,16 @@ void CharacterDatabaseConnection::DoPrepareStatements()
 
     PrepareStatement(CHAR_SEL_CHARACTER_ACTIONS_SPEC, "SELECT button, action, type FROM character_action WHERE guid = ? AND spec = ? ORDER BY button", CONNECTION_ASYNC);
     PrepareStatement(CHAR_SEL_CHARACTER_ACTIONS_SPEC_LOADOUT, "SELECT button, action, type FROM forge_character_action WHERE guid = ? AND spec = ? and loadout = ? ORDER BY button", CONNECTION_ASYNC);
+
+    // Forge per-account data, loaded on demand. Account wide rows are keyed by account id with spec = ACCOUNT_WIDE_KEY.
+    PrepareStatement(CHAR_SEL_FORGE_ACCOUNT_CHARACTERS, "SELECT guid FROM characters WHERE account = ?", CONNECTION_BOTH);
+    PrepareStatement(CHAR_SEL_FORGE_ACCOUNT_SPECS, "SELECT s.id, s.guid, s.name, s.description, s.active, s.spellicon, s.visability, s.charSpec FROM forge_character_specs s JOIN characters c ON c.guid = s.guid WHERE c.account = ?", CONNECTION_BOTH);
+    PrepareStatement(CHAR_SEL_FORGE_ACCOUNT_TALENTS_SPENT, "SELECT guid, spec, tabId, spent FROM forge_character_talents_spent WHERE (guid = ? AND spec = ?) OR (spec <> ? AND guid IN (SELECT guid FROM characters WHERE account = ?))", CONNECTION_BOTH);
+    PrepareStatement(CHAR_SEL_FORGE_ACCOUNT_TALENTS, "SELECT guid, spec, spellid, tabId, currentrank FROM forge_character_talents WHERE (guid = ? AND spec = ?) OR (spec <> ? AND guid IN (SELECT guid FROM characters WHERE account = ?))", CONNECTION_BOTH);
+    PrepareStatement(CHAR_SEL_FORGE_ACCOUNT_POINTS, "SELECT guid, type, spec, sum, max FROM forge_character_points WHERE (guid = ? AND spec = ?) OR (spec <> ? AND guid IN (SELECT guid FROM characters WHERE account = ?))", CONNECTION_BOTH);
+    PrepareStatement(CHAR_SEL_FORGE_ACCOUNT_XMOG_SETS, "SELECT guid, setid, setname, head, shoulders, shirt, chest, waist, legs, feet, wrists, hands, back, mh, oh, ranged, tabard FROM forge_character_transmogsets WHERE guid IN (SELECT guid FROM characters WHERE account = ?)", CONNECTION_BOTH);
+    PrepareStatement(CHAR_SEL_FORGE_ACCOUNT_LOADOUTS, "SELECT guid, id, talentTabId, name, talentString, active FROM forge_character_talent_loadouts WHERE guid IN (SELECT guid FROM characters WHERE account = ?)", CONNECTION_BOTH);
+
     PrepareStatement(CHAR_SEL_MAILITEMS, "SELECT creatorGuid, giftCreatorGuid, count, duration, charges, flags, enchantments, randomPropertyId, durability, playedTime, text, item_guid, itemEntry, ii.owner_guid, m.id, 0, transmog, enchant FROM mail_items mi INNER JOIN mail m ON mi.mail_id = m.id LEFT JOIN item_instance ii ON mi.item_guid = ii.guid WHERE m.receiver = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_SEL_AUCTION_ITEMS, "SELECT creatorGuid, giftCreatorGuid, count, duration, charges, ii.flags, enchantments, randomPropertyId, durability, playedTime, text, itemguid, itemEntry, 0, 0, 0, transmog, enchant FROM auctionhouse ah JOIN item_instance ii ON ah.itemguid = ii.guid", CONNECTION_SYNCH);
     PrepareStatement(CHAR_SEL_MAILITEMS, "SELECT creatorGuid, giftCreatorGuid, count, duration, charges, flags, enchantments, randomPropertyId, durability, playedTime, text, item_guid, itemEntry, ii.owner_guid, m.id FROM mail_items mi INNER JOIN mail m ON mi.mail_id = m.id LEFT JOIN item_instance ii ON mi.item_guid = ii.guid WHERE m.receiver = ?", CONNECTION_ASYNC);
@@ -244,6 +254,8 @@ void CharacterDatabaseConnection::DoPrepareStatements()
     // Auras
     PrepareStatement(CHAR_INS_AURA, "INSERT INTO character_aura (guid, casterGuid, itemGuid, spell, effectMask, recalculateMask, stackcount, amount0, amount1, amount2, base_amount0, base_amount1, base_amount2, maxDuration, remainTime, remainCharges) "
                      "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC);
+    PrepareStatement(CHAR_REP_AURA, "REPLACE INTO character_aura (guid, casterGuid, itemGuid, spell, effectMask, recalculateMask, stackcount, amount0, amount1, amount2, base_amount0, base_amount1, base_amount2, maxDuration, remainTime, remainCharges) "
+                     "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC);
 
     // Account data
     PrepareStatement(CHAR_SEL_ACCOUNT_DATA, "SELECT type, time, data FROM account_data WHERE accountId = ?", CONNECTION_ASYNC);
@@ -486,10 +498,12 @@ void CharacterDatabaseConnection::DoPrepareStatements()
     PrepareStatement(CHAR_UPD_CHAR_TITLES_FACTION_CHANGE, "UPDATE characters SET knownTitles = ? WHERE guid = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_RES_CHAR_TITLES_FACTION_CHANGE, "UPDATE characters SET chosenTitle = 0 WHERE guid = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN, "DELETE FROM character_spell_cooldown WHERE guid = ?", CONNECTION_ASYNC);
+    PrepareStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN_BY_SPELL, "DELETE FROM character_spell_cooldown WHERE guid = ? AND spell = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_DEL_CHARACTER, "DELETE FROM characters WHERE guid = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_DEL_CHAR_ACTION, "DELETE FROM character_action WHERE guid = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_DEL_CHAR_ACTION_LOADOUT, "DELETE FROM forge_character_action WHERE guid = ? and spec = ? and loadout = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_DEL_CHAR_AURA, "DELETE FROM character_aura WHERE guid = ?", CONNECTION_ASYNC);
+    PrepareStatement(CHAR_DEL_CHAR_AURA_BY_SPELL, "DELETE FROM character_aura WHERE guid = ? AND casterGuid = ? AND itemGuid = ? AND spell = ? AND effectMask = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_DEL_CHAR_GIFT, "DELETE FROM character_gifts WHERE guid = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_DEL_CHAR_INSTANCE, "DELETE FROM character_instance WHERE guid = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_DEL_CHAR_INVENTORY, "DELETE FROM character_inventory WHERE guid = ?", CONNECTION_ASYNC);
@@ -915,13 +929,19 @@ void CharacterDatabaseConnection::DoPrepareStatements()
 
     PrepareStatement(CHAR_DEL_CHAR_SPELL_CHARGES, "DELETE FROM character_spell_charges WHERE guid = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_SEL_CHARACTER_SPELLCHARGES, "SELECT classMask0, classMask1, classMask2, maxCharges, currentCharges, maxDuration, currentDuration, chargeAura FROM character_spell_charges WHERE guid = ?", CONNECTION_ASYNC);
+
+    // Anticheat
+    PrepareStatement(CHAR_REP_PLAYERS_REPORTS_STATUS, "REPLACE INTO players_reports_status (guid, average, total_reports, speed_reports, fly_reports, jump_reports, waterwalk_reports, teleportplane_reports, climb_reports, teleport_reports, ignorecontrol_reports, zaxis_reports, antiswim_reports, gravity_reports, antiknockback_reports, no_fall_damage_reports, op_ack_hack_reports, counter_measures_reports, creation_time) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC);
+    PrepareStatement(CHAR_REP_DAILY_PLAYERS_REPORTS, "REPLACE INTO daily_players_reports (guid, average, total_reports, speed_reports, fly_reports, jump_reports, waterwalk_reports, teleportplane_reports, climb_reports, teleport_reports, ignorecontrol_reports, zaxis_reports, antiswim_reports, gravity_reports, antiknockback_reports, no_fall_damage_reports, op_ack_hack_reports, counter_measures_reports, creation_time) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC);
+    PrepareStatement(CHAR_DEL_PLAYERS_REPORTS_STATUS, "DELETE FROM players_reports_status WHERE guid = ?", CONNECTION_ASYNC);
+    PrepareStatement(CHAR_SEL_DAILY_PLAYERS_REPORTS, "SELECT guid FROM daily_players_reports WHERE guid = ?", CONNECTION_ASYNC);
 }
 
 CharacterDatabaseConnection::CharacterDatabaseConnection(MySQLConnectionInfo& connInfo) : MySQLConnection(connInfo)
 {
 }
 
-CharacterDatabaseConnection::CharacterDatabaseConnection(ProducerConsumerQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo) : MySQLConnection(q, connInfo)
+CharacterDatabaseConnection::CharacterDatabaseConnection(DatabaseWorkerShard* shard, MySQLConnectionInfo& connInfo) : MySQLConnection(shard, connInfo)
 {
 }
 
@@ -83,6 +83,13 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_CHARACTER_ACTIONS,
     CHAR_SEL_CHARACTER_ACTIONS_SPEC,
     CHAR_SEL_CHARACTER_ACTIONS_SPEC_LOADOUT,
+    CHAR_SEL_FORGE_ACCOUNT_CHARACTERS,
+    CHAR_SEL_FORGE_ACCOUNT_SPECS,
+    CHAR_SEL_FORGE_ACCOUNT_TALENTS_SPENT,
+    CHAR_SEL_FORGE_ACCOUNT_TALENTS,
+    CHAR_SEL_FORGE_ACCOUNT_POINTS,
+    CHAR_SEL_FORGE_ACCOUNT_XMOG_SETS,
+    CHAR_SEL_FORGE_ACCOUNT_LOADOUTS,
     CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD,
     CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD_SYNCH,
     CHAR_SEL_MAIL_SERVER_CHARACTER,
@@ -198,6 +205,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_EQUIP_SET,
 
     CHAR_INS_AURA,
+    CHAR_REP_AURA,
 
     CHAR_SEL_ACCOUNT_DATA,
     CHAR_REP_ACCOUNT_DATA,
@@ -407,10 +415,12 @@ enum CharacterDatabaseStatements : uint32
     CHAR_UPD_CHAR_TITLES_FACTION_CHANGE,
     CHAR_RES_CHAR_TITLES_FACTION_CHANGE,
     CHAR_DEL_CHAR_SPELL_COOLDOWN,
+    CHAR_DEL_CHAR_SPELL_COOLDOWN_BY_SPELL,
     CHAR_DEL_CHARACTER,
     CHAR_DEL_CHAR_ACTION,
     CHAR_DEL_CHAR_ACTION_LOADOUT,
     CHAR_DEL_CHAR_AURA,
+    CHAR_DEL_CHAR_AURA_BY_SPELL,
     CHAR_DEL_CHAR_GIFT,
     CHAR_DEL_CHAR_INSTANCE,
     CHAR_DEL_CHAR_INVENTORY,
@@ -542,6 +552,11 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_CHAR_SPELL_CHARGES,
     CHAR_SEL_CHARACTER_SPELLCHARGES,
 
+    CHAR_REP_PLAYERS_REPORTS_STATUS,
+    CHAR_REP_DAILY_PLAYERS_REPORTS,
+    CHAR_DEL_PLAYERS_REPORTS_STATUS,
+    CHAR_SEL_DAILY_PLAYERS_REPORTS,
+
     MAX_CHARACTERDATABASE_STATEMENTS
 };
 
@@ -552,7 +567,7 @@ public:
 
     //- Constructors for sync and async connections
     CharacterDatabaseConnection(MySQLConnectionInfo& connInfo);
-    CharacterDatabaseConnection(ProducerConsumerQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo);
+    CharacterDatabaseConnection(DatabaseWorkerShard* shard, MySQLConnectionInfo& connInfo);
     ~CharacterDatabaseConnection() override;
 
     //- Loads database type specific prepared statements
@@ -32,8 +32,6 @@ enum WorldDatabaseStatements : uint32
     WORLD_DEL_CRELINKED_RESPAWN,
     WORLD_REP_CREATURE_LINKED_RESPAWN,
     WORLD_SEL_CREATURE_TEXT,
-    WORLD_SEL_SMART_SCRIPTS,
-    WORLD_SEL_SMARTAI_WP,
     WORLD_DEL_GAMEOBJECT,
     WORLD_DEL_EVENT_GAMEOBJECT,
     WORLD_INS_GRAVEYARD_ZONE,
@@ -111,11 +109,15 @@ public:
 
     //- Constructors for sync and async connections
     WorldDatabaseConnection(MySQLConnectionInfo& connInfo);
-    WorldDatabaseConnection(ProducerConsumerQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo);
+    WorldDatabaseConnection(DatabaseWorkerShard* shard, MySQLConnectionInfo& connInfo);
     ~WorldDatabaseConnection() override;
 
     //- Loads database type specific prepared statements
     void DoPrepareStatements() override;
+
+protected:
+    //- Drops the query snapshots reading the written table
+    void OnStatementExecuted(std::string_view sql) override;
 };
 
 #endif
@@ -51,20 +51,24 @@ MySQLConnectionInfo::MySQLConnectionInfo(std::string_view infoString)
 MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
     m_prepareError(false),
+    m_inTransaction(false),
+    m_transactionLost(false),
     m_Mysql(nullptr),
-    m_queue(nullptr),
+    m_shard(nullptr),
     m_connectionInfo(connInfo),
     m_connectionFlags(CONNECTION_SYNCH) { }
 
-MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo) :
+MySQLConnection::MySQLConnection(DatabaseWorkerShard* shard, MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
     m_prepareError(false),
+    m_inTransaction(false),
+    m_transactionLost(false),
     m_Mysql(nullptr),
-    m_queue(queue),
+    m_shard(shard),
     m_connectionInfo(connInfo),
     m_connectionFlags(CONNECTION_ASYNC)
 {
-    m_worker = std::make_unique<DatabaseWorker>(m_queue, this);
+    m_worker = std::make_unique<DatabaseWorker>(m_shard, this);
 }
 
 MySQLConnection::~MySQLConnection()
@@ -199,7 +203,7 @@ bool MySQLConnection::Execute(std::string_view sql)
             LOG_ERROR("sql.sql", "[{}] {}", lErrno, mysql_error(m_Mysql));
 
             if (_HandleMySQLErrno(lErrno))  // If it returns true, an error was handled successfully (i.e. reconnection)
-                return Execute(sql);       // Try again
+                return CanRetryAfterReconnect() && Execute(sql);       // Try again
 
             return false;
         }
@@ -207,6 +211,7 @@ bool MySQLConnection::Execute(std::string_view sql)
             LOG_DEBUG("sql.sql", "[{} ms] SQL: {}", getMSTimeDiff(_s, getMSTime()), sql);
     }
 
+    OnStatementExecuted(sql);
     return true;
 }
 
@@ -233,7 +238,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
         LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
 
         if (_HandleMySQLErrno(lErrno))  // If it returns true, an error was handled successfully (i.e. reconnection)
-            return Execute(stmt);       // Try again
+            return CanRetryAfterReconnect() && Execute(stmt);       // Try again
 
         m_mStmt->ClearParameters();
         return false;
@@ -245,7 +250,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
         LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
 
         if (_HandleMySQLErrno(lErrno))  // If it returns true, an error was handled successfully (i.e. reconnection)
-            return Execute(stmt);       // Try again
+            return CanRetryAfterReconnect() && Execute(stmt);       // Try again
 
         m_mStmt->ClearParameters();
         return false;
@@ -254,6 +259,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     LOG_DEBUG("sql.sql", "[{} ms] SQL(p): {}", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString());
 
     m_mStmt->ClearParameters();
+    OnStatementExecuted(m_mStmt->getQueryString());
     return true;
 }
 
@@ -369,17 +375,34 @@ bool MySQLConnection::_Query(std::string_view sql, MySQLResult** pResult, MySQLF
 
 void MySQLConnection::BeginTransaction()
 {
-    Execute("START TRANSACTION");
+    m_transactionLost = false;
+    m_inTransaction = Execute("START TRANSACTION");
 }
 
 void MySQLConnection::RollbackTransaction()
 {
+    m_inTransaction = false;
     Execute("ROLLBACK");
 }
 
-void MySQLConnection::CommitTransaction()
+bool MySQLConnection::CommitTransaction()
 {
-    Execute("COMMIT");
+    bool committed = Execute("COMMIT");
+    m_inTransaction = false;
+    return committed;
+}
+
+bool MySQLConnection::CanRetryAfterReconnect()
+{
+    if (!m_inTransaction)
+        return true;
+
+    // The server rolled back the open transaction with the old connection. Retrying only the failed
+    // statement would run it on its own in autocommit mode, and the COMMIT after it would "succeed".
+    LOG_ERROR("sql.sql", "Connection lost inside a transaction, the whole transaction has to be executed again.");
+    m_inTransaction = false;
+    m_transactionLost = true;
+    return false;
 }
 
 int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transaction)
@@ -413,7 +436,7 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
                 if (!Execute(stmt))
                 {
                     LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
-                    int errorCode = GetLastError();
+                    int errorCode = GetTransactionError();
                     RollbackTransaction();
                     return errorCode;
                 }
@@ -438,7 +461,7 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
                 if (!Execute(sql))
                 {
                     LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
-                    uint32 errorCode = GetLastError();
+                    uint32 errorCode = GetTransactionError();
                     RollbackTransaction();
                     return errorCode;
                 }
@@ -452,10 +475,51 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
     // This is done in calling functions DatabaseWorkerPool<T>::DirectCommitTransaction and TransactionTask::Execute,
     // and not while iterating over every element.
 
-    CommitTransaction();
+    if (!CommitTransaction())
+    {
+        LOG_WARN("sql.sql", "Transaction commit failed. {} queries not executed.", queries.size());
+        int errorCode = GetTransactionError();
+        RollbackTransaction();
+        return errorCode;
+    }
+
     return 0;
 }
 
+bool MySQLConnection::IsBatchable(PreparedStatementBase* stmt)
+{
+    MySQLPreparedStatement* mysqlStmt = GetPreparedStatement(stmt->GetIndex());
+    return mysqlStmt && mysqlStmt->IsBatchable();
+}
+
+bool MySQLConnection::CausesImplicitCommit(std::string_view sql)
+{
+    static constexpr std::string_view Keywords[] =
+    {
+        "ALTER", "ANALYZE", "BEGIN", "CACHE", "CHECK", "COMMIT", "CREATE", "DROP", "FLUSH", "GRANT", "INSTALL", "LOAD",
+        "LOCK", "OPTIMIZE", "RENAME", "REPAIR", "RESET", "REVOKE", "ROLLBACK", "SET", "START", "TRUNCATE", "UNINSTALL", "UNLOCK"
+    };
+
+    std::size_t start = sql.find_first_not_of(" \t\r\n(");
+    if (start == std::string_view::npos)
+        return false;
+
+    sql.remove_prefix(start);
+    std::string_view keyword = sql.substr(0, sql.find_first_of(" \t\r\n(;"));
+
+    for (std::string_view implicitCommit : Keywords)
+        if (StringEqualI(keyword, implicitCommit))
+            return true;
+
+    return false;
+}
+
+int MySQLConnection::GetTransactionError()
+{
+    // the new connection has no error of its own after a reconnect
+    return m_transactionLost ? CR_SERVER_LOST : GetLastError();
+}
+
 size_t MySQLConnection::EscapeString(char* to, const char* from, size_t length)
 {
     return mysql_real_escape_string(m_Mysql, to, from, length);
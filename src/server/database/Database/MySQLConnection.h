@@ -26,10 +26,8 @@
 #include <string>
 #include <vector>
 
-template <typename T>
-class ProducerConsumerQueue;
-
 class DatabaseWorker;
+struct DatabaseWorkerShard;
 class MySQLPreparedStatement;
 class SQLOperation;
 
@@ -61,7 +59,7 @@ friend class PingOperation;
 
 public:
     MySQLConnection(MySQLConnectionInfo& connInfo);                               //! Constructor for synchronous connections.
-    MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo);  //! Constructor for asynchronous connections.
+    MySQLConnection(DatabaseWorkerShard* shard, MySQLConnectionInfo& connInfo);  //! Constructor for asynchronous connections.
     virtual ~MySQLConnection();
 
     virtual uint32 Open();
@@ -78,8 +76,15 @@ public:
 
     void BeginTransaction();
     void RollbackTransaction();
-    void CommitTransaction();
+    bool CommitTransaction();
+    //! 0 on success; CR_SERVER_LOST when the connection was lost before the commit and the whole transaction has to be executed again
     int ExecuteTransaction(std::shared_ptr<TransactionBase> transaction);
+    //! Was the connection lost since the last BeginTransaction? If it happened on COMMIT, the transaction may or may not have been applied
+    [[nodiscard]] bool IsTransactionLost() const { return m_transactionLost; }
+    //! False for statements that commit the open transaction on their own, they can't be grouped with others
+    bool IsBatchable(PreparedStatementBase* stmt);
+    //! TRUNCATE, DDL and the other statements causing an implicit commit
+    static bool CausesImplicitCommit(std::string_view sql);
     size_t EscapeString(char* to, const char* from, size_t length);
     void Ping();
 
@@ -99,16 +104,23 @@ protected:
 
     virtual void DoPrepareStatements() = 0;
     virtual bool _HandleMySQLErrno(uint32 errNo, uint8 attempts = 5);
+    /// After a reconnect: false when a transaction was open, it is gone with the old connection
+    bool CanRetryAfterReconnect();
+    int GetTransactionError();
+    /// Called after every successful Execute, with the statement text (prepared statements keep their placeholders)
+    virtual void OnStatementExecuted(std::string_view /*sql*/) { }
 
     typedef std::vector<std::unique_ptr<MySQLPreparedStatement>> PreparedStatementContainer;
 
     PreparedStatementContainer m_stmts; //! PreparedStatements storage
     bool m_reconnecting;  //! Are we reconnecting?
     bool m_prepareError;  //! Was there any error while preparing statements?
+    bool m_inTransaction; //! Is a transaction started by BeginTransaction open?
+    bool m_transactionLost; //! Was the connection lost since the last BeginTransaction?
     MySQLHandle* m_Mysql; //! MySQL Handle.
 
 private:
-    ProducerConsumerQueue<SQLOperation*>* m_queue;      //! Queue shared with other asynchronous connections.
+    DatabaseWorkerShard* m_shard;                       //! Queue owned by this asynchronous connection.
     std::unique_ptr<DatabaseWorker> m_worker;           //! Core worker task.
     MySQLConnectionInfo& m_connectionInfo;              //! Connection info (used for logging)
     ConnectionFlags m_connectionFlags;                  //! Connection flags (for preparing relevant statements)
@@ -17,6 +17,7 @@
 
 #include "MySQLPreparedStatement.h"
 #include "Errors.h"
+#include "MySQLConnection.h"
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "PreparedStatement.h"
@@ -39,7 +40,8 @@ MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string_view
     m_stmt(nullptr),
     m_Mstmt(stmt),
     m_bind(nullptr),
-    m_queryString(std::string(queryString))
+    m_queryString(std::string(queryString)),
+    m_batchable(!MySQLConnection::CausesImplicitCommit(queryString))
 {
     /// Initialize variable parameters
     m_paramCount = mysql_stmt_param_count(stmt);
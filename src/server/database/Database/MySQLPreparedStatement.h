@@ -42,6 +42,7 @@ public:
     void BindParameters(PreparedStatementBase* stmt);
 
     uint32 GetParameterCount() const { return m_paramCount; }
+    [[nodiscard]] bool IsBatchable() const { return m_batchable; }
 
 protected:
     void SetParameter(const uint8 index, bool value);
@@ -65,6 +66,7 @@ private:
     std::vector<bool> m_paramsSet;
     MySQLBind* m_bind;
     std::string m_queryString{};
+    bool m_batchable; //! Can run inside a worker batch, see MySQLConnection::CausesImplicitCommit
 
     MySQLPreparedStatement(MySQLPreparedStatement const& right) = delete;
     MySQLPreparedStatement& operator=(MySQLPreparedStatement const& right) = delete;
@@ -101,6 +101,11 @@ bool PreparedStatementTask::Execute()
     return m_conn->Execute(m_stmt);
 }
 
+bool PreparedStatementTask::IsBatchable() const
+{
+    return !m_has_result && m_conn && m_conn->IsBatchable(m_stmt);
+}
+
 template<typename T>
 std::string PreparedStatementData::ToString(T value)
 {
@@ -174,6 +174,7 @@ public:
     ~PreparedStatementTask() override;
 
     bool Execute() override;
+    [[nodiscard]] bool IsBatchable() const override;
     PreparedQueryResultFuture GetFuture() { return m_result->get_future(); }
 
 protected:
@@ -21,6 +21,7 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
+#include "QuerySnapshot.h"
 
 namespace
 {
@@ -168,7 +169,8 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     _rowCount(rowCount),
     _fieldCount(fieldCount),
     _result(result),
-    _fields(fields)
+    _fields(fields),
+    _snapshotRow(0)
 {
     _fieldMetadata.resize(_fieldCount);
     _currentRow = new Field[_fieldCount];
@@ -180,6 +182,24 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     }
 }
 
+ResultSet::ResultSet(std::shared_ptr<QuerySnapshot const> snapshot) :
+    _rowCount(snapshot->GetRowCount()),
+    _fieldCount(snapshot->GetFieldCount()),
+    _result(nullptr),
+    _fields(nullptr),
+    _snapshot(std::move(snapshot)),
+    _snapshotRow(0)
+{
+    _fieldMetadata.resize(_fieldCount);
+    _currentRow = new Field[_fieldCount];
+
+    for (uint32 i = 0; i < _fieldCount; i++)
+    {
+        _fieldMetadata[i] = _snapshot->GetFieldMetadata(i);
+        _currentRow[i].SetMetadata(&_fieldMetadata[i]);
+    }
+}
+
 ResultSet::~ResultSet()
 {
     CleanUp();
@@ -189,6 +209,24 @@ bool ResultSet::NextRow()
 {
     MYSQL_ROW row;
 
+    if (_snapshot)
+    {
+        if (_snapshotRow >= _rowCount)
+        {
+            CleanUp();
+            return false;
+        }
+
+        for (uint32 i = 0; i < _fieldCount; i++)
+        {
+            std::pair<char const*, uint32> value = _snapshot->GetValue(_snapshotRow, i);
+            _currentRow[i].SetStructuredValue(value.first, value.second);
+        }
+
+        ++_snapshotRow;
+        return true;
+    }
+
     if (!_result)
         return false;
 
@@ -216,7 +254,13 @@ bool ResultSet::NextRow()
 std::string ResultSet::GetFieldName(uint32 index) const
 {
     ASSERT(index < _fieldCount);
-    return _fields[index].name;
+    return _fieldMetadata[index].Alias;
+}
+
+QueryResultFieldMetadata const& ResultSet::GetFieldMetadata(uint32 index) const
+{
+    ASSERT(index < _fieldCount);
+    return _fieldMetadata[index];
 }
 
 void ResultSet::CleanUp()
@@ -232,6 +276,8 @@ void ResultSet::CleanUp()
         mysql_free_result(_result);
         _result = nullptr;
     }
+
+    _snapshot.reset();
 }
 
 Field const& ResultSet::operator[](std::size_t index) const
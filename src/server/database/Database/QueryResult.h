@@ -21,6 +21,7 @@
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "Field.h"
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -45,16 +46,21 @@ private:
     pointer _ptr;
 };
 
+class QuerySnapshot;
+
 class AC_DATABASE_API ResultSet
 {
 public:
     ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount);
+    // rows served from a recorded snapshot instead of the server, fields point into the snapshot data
+    explicit ResultSet(std::shared_ptr<QuerySnapshot const> snapshot);
     ~ResultSet();
 
     bool NextRow();
     [[nodiscard]] uint64 GetRowCount() const { return _rowCount; }
     [[nodiscard]] uint32 GetFieldCount() const { return _fieldCount; }
     [[nodiscard]] std::string GetFieldName(uint32 index) const;
+    [[nodiscard]] QueryResultFieldMetadata const& GetFieldMetadata(uint32 index) const;
 
     [[nodiscard]] Field* Fetch() const { return _currentRow; }
     Field const& operator[](std::size_t index) const;
@@ -91,6 +97,9 @@ private:
     MySQLResult* _result;
     MySQLField* _fields;
 
+    std::shared_ptr<QuerySnapshot const> _snapshot;
+    uint64 _snapshotRow;
+
     ResultSet(ResultSet const& right) = delete;
     ResultSet& operator=(ResultSet const& right) = delete;
 };
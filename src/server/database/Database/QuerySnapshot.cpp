@@ -0,0 +1,650 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QuerySnapshot.h"
+#include "CryptoHash.h"
+#include "DatabaseEnv.h"
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+#include "Util.h"
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+
+namespace
+{
+    constexpr char SNAPSHOT_MAGIC[4] = { 'Q', 'S', 'N', 'P' };
+    constexpr uint32 SNAPSHOT_FORMAT_VERSION = 1;
+
+    struct SnapshotHeader
+    {
+        char Magic[4];
+        uint32 FormatVersion;
+        Acore::Crypto::SHA1::Digest SqlDigest;
+        Acore::Crypto::SHA1::Digest VersionKeyDigest;
+        Acore::Crypto::SHA1::Digest PayloadDigest;
+        uint32 FieldCount;
+        uint64 RowCount;
+        uint64 PayloadSize;
+    };
+
+    std::size_t AlignedSize(std::size_t size)
+    {
+        return (size + 7) & ~std::size_t(7);
+    }
+
+    void AppendString(std::vector<char>& buffer, std::string const& str)
+    {
+        buffer.insert(buffer.end(), str.begin(), str.end());
+        buffer.push_back('\0');
+    }
+
+    char const* ReadString(char const* pos, char const* end, std::string& str)
+    {
+        char const* terminator = static_cast<char const*>(std::memchr(pos, '\0', end - pos));
+        if (!terminator)
+            return nullptr;
+
+        str.assign(pos, terminator);
+        return terminator + 1;
+    }
+
+    // lower case words, quoted identifiers with their quotes and single punctuation characters; string literals are skipped
+    std::vector<std::string> Tokenize(std::string_view sql)
+    {
+        std::vector<std::string> tokens;
+        std::size_t pos = 0;
+        while (pos < sql.size())
+        {
+            char c = sql[pos];
+            if (std::isspace(static_cast<unsigned char>(c)))
+            {
+                ++pos;
+                continue;
+            }
+
+            if (c == '\'' || c == '"')
+            {
+                for (++pos; pos < sql.size() && sql[pos] != c; ++pos)
+                    if (sql[pos] == '\\')
+                        ++pos;
+
+                ++pos;
+                continue;
+            }
+
+            std::size_t start = pos;
+            while (pos < sql.size())
+            {
+                c = sql[pos];
+                if (c == '`')
+                {
+                    std::size_t closing = sql.find('`', pos + 1);
+                    pos = closing == std::string_view::npos ? sql.size() : closing + 1;
+                }
+                else if (std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$' || c == '.')
+                    ++pos;
+                else
+                    break;
+            }
+
+            if (pos == start)
+                ++pos;
+
+            std::string token(sql.substr(start, pos - start));
+            std::transform(token.begin(), token.end(), token.begin(), [](char ch) { return char(std::tolower(static_cast<unsigned char>(ch))); });
+            tokens.push_back(std::move(token));
+        }
+
+        return tokens;
+    }
+
+    // "`acore_world`.`creature`" -> "creature"
+    std::string GetTableName(std::string const& token)
+    {
+        std::string name = token.substr(token.find_last_of('.') + 1);
+        name.erase(std::remove(name.begin(), name.end(), '`'), name.end());
+        return name;
+    }
+
+    bool IsIdentifier(std::string const& token)
+    {
+        return !token.empty() && (std::isalnum(static_cast<unsigned char>(token[0])) || token[0] == '_' || token[0] == '`');
+    }
+
+    bool IsTableAlias(std::string const& token)
+    {
+        static std::set<std::string_view> const keywords = { "where", "order", "group", "having", "limit", "left", "right", "inner",
+            "outer", "cross", "natural", "straight_join", "join", "on", "using", "union", "for", "lock", "procedure", "into", "window" };
+
+        return IsIdentifier(token) && !keywords.count(token);
+    }
+
+    // tables named after FROM and JOIN, including comma separated lists and subqueries; empty if there is none
+    std::vector<std::string> GetTablesReadBy(std::string_view sql)
+    {
+        std::vector<std::string> tokens = Tokenize(sql);
+        std::vector<std::string> tables;
+        for (std::size_t i = 0; i < tokens.size(); ++i)
+        {
+            if (tokens[i] != "from" && tokens[i] != "join")
+                continue;
+
+            while (++i < tokens.size() && IsIdentifier(tokens[i]))
+            {
+                tables.push_back(GetTableName(tokens[i]));
+
+                if (i + 1 < tokens.size() && tokens[i + 1] == "as")
+                    i += 2;
+                else if (i + 1 < tokens.size() && IsTableAlias(tokens[i + 1]))
+                    ++i;
+
+                if (i + 1 >= tokens.size() || tokens[i + 1] != ",")
+                    break;
+
+                ++i;
+            }
+        }
+
+        std::sort(tables.begin(), tables.end());
+        tables.erase(std::unique(tables.begin(), tables.end()), tables.end());
+        return tables;
+    }
+
+    // nullopt for statements that change no table, an empty name when the written table cannot be told
+    std::optional<std::string> GetTableWrittenBy(std::string_view sql)
+    {
+        static std::set<std::string_view> const readOnly = { "select", "start", "begin", "commit", "rollback", "savepoint",
+            "release", "set", "show", "lock", "unlock", "do", "(" };
+        static std::set<std::string_view> const modifiers = { "low_priority", "high_priority", "delayed", "quick", "ignore", "into", "table" };
+
+        std::vector<std::string> tokens = Tokenize(sql);
+        if (tokens.empty() || readOnly.count(tokens[0]))
+            return std::nullopt;
+
+        std::string const& verb = tokens[0];
+        if (verb != "insert" && verb != "replace" && verb != "update" && verb != "delete" && verb != "truncate")
+            return std::string();
+
+        std::size_t i = 1;
+        while (i < tokens.size() && modifiers.count(tokens[i]))
+            ++i;
+
+        if (verb == "delete")
+        {
+            // multi table DELETE t1 FROM t1 JOIN ... names its targets before FROM
+            if (i >= tokens.size() || tokens[i] != "from")
+                return std::string();
+
+            ++i;
+        }
+
+        if (i >= tokens.size() || !IsIdentifier(tokens[i]))
+            return std::string();
+
+        return GetTableName(tokens[i]);
+    }
+}
+
+class QuerySnapshot::Builder
+{
+public:
+    Builder(uint32 fieldCount, uint64 rowCount) : _fieldCount(fieldCount)
+    {
+        _entries.reserve(rowCount * fieldCount);
+    }
+
+    void AddField(QueryResultFieldMetadata const& meta)
+    {
+        _metadata.push_back(char(meta.Type));
+        AppendString(_metadata, meta.TableName);
+        AppendString(_metadata, meta.TableAlias);
+        AppendString(_metadata, meta.Name);
+        AppendString(_metadata, meta.Alias);
+        AppendString(_metadata, meta.TypeName);
+    }
+
+    // nullptr is NULL
+    void AddValue(char const* value, uint32 length)
+    {
+        if (!value)
+        {
+            _entries.push_back({ NULL_VALUE, 0 });
+            return;
+        }
+
+        _entries.push_back({ uint32(_values.size()), length });
+        _values.insert(_values.end(), value, value + length);
+        _values.push_back('\0');
+    }
+
+    std::shared_ptr<QuerySnapshot> Finish()
+    {
+        _metadata.resize(AlignedSize(_metadata.size()), '\0');
+
+        uint64 rowCount = _entries.size() / std::max<uint32>(_fieldCount, 1);
+
+        auto buffer = std::make_shared<std::vector<char>>();
+        buffer->reserve(_metadata.size() + _entries.size() * sizeof(ValueEntry) + _values.size());
+        buffer->insert(buffer->end(), _metadata.begin(), _metadata.end());
+        buffer->insert(buffer->end(), reinterpret_cast<char const*>(_entries.data()), reinterpret_cast<char const*>(_entries.data() + _entries.size()));
+        buffer->insert(buffer->end(), _values.begin(), _values.end());
+
+        auto snapshot = std::make_shared<QuerySnapshot>();
+        char const* payload = buffer->data();
+        std::size_t payloadSize = buffer->size();
+
+        if (!snapshot->Parse(std::move(buffer), payload, payloadSize, _fieldCount, rowCount))
+            return nullptr;
+
+        return snapshot;
+    }
+
+private:
+    uint32 _fieldCount;
+    std::vector<char> _metadata;
+    std::vector<ValueEntry> _entries;
+    std::vector<char> _values;
+};
+
+std::shared_ptr<QuerySnapshot> QuerySnapshot::Record(ResultSet& result)
+{
+    uint32 fieldCount = result.GetFieldCount();
+    uint64 rowCount = result.GetRowCount();
+
+    Builder builder(fieldCount, rowCount);
+    for (uint32 i = 0; i < fieldCount; ++i)
+        builder.AddField(result.GetFieldMetadata(i));
+
+    // the result is already positioned on its first row, like every QueryResult handed out by a pool
+    if (rowCount)
+    {
+        do
+        {
+            Field* fields = result.Fetch();
+            for (uint32 i = 0; i < fieldCount; ++i)
+                builder.AddValue(fields[i].data.value, fields[i].data.length);
+        } while (result.NextRow());
+    }
+
+    return builder.Finish();
+}
+
+std::shared_ptr<QuerySnapshot> QuerySnapshot::Create(std::vector<QueryResultFieldMetadata> const& fieldMetadata, std::vector<std::vector<Optional<std::string>>> const& rows)
+{
+    Builder builder(uint32(fieldMetadata.size()), rows.size());
+    for (QueryResultFieldMetadata const& meta : fieldMetadata)
+        builder.AddField(meta);
+
+    for (std::vector<Optional<std::string>> const& row : rows)
+    {
+        ASSERT(row.size() == fieldMetadata.size());
+        for (Optional<std::string> const& value : row)
+            builder.AddValue(value ? value->c_str() : nullptr, value ? uint32(value->size()) : 0);
+    }
+
+    return builder.Finish();
+}
+
+std::shared_ptr<QuerySnapshot> QuerySnapshot::Open(std::string const& fileName, std::string_view sql, std::string_view versionKey)
+{
+    std::error_code error;
+    if (!std::filesystem::exists(fileName, error) || std::filesystem::file_size(fileName, error) < sizeof(SnapshotHeader))
+        return nullptr;
+
+    auto mapping = std::make_shared<boost::iostreams::mapped_file_source>();
+
+    try
+    {
+        mapping->open(fileName);
+    }
+    catch (std::exception const& e)
+    {
+        LOG_WARN("sql.snapshot", "Could not map query snapshot {}: {}", fileName, e.what());
+        return nullptr;
+    }
+
+    SnapshotHeader header;
+    std::memcpy(&header, mapping->data(), sizeof(header));
+
+    if (std::memcmp(header.Magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) || header.FormatVersion != SNAPSHOT_FORMAT_VERSION)
+        return nullptr;
+
+    if (header.SqlDigest != Acore::Crypto::SHA1::GetDigestOf(sql) || header.VersionKeyDigest != Acore::Crypto::SHA1::GetDigestOf(versionKey))
+        return nullptr;
+
+    if (header.PayloadSize != mapping->size() - sizeof(SnapshotHeader))
+        return nullptr;
+
+    char const* payload = mapping->data() + sizeof(SnapshotHeader);
+    if (header.PayloadDigest != Acore::Crypto::SHA1::GetDigestOf(reinterpret_cast<uint8 const*>(payload), header.PayloadSize))
+    {
+        LOG_WARN("sql.snapshot", "Query snapshot {} is corrupt, ignored", fileName);
+        return nullptr;
+    }
+
+    auto snapshot = std::make_shared<QuerySnapshot>();
+    if (!snapshot->Parse(std::move(mapping), payload, header.PayloadSize, header.FieldCount, header.RowCount))
+    {
+        LOG_WARN("sql.snapshot", "Query snapshot {} is malformed, ignored", fileName);
+        return nullptr;
+    }
+
+    return snapshot;
+}
+
+bool QuerySnapshot::Parse(std::shared_ptr<void> storage, char const* payload, std::size_t payloadSize, uint32 fieldCount, uint64 rowCount)
+{
+    char const* pos = payload;
+    char const* end = payload + payloadSize;
+
+    _fieldMetadata.resize(fieldCount);
+    for (uint32 i = 0; i < fieldCount; ++i)
+    {
+        QueryResultFieldMetadata& meta = _fieldMetadata[i];
+
+        if (pos >= end)
+            return false;
+
+        meta.Type = DatabaseFieldTypes(*pos++);
+        meta.Index = i;
+
+        for (std::string* str : { &meta.TableName, &meta.TableAlias, &meta.Name, &meta.Alias, &meta.TypeName })
+            if (!(pos = ReadString(pos, end, *str)))
+                return false;
+    }
+
+    std::size_t metadataSize = AlignedSize(pos - payload);
+    std::size_t entriesSize = std::size_t(rowCount) * fieldCount * sizeof(ValueEntry);
+    if (metadataSize + entriesSize > payloadSize)
+        return false;
+
+    _rowCount = rowCount;
+    _storage = std::move(storage);
+    _payload = payload;
+    _payloadSize = payloadSize;
+    _entries = reinterpret_cast<ValueEntry const*>(payload + metadataSize);
+    _values = payload + metadataSize + entriesSize;
+    _valuesSize = payloadSize - metadataSize - entriesSize;
+
+    for (std::size_t i = 0; i < std::size_t(rowCount) * fieldCount; ++i)
+        if (_entries[i].Offset != NULL_VALUE && std::size_t(_entries[i].Offset) + _entries[i].Length >= _valuesSize)
+            return false;
+
+    return true;
+}
+
+bool QuerySnapshot::Write(std::string const& fileName, std::string_view sql, std::string_view versionKey) const
+{
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.Magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.FormatVersion = SNAPSHOT_FORMAT_VERSION;
+    header.SqlDigest = Acore::Crypto::SHA1::GetDigestOf(sql);
+    header.VersionKeyDigest = Acore::Crypto::SHA1::GetDigestOf(versionKey);
+    header.PayloadDigest = Acore::Crypto::SHA1::GetDigestOf(reinterpret_cast<uint8 const*>(_payload), _payloadSize);
+    header.FieldCount = GetFieldCount();
+    header.RowCount = _rowCount;
+    header.PayloadSize = _payloadSize;
+
+    // written next to the target and renamed, a server starting concurrently never maps a partial file
+    std::string tempFileName = fileName + ".tmp";
+
+    {
+        std::ofstream file(tempFileName, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return false;
+
+        file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        file.write(_payload, _payloadSize);
+
+        if (!file)
+            return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempFileName, fileName, error);
+    return !error;
+}
+
+QueryResultFieldMetadata const& QuerySnapshot::GetFieldMetadata(uint32 index) const
+{
+    ASSERT(index < _fieldMetadata.size());
+    return _fieldMetadata[index];
+}
+
+std::pair<char const*, uint32> QuerySnapshot::GetValue(uint64 row, uint32 field) const
+{
+    ValueEntry const& entry = _entries[row * _fieldMetadata.size() + field];
+    if (entry.Offset == NULL_VALUE)
+        return { nullptr, 0 };
+
+    return { _values + entry.Offset, entry.Length };
+}
+
+WorldDatabaseSnapshot* WorldDatabaseSnapshot::instance()
+{
+    static WorldDatabaseSnapshot instance;
+    return &instance;
+}
+
+void WorldDatabaseSnapshot::Initialize(std::string directory, std::string versionKey)
+{
+    _directory = std::move(directory);
+    _versionKey = std::move(versionKey);
+    _enabled = false;
+
+    if (_directory.empty())
+        return;
+
+    std::error_code error;
+    std::filesystem::create_directories(_directory, error);
+    if (error)
+    {
+        LOG_ERROR("sql.snapshot", "Could not create query snapshot directory {}: {}, snapshots disabled", _directory, error.message());
+        _directory.clear();
+        return;
+    }
+
+    _enabled = true;
+}
+
+std::string WorldDatabaseSnapshot::GetFileName(std::string_view sql) const
+{
+    return (std::filesystem::path(_directory) / (ByteArrayToHexStr(Acore::Crypto::SHA1::GetDigestOf(sql)) + ".qsnp")).string();
+}
+
+QueryResult WorldDatabaseSnapshot::Query(std::string_view sql)
+{
+    if (!_enabled)
+        return WorldDatabase.Query(sql);
+
+    std::string query(sql);
+    bool written;
+
+    {
+        std::lock_guard<std::mutex> guard(_queriesLock);
+        auto itr = _queries.find(query);
+        if (itr == _queries.end())
+            itr = _queries.emplace(query, SnapshotQuery{ GetTablesReadBy(query) }).first;
+
+        written = IsWritten(itr->second);
+    }
+
+    // a table written earlier in this startup (e.g. a default config row inserted by a loader) invalidates the snapshot too
+    if (!written)
+    {
+        if (std::shared_ptr<QuerySnapshot> snapshot = QuerySnapshot::Open(GetFileName(query), query, _versionKey))
+        {
+            ++_hits;
+
+            QueryResult result = std::make_shared<ResultSet>(std::move(snapshot));
+            if (!result->GetRowCount() || !result->NextRow())
+                return QueryResult(nullptr);
+
+            return result;
+        }
+    }
+
+    ++_misses;
+    return QueryAndRecord(query);
+}
+
+QueryResult WorldDatabaseSnapshot::QueryAndRecord(std::string const& sql)
+{
+    auto getWrites = [&]()
+    {
+        std::lock_guard<std::mutex> guard(_queriesLock);
+        auto itr = _queries.find(sql);
+        return itr != _queries.end() ? itr->second.Writes : 0;
+    };
+
+    uint32 writes = getWrites();
+
+    QueryResult result = WorldDatabase.Query(sql);
+
+    // empty results are recorded too, a missing file would send the query to the server on every startup
+    std::shared_ptr<QuerySnapshot> snapshot;
+    if (result)
+        snapshot = QuerySnapshot::Record(*result);
+    else
+        snapshot = std::make_shared<QuerySnapshot>();
+
+    if (!snapshot)
+        return WorldDatabase.Query(sql);
+
+    std::string fileName = GetFileName(sql);
+    if (!snapshot->Write(fileName, sql, _versionKey))
+        LOG_WARN("sql.snapshot", "Could not write query snapshot {}", fileName);
+
+    // a table written while the query ran may not be part of the result, the next startup has to read it again
+    if (getWrites() != writes)
+    {
+        std::error_code error;
+        std::filesystem::remove(fileName, error);
+    }
+
+    if (!snapshot->GetRowCount())
+        return QueryResult(nullptr);
+
+    // the server result was consumed while recording, hand out the recorded copy instead
+    result = std::make_shared<ResultSet>(std::move(snapshot));
+    if (!result->NextRow())
+        return QueryResult(nullptr);
+
+    return result;
+}
+
+bool WorldDatabaseSnapshot::IsWritten(SnapshotQuery const& query) const
+{
+    if (_writtenTables.empty())
+        return false;
+
+    if (query.Tables.empty() || _writtenTables.count(std::string_view()))
+        return true;
+
+    for (std::string const& table : query.Tables)
+        if (_writtenTables.count(table))
+            return true;
+
+    return false;
+}
+
+void WorldDatabaseSnapshot::OnStatementExecuted(std::string_view sql)
+{
+    if (_directory.empty())
+        return;
+
+    std::optional<std::string> table = GetTableWrittenBy(sql);
+    if (!table)
+        return;
+
+    std::vector<std::string> fileNames;
+
+    {
+        std::lock_guard<std::mutex> guard(_queriesLock);
+        _writtenTables.insert(*table);
+
+        for (auto& [query, snapshotQuery] : _queries)
+        {
+            if (!table->empty() && !snapshotQuery.Tables.empty() &&
+                !std::binary_search(snapshotQuery.Tables.begin(), snapshotQuery.Tables.end(), *table))
+                continue;
+
+            ++snapshotQuery.Writes;
+            fileNames.push_back(GetFileName(query));
+        }
+    }
+
+    for (std::string const& fileName : fileNames)
+    {
+        std::error_code error;
+        std::filesystem::remove(fileName, error);
+    }
+
+    if (!fileNames.empty())
+        LOG_DEBUG("sql.snapshot", "Dropped {} query snapshots reading {}", fileNames.size(), table->empty() ? "an unknown table" : *table);
+}
+
+uint32 WorldDatabaseSnapshot::StartRebuild()
+{
+    if (_directory.empty() || _rebuilding.exchange(true))
+        return 0;
+
+    std::vector<std::string> queries;
+
+    {
+        std::lock_guard<std::mutex> guard(_queriesLock);
+        queries.reserve(_queries.size());
+        for (auto const& [query, snapshotQuery] : _queries)
+            queries.push_back(query);
+    }
+
+    if (_rebuildThread.joinable())
+        _rebuildThread.join();
+
+    uint32 count = uint32(queries.size());
+    _rebuildThread = std::thread(&WorldDatabaseSnapshot::Rebuild, this, std::move(queries));
+    return count;
+}
+
+void WorldDatabaseSnapshot::Rebuild(std::vector<std::string> queries)
+{
+    uint32 oldMSTime = getMSTime();
+
+    for (std::string const& sql : queries)
+        QueryAndRecord(sql);
+
+    LOG_INFO("sql.snapshot", "Rewrote {} world database query snapshots in {} ms", queries.size(), GetMSTimeDiffToNow(oldMSTime));
+    _rebuilding = false;
+}
+
+void WorldDatabaseSnapshot::WaitForRebuild()
+{
+    if (_rebuildThread.joinable())
+        _rebuildThread.join();
+}
+
+WorldDatabaseSnapshot::~WorldDatabaseSnapshot()
+{
+    WaitForRebuild();
+}
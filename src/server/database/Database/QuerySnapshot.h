@@ -0,0 +1,170 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _QUERY_SNAPSHOT_H
+#define _QUERY_SNAPSHOT_H
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "Field.h"
+#include "Optional.h"
+#include "StringFormat.h"
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+    @class QuerySnapshot
+
+    @brief Result set of an ad hoc query stored in a binary file.
+
+    Values are kept in the text form the server sent them in, so a ResultSet built on a snapshot
+    converts them exactly like one read from the server. Snapshot files are memory mapped and
+    fields point straight into the mapping.
+*/
+class AC_DATABASE_API QuerySnapshot
+{
+public:
+    // reads the result set, the returned snapshot no longer depends on it
+    static std::shared_ptr<QuerySnapshot> Record(ResultSet& result);
+    // rows of values in their text form, one per field; std::nullopt is NULL
+    static std::shared_ptr<QuerySnapshot> Create(std::vector<QueryResultFieldMetadata> const& fieldMetadata, std::vector<std::vector<Optional<std::string>>> const& rows);
+    // nullptr if the file is missing, corrupt or was written for another query or database version
+    static std::shared_ptr<QuerySnapshot> Open(std::string const& fileName, std::string_view sql, std::string_view versionKey);
+
+    bool Write(std::string const& fileName, std::string_view sql, std::string_view versionKey) const;
+
+    [[nodiscard]] uint64 GetRowCount() const { return _rowCount; }
+    [[nodiscard]] uint32 GetFieldCount() const { return uint32(_fieldMetadata.size()); }
+    [[nodiscard]] QueryResultFieldMetadata const& GetFieldMetadata(uint32 index) const;
+    // value and length as passed to Field::SetStructuredValue, value is nullptr for NULL
+    [[nodiscard]] std::pair<char const*, uint32> GetValue(uint64 row, uint32 field) const;
+
+private:
+    class Builder;
+
+    struct ValueEntry
+    {
+        uint32 Offset;
+        uint32 Length;
+    };
+
+    static constexpr uint32 NULL_VALUE = 0xFFFFFFFF;
+
+    // payload layout: field metadata, padded to 8 bytes, one ValueEntry per row and field, then the NUL terminated values
+    bool Parse(std::shared_ptr<void> storage, char const* payload, std::size_t payloadSize, uint32 fieldCount, uint64 rowCount);
+
+    std::vector<QueryResultFieldMetadata> _fieldMetadata;
+    uint64 _rowCount = 0;
+
+    // either an owned buffer (recorded) or a file mapping (opened)
+    std::shared_ptr<void> _storage;
+    char const* _payload = nullptr;
+    std::size_t _payloadSize = 0;
+    ValueEntry const* _entries = nullptr;
+    char const* _values = nullptr;
+    std::size_t _valuesSize = 0;
+};
+
+/**
+    @class WorldDatabaseSnapshot
+
+    @brief Serves world database loader queries from snapshots taken on a previous startup.
+
+    Snapshots are only used while they were written for the same set of applied database updates.
+    Every statement the server executes on the world database drops the snapshots of the queries
+    reading the table it writes, so changes made in game (.npc add, .wp, .disable, ...) are read
+    from the server on the next startup. Tables edited outside the server while it is running need
+    a rebuild. Queries whose snapshot is missing or stale are read from the server and their
+    snapshot is rewritten.
+    Only meant for startup loaders: once disabled, every query goes to the server again, so reload
+    commands always see the current table contents.
+*/
+class AC_DATABASE_API WorldDatabaseSnapshot
+{
+public:
+    static WorldDatabaseSnapshot* instance();
+
+    // empty directory leaves snapshots disabled
+    void Initialize(std::string directory, std::string versionKey);
+    void SetEnabled(bool enabled) { _enabled = enabled && IsConfigured(); }
+    [[nodiscard]] bool IsEnabled() const { return _enabled; }
+    [[nodiscard]] bool IsConfigured() const { return !_directory.empty(); }
+
+    QueryResult Query(std::string_view sql);
+
+    template<typename... Args>
+    QueryResult Query(std::string_view sql, Args&&... args)
+    {
+        if (sql.empty())
+            return QueryResult(nullptr);
+
+        return Query(Acore::StringFormatFmt(sql, std::forward<Args>(args)...));
+    }
+
+    // called by the world database connections for every statement they executed, on their own thread
+    void OnStatementExecuted(std::string_view sql);
+
+    // rereads every query served through the snapshot since startup from the server and rewrites its file
+    // on a background thread, returns the number of queries or 0 if a rebuild is already running
+    uint32 StartRebuild();
+    // blocks until a running rebuild is done, must be called before the world database is closed
+    void WaitForRebuild();
+    [[nodiscard]] bool IsRebuilding() const { return _rebuilding; }
+
+    [[nodiscard]] uint32 GetHits() const { return _hits; }
+    [[nodiscard]] uint32 GetMisses() const { return _misses; }
+
+private:
+    struct SnapshotQuery
+    {
+        std::vector<std::string> Tables; // tables the query reads, empty if they could not be told
+        uint32 Writes = 0;               // statements executed on those tables since startup
+    };
+
+    WorldDatabaseSnapshot() = default;
+    ~WorldDatabaseSnapshot();
+
+    [[nodiscard]] std::string GetFileName(std::string_view sql) const;
+    QueryResult QueryAndRecord(std::string const& sql);
+    [[nodiscard]] bool IsWritten(SnapshotQuery const& query) const;
+    void Rebuild(std::vector<std::string> queries);
+
+    std::string _directory;
+    std::string _versionKey;
+    std::atomic<bool> _enabled = false;
+    std::atomic<uint32> _hits = 0;
+    std::atomic<uint32> _misses = 0;
+
+    std::mutex _queriesLock;
+    std::map<std::string, SnapshotQuery, std::less<>> _queries;
+    std::set<std::string, std::less<>> _writtenTables; // an empty name stands for a statement whose table could not be told
+
+    std::thread _rebuildThread;
+    std::atomic<bool> _rebuilding = false;
+};
+
+#define sWorldDatabaseSnapshot WorldDatabaseSnapshot::instance()
+
+#endif
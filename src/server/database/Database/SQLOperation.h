@@ -53,7 +53,11 @@ public:
     virtual bool Execute() = 0;
     virtual void SetConnection(MySQLConnection* con) { m_conn = con; }
 
+    //! One-way operations without a result can be grouped with their neighbours into a single transaction by the worker.
+    [[nodiscard]] virtual bool IsBatchable() const { return false; }
+
     MySQLConnection* m_conn{nullptr};
+    uint32 m_queuedTime{0}; //! getMSTime() when the operation was enqueued, for latency stats
 
 private:
     SQLOperation(SQLOperation const& right) = delete;
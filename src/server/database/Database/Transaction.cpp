@@ -21,6 +21,7 @@
 #include "MySQLConnection.h"
 #include "PreparedStatement.h"
 #include "Timer.h"
+#include <errmsg.h>
 #include <mysqld_error.h>
 #include <sstream>
 #include <thread>
@@ -100,6 +101,16 @@ bool TransactionTask::Execute()
     if (!errorCode)
         return true;
 
+    //! The connection was lost before the commit, none of the statements was applied
+    if (errorCode == CR_SERVER_LOST)
+    {
+        LOG_WARN("sql.sql", "SQL Transaction interrupted by a reconnect, retrying.");
+        errorCode = TryExecute();
+
+        if (!errorCode)
+            return true;
+    }
+
     if (errorCode == ER_LOCK_DEADLOCK)
     {
         std::ostringstream threadIdStream;
@@ -147,6 +158,19 @@ bool TransactionWithResultTask::Execute()
         return true;
     }
 
+    //! The connection was lost before the commit, none of the statements was applied
+    if (errorCode == CR_SERVER_LOST)
+    {
+        LOG_WARN("sql.sql", "SQL Transaction interrupted by a reconnect, retrying.");
+        errorCode = TryExecute();
+
+        if (!errorCode)
+        {
+            m_result.set_value(true);
+            return true;
+        }
+    }
+
     if (errorCode == ER_LOCK_DEADLOCK)
     {
         std::ostringstream threadIdStream;
@@ -79,6 +79,9 @@ public:
     static bool Update(DatabaseWorkerPool<T>& pool, std::vector<std::string> const* setDirectories);
     static bool Populate(DatabaseWorkerPool<T>& pool);
 
+    // digest over the names and hashes of all applied updates, changes whenever an update is applied
+    static std::string GetAppliedUpdatesHash(DatabaseWorkerPool<T>& pool);
+
     // module
     static std::string GetDBModuleName();
 
@@ -156,6 +156,7 @@ public:
 
     GameObject* FindGameObjectNear(WorldObject* searchObject, ObjectGuid::LowType guid) const
     {
+        auto guard = searchObject->GetMap()->LockObjectStoresForRead();
         auto bounds = searchObject->GetMap()->GetGameObjectBySpawnIdStore().equal_range(guid);
         if (bounds.first == bounds.second)
             return nullptr;
@@ -165,6 +166,7 @@ public:
 
     Creature* FindCreatureNear(WorldObject* searchObject, ObjectGuid::LowType guid) const
     {
+        auto guard = searchObject->GetMap()->LockObjectStoresForRead();
         auto bounds = searchObject->GetMap()->GetCreatureBySpawnIdStore().equal_range(guid);
         if (bounds.first == bounds.second)
             return nullptr;
@@ -13,6 +13,9 @@ AnticheatData::AnticheatData()
     average = 0;
     creationTime = 0;
     hasDailyReport = false;
+    reportsChanged = false;
+    ackUpdateTimer = 4000;
+    pendingOperations = 0;
 }
 
 AnticheatData::~AnticheatData()
@@ -49,7 +52,7 @@ const MovementInfo& AnticheatData::GetLastMovementInfo() const
     return lastMovementInfo;
 }
 
-void AnticheatData::SetLastMovementInfo(MovementInfo& moveInfo)
+void AnticheatData::SetLastMovementInfo(MovementInfo const& moveInfo)
 {
     lastMovementInfo = moveInfo;
 }
@@ -112,4 +115,51 @@ void AnticheatData::SetTempReportsTimer(uint32 time, uint8 type)
 uint32 AnticheatData::GetTempReportsTimer(uint8 type)
 {
     return tempReportsTimer[type];
-}
\ No newline at end of file
+}
+
+void AnticheatData::SetReportsChanged(bool changed)
+{
+    reportsChanged = changed;
+}
+
+bool AnticheatData::HasReportsChanged() const
+{
+    return reportsChanged;
+}
+
+void AnticheatData::SetAckUpdateTimer(uint32 timer)
+{
+    ackUpdateTimer = timer;
+}
+
+uint32 AnticheatData::GetAckUpdateTimer() const
+{
+    return ackUpdateTimer;
+}
+
+void AnticheatData::ResetReports()
+{
+    totalReports = 0;
+    average = 0;
+    creationTime = 0;
+    for (uint8 i = 0; i < MAX_REPORT_TYPES; i++)
+    {
+        typeReports[i] = 0;
+        tempReports[i] = 0;
+        tempReportsTimer[i] = 0;
+    }
+    reportsChanged = false;
+}
+
+void AnticheatData::AddPendingOperation(AnticheatPendingOperation operation)
+{
+    pendingOperations |= operation;
+}
+
+uint8 AnticheatData::TakePendingOperations()
+{
+    if (!pendingOperations.load(std::memory_order_relaxed))
+        return 0;
+
+    return pendingOperations.exchange(0);
+}
@@ -1,11 +1,21 @@
 #ifndef SC_ACDATA_H
 #define SC_ACDATA_H
 
-#include "AnticheatMgr.h"
-#include "Player.h"
+#include "Define.h"
+#include "Object.h"
+#include <atomic>
 
 #define MAX_REPORT_TYPES 15
 
+// Requested by commands for players updated on another thread, run by the player's own update
+enum AnticheatPendingOperation : uint8
+{
+    ANTICHEAT_PENDING_SAVE  = 0x01,                         // write the reports to players_reports_status
+    ANTICHEAT_PENDING_RESET = 0x02                          // clear the reports and delete the stored ones
+};
+
+// Per player anticheat state, owned by the Player so that detectors only touch
+// data of the map thread currently updating that player.
 class AnticheatData
 {
 public:
@@ -16,7 +26,7 @@ public:
     uint32 GetLastOpcode() const;
 
     const MovementInfo& GetLastMovementInfo() const;
-    void SetLastMovementInfo(MovementInfo& moveInfo);
+    void SetLastMovementInfo(MovementInfo const& moveInfo);
 
     void SetPosition(float x, float y, float z, float o);
 
@@ -40,6 +50,19 @@ public:
 
     void SetDailyReportState(bool b);
     bool GetDailyReportState();
+
+    // Reports added since the last time the data was written to players_reports_status
+    void SetReportsChanged(bool changed);
+    bool HasReportsChanged() const;
+
+    void SetAckUpdateTimer(uint32 timer);
+    uint32 GetAckUpdateTimer() const;
+
+    void ResetReports();
+
+    // the only members that may be used from any thread
+    void AddPendingOperation(AnticheatPendingOperation operation);
+    uint8 TakePendingOperations();
 private:
     uint32 lastOpcode;
     MovementInfo lastMovementInfo;
@@ -50,6 +73,9 @@ private:
     uint32 tempReports[MAX_REPORT_TYPES];
     uint32 tempReportsTimer[MAX_REPORT_TYPES];
     bool hasDailyReport;
+    bool reportsChanged;
+    uint32 ackUpdateTimer;
+    std::atomic<uint8> pendingOperations;
 };
 
 #endif
\ No newline at end of file
@@ -70,7 +70,6 @@ AnticheatMgr::AnticheatMgr()
 
 AnticheatMgr::~AnticheatMgr()
 {
-    m_Players.clear();
 }
 
 void AnticheatMgr::LoadBlockedLuaFunctions()
@@ -171,8 +170,12 @@ bool AnticheatMgr::CheckBlockedLuaFunctions(AccountData accountData[NUM_ACCOUNT_
     return false;
 }
 
-void AnticheatMgr::StartHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode)
+void AnticheatMgr::StartHackDetection(Player* player, AnticheatMoveSample const& sample)
 {
+    MovementInfo const& movementInfo = sample.Movement;
+    uint32 const opcode = sample.Opcode;
+    AnticheatPlayerState const& state = sample.State;
+
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_ENABLE))
         return;
 
@@ -180,12 +183,12 @@ void AnticheatMgr::StartHackDetection(Player* player, MovementInfo movementInfo,
     if (player->IsGameMaster())
         return;
 
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
-    if (player->IsInFlight() || player->GetTransport() || player->GetVehicle())
+    if (state.InFlight || state.OnTransport || state.InVehicle)
     {
-        m_Players[key].SetLastMovementInfo(movementInfo);
-        m_Players[key].SetLastOpcode(opcode);
+        playerData.SetLastMovementInfo(movementInfo);
+        playerData.SetLastOpcode(opcode);
         return;
     }
 
@@ -195,28 +198,28 @@ void AnticheatMgr::StartHackDetection(Player* player, MovementInfo movementInfo,
     // Visit TC: https://discord.com/invite/HPP3wNh for help on the Open Source Anticheat
     // The project compromised of various developers of the open source scene and we hang out there.
     // We would never charge for modules or "lessons"
-    SpeedHackDetection(player, movementInfo);
-    FlyHackDetection(player, movementInfo);
-    TeleportHackDetection(player, movementInfo);
-    JumpHackDetection(player, movementInfo, opcode);
-    TeleportPlaneHackDetection(player, movementInfo, opcode);
-    ClimbHackDetection(player, movementInfo, opcode);
-    IgnoreControlHackDetection(player, movementInfo, opcode);
-    GravityHackDetection(player, movementInfo);
-    if (player->GetLiquidData().Status == LIQUID_MAP_WATER_WALK)
+    SpeedHackDetection(player, movementInfo, state);
+    FlyHackDetection(player, movementInfo, state);
+    TeleportHackDetection(player, movementInfo, state);
+    JumpHackDetection(player, movementInfo, opcode, state);
+    TeleportPlaneHackDetection(player, movementInfo, opcode, state);
+    ClimbHackDetection(player, movementInfo, opcode, state);
+    IgnoreControlHackDetection(player, movementInfo, opcode, state);
+    GravityHackDetection(player, movementInfo, state);
+    if (state.Liquid == LIQUID_MAP_WATER_WALK)
     {
-        WalkOnWaterHackDetection(player, movementInfo);
+        WalkOnWaterHackDetection(player, movementInfo, state);
     }
     else
     {
-        ZAxisHackDetection(player, movementInfo);
+        ZAxisHackDetection(player, movementInfo, state);
     }
-    if (player->GetLiquidData().Status == LIQUID_MAP_UNDER_WATER)
+    if (state.Liquid == LIQUID_MAP_UNDER_WATER)
     {
-        AntiSwimHackDetection(player, movementInfo, opcode);
+        AntiSwimHackDetection(player, movementInfo, opcode, state);
     }
     AntiKnockBackHackDetection(player, movementInfo);
-    NoFallDamageDetection(player, movementInfo);
+    NoFallDamageDetection(player, movementInfo, state);
     if (Battleground* bg = player->GetBattleground())
     {
         if (bg->GetStatus() == STATUS_WAIT_JOIN)
@@ -224,16 +227,16 @@ void AnticheatMgr::StartHackDetection(Player* player, MovementInfo movementInfo,
             BGStartExploit(player, movementInfo);
         }
     }
-    m_Players[key].SetLastMovementInfo(movementInfo);
-    m_Players[key].SetLastOpcode(opcode);
+    playerData.SetLastMovementInfo(movementInfo);
+    playerData.SetLastOpcode(opcode);
 }
 
-void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_SPEEDHACK_ENABLE))
         return;
 
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
     // The anticheat is disabled on transports, so we need to be sure that the player is indeed on a transport.
     GameObject* transportGobj = player->GetMap()->GetGameObject(movementInfo.transport.guid);
@@ -248,7 +251,7 @@ void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo movementInfo)
     }
 
     // sometimes I believe the compiler ignores all my comments
-    uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&m_Players[key].GetLastMovementInfo().pos);
+    uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&playerData.GetLastMovementInfo().pos);
 
     // We don't need to check for a speedhack if the player hasn't moved
     // This is necessary since MovementHandler fires if you rotate the camera in place
@@ -259,11 +262,11 @@ void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo movementInfo)
 
     // we need to know HOW is the player moving
     // TO-DO: Should we check the incoming movement flags?
-    if (player->HasUnitMovementFlag(MOVEMENTFLAG_SWIMMING))
+    if (state.HasMovementFlag(MOVEMENTFLAG_SWIMMING))
         moveType = MOVE_SWIM;
-    else if (player->IsFlying())
+    else if (state.Flying)
         moveType = MOVE_FLIGHT;
-    else if (player->HasUnitMovementFlag(MOVEMENTFLAG_WALKING))
+    else if (state.HasMovementFlag(MOVEMENTFLAG_WALKING))
         moveType = MOVE_WALK;
     else
         moveType = MOVE_RUN;
@@ -273,7 +276,7 @@ void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo movementInfo)
     uint32 speedRate = (uint32)(player->GetSpeed(UnitMoveType(moveType)));
 
     // how long the player took to move to here.
-    uint32 timeDiff = getMSTimeDiff(m_Players[key].GetLastMovementInfo().time, movementInfo.time);
+    uint32 timeDiff = getMSTimeDiff(playerData.GetLastMovementInfo().time, movementInfo.time);
 
     // Ah ah ah! You'll never understand why this one works. Or will you?
     // This covers packet manipulation
@@ -282,8 +285,7 @@ void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo movementInfo)
         if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_WRITELOG))
         {
             uint32 latency = player->GetSession()->GetLatency();
-            std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-            LOG_INFO("anticheat", "AnticheatMgr:: Time Manipulation - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+            LOG_INFO("anticheat", "AnticheatMgr:: Time Manipulation - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
         }
         if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_ALERTSCREEN))
         {   // display warning at the center of the screen, hacky way?
@@ -305,8 +307,7 @@ void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo movementInfo)
     {
         if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_WRITELOG))
         {
-            std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-            LOG_INFO("anticheat", "ANTICHEAT COUNTER MEASURE:: {} Time Diff Corrected(Map: {}) (possible Zero Time Manipulation) - Flagged at: {}", player->GetName(), player->GetMapId(), goXYZ);
+            LOG_INFO("anticheat", "ANTICHEAT COUNTER MEASURE:: {} Time Diff Corrected(Map: {}) (possible Zero Time Manipulation) - Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetMapId(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
         }
         if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_ALERTSCREEN))
         {   // display warning at the center of the screen, hacky way?
@@ -331,11 +332,11 @@ void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo movementInfo)
 
     // create a conf to establish a speed limit tolerance over server rate set speed
     // this is done so we can ignore minor violations that are not false positives such as going 1 or 2 over the speed limit
-    _assignedspeeddiff = sWorld->getIntConfig(CONFIG_ANTICHEAT_SPEED_LIMIT_TOLERANCE);
+    uint32 assignedSpeedDiff = sWorld->getIntConfig(CONFIG_ANTICHEAT_SPEED_LIMIT_TOLERANCE);
 
     // We did the (uint32) cast to accept a margin of tolerance for seasonal spells and buffs such as sugar rush
     // We check the last MovementInfo for the falling flag since falling down a hill and sliding a bit triggered a false positive
-    if ((clientSpeedRate >= _assignedspeeddiff + speedRate) && !m_Players[key].GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_FALLING))
+    if ((clientSpeedRate >= assignedSpeedDiff + speedRate) && !playerData.GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_FALLING))
     {
 
         if (!player->CanTeleport())
@@ -344,8 +345,7 @@ void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo movementInfo)
             {
                 uint32 latency = 0;
                 latency = player->GetSession()->GetLatency();
-                std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                LOG_INFO("anticheat", "AnticheatMgr:: Speed-Hack (Speed Movement at {} above allowed Server Set rate {}.) detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", clientSpeedRate, speedRate, player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+                LOG_INFO("anticheat", "AnticheatMgr:: Speed-Hack (Speed Movement at {} above allowed Server Set rate {}.) detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", clientSpeedRate, speedRate, player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
             }
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_SPEEDHACK))
             {
@@ -356,8 +356,7 @@ void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo movementInfo)
                 BuildReport(player, SPEED_HACK_REPORT);
                 if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_WRITELOG))
                 {
-                    std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                    LOG_INFO("anticheat.module", "ANTICHEAT COUNTER MEASURE:: {} Speed Hack Countered and has been set to Server Rate - Flagged at: {}", player->GetName(), goXYZ);
+                    LOG_INFO("anticheat.module", "ANTICHEAT COUNTER MEASURE:: {} Speed Hack Countered and has been set to Server Rate - Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
                 }
                 if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_ALERTSCREEN))
                 {   // display warning at the center of the screen, hacky way?
@@ -379,15 +378,15 @@ void AnticheatMgr::SpeedHackDetection(Player* player, MovementInfo movementInfo)
     }
 }
 
-void AnticheatMgr::FlyHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::FlyHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_FLYHACK_ENABLE))
         return;
 
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
     //we check to ensure they are not flying
-    if (!m_Players[key].GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_FLYING))
+    if (!playerData.GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_FLYING))
         return;
 
     //we check to see if they have legal flight auras
@@ -401,7 +400,7 @@ void AnticheatMgr::FlyHackDetection(Player* player, MovementInfo movementInfo)
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_FLYHACKSTRICT_ENABLE))
     {// super strict way to check, you can only ascend\descend in water and air, we check u are ascending\descending and not in water.
      // we are not checking for legal flight here because those checks were dont earlier.
-        stricterChecks = !(movementInfo.HasMovementFlag(MOVEMENTFLAG_ASCENDING | MOVEMENTFLAG_DESCENDING) && !player->IsInWater());
+        stricterChecks = !(movementInfo.HasMovementFlag(MOVEMENTFLAG_ASCENDING | MOVEMENTFLAG_DESCENDING) && !state.InWater);
     }
 
     // if you are not flying and not ascending then we do a return, you are then not guilty.
@@ -414,8 +413,7 @@ void AnticheatMgr::FlyHackDetection(Player* player, MovementInfo movementInfo)
     {
         uint32 latency = 0;
         latency = player->GetSession()->GetLatency();
-        std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-        LOG_INFO("anticheat", "AnticheatMgr:: Fly-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+        LOG_INFO("anticheat", "AnticheatMgr:: Fly-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
     }
     if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_FLYHACK))
     {   // display warning at the center of the screen, hacky way?
@@ -439,8 +437,7 @@ void AnticheatMgr::FlyHackDetection(Player* player, MovementInfo movementInfo)
         }
         if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_WRITELOG))
         {
-            std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-            LOG_INFO("anticheat", "ANTICHEAT COUNTER MEASURE:: Fly Hack detected player {} ({}) - SMSG_MOVE_UNSET_CAN_FLY Set - Flagged at: {}", player->GetName(), player->GetGUID().ToString(), goXYZ);
+            LOG_INFO("anticheat", "ANTICHEAT COUNTER MEASURE:: Fly Hack detected player {} ({}) - SMSG_MOVE_UNSET_CAN_FLY Set - Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
         }
         BuildReport(player, COUNTER_MEASURES_REPORT);
     }
@@ -448,13 +445,12 @@ void AnticheatMgr::FlyHackDetection(Player* player, MovementInfo movementInfo)
     BuildReport(player, FLY_HACK_REPORT);
 }
 
-void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo  movementInfo, uint32 opcode)
+void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_JUMPHACK_ENABLE))
         return;
 
-    // we pull the player's individual guid
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
     const float ground_Z = movementInfo.pos.GetPositionZ() - player->GetMapHeight(movementInfo.pos.GetPositionX(), movementInfo.pos.GetPositionY(), movementInfo.pos.GetPositionZ());
 
@@ -462,19 +458,18 @@ void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo  movementInfo,
         || player->HasAuraType(SPELL_AURA_MOD_INCREASE_MOUNTED_FLIGHT_SPEED) || player->HasAuraType(SPELL_AURA_MOD_INCREASE_FLIGHT_SPEED)
         || player->HasAuraType(SPELL_AURA_MOD_MOUNTED_FLIGHT_SPEED_ALWAYS));
     const bool no_fly_flags = ((movementInfo.flags & (MOVEMENTFLAG_CAN_FLY | MOVEMENTFLAG_FLYING)) == 0);
-    const bool no_swim_in_water = !player->IsInWater();
+    const bool no_swim_in_water = !state.InWater;
     const bool no_swim_above_water = movementInfo.pos.GetPositionZ() - 7.0f >= player->GetMap()->GetWaterLevel(movementInfo.pos.GetPositionX(), movementInfo.pos.GetPositionY());
     const bool no_swim_water = no_swim_in_water && no_swim_above_water;
 
     // Chain or double multi jumping is not a thing in 335
-    if (m_Players[key].GetLastOpcode() == MSG_MOVE_JUMP && opcode == MSG_MOVE_JUMP)
+    if (playerData.GetLastOpcode() == MSG_MOVE_JUMP && opcode == MSG_MOVE_JUMP)
     {
         if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_WRITELOG_ENABLE))
         {
             uint32 latency = 0;
             latency = player->GetSession()->GetLatency();
-            std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-            LOG_INFO("anticheat", "AnticheatMgr:: Jump-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+            LOG_INFO("anticheat", "AnticheatMgr:: Jump-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
         }
         if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_JUMPHACK))
         {   // display warning at the center of the screen, hacky way?
@@ -487,8 +482,7 @@ void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo  movementInfo,
 
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_WRITELOG))
             {
-                std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                LOG_INFO("anticheat.module", "ANTICHEAT COUNTER MEASURE:: {} JUMP Hack Countered and has been set to fall - Flagged at: {}", player->GetName(), goXYZ);
+                LOG_INFO("anticheat.module", "ANTICHEAT COUNTER MEASURE:: {} JUMP Hack Countered and has been set to fall - Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
             }
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_ALERTSCREEN))
             {   // display warning at the center of the screen, hacky way?
@@ -511,10 +505,10 @@ void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo  movementInfo,
         if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_ADV_JUMPHACK_ENABLE))
             return;
 
-        if (m_Players[key].GetLastOpcode() == MSG_MOVE_JUMP && !player->IsFalling())
+        if (playerData.GetLastOpcode() == MSG_MOVE_JUMP && !state.Falling)
             return;
 
-        uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&m_Players[key].GetLastMovementInfo().pos);
+        uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&playerData.GetLastMovementInfo().pos);
 
         // This is necessary since MovementHandler fires if you rotate the camera in place
         if (!distance2D)
@@ -528,12 +522,12 @@ void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo  movementInfo,
         }
 
         // The anticheat check is disabled on Elevators, so we need to be sure that the player is indeed on a transport.
-        if (player->HasUnitMovementFlag(MOVEMENTFLAG_ONTRANSPORT))
+        if (state.HasMovementFlag(MOVEMENTFLAG_ONTRANSPORT))
         {
             return;
         }
 
-        if (!player->HasUnitMovementFlag(MOVEMENTFLAG_DISABLE_GRAVITY) && movementInfo.jump.zspeed < -10.0f)
+        if (!state.HasMovementFlag(MOVEMENTFLAG_DISABLE_GRAVITY) && movementInfo.jump.zspeed < -10.0f)
             return;
 
         if (player->HasAuraType(SPELL_AURA_WATER_WALK) || player->HasAuraType(SPELL_AURA_FEATHER_FALL) ||
@@ -552,14 +546,13 @@ void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo  movementInfo,
             }
         }
 
-        if (ground_Z > 5.0f && movementInfo.pos.GetPositionZ() >= player->GetPositionZ())
+        if (ground_Z > 5.0f && movementInfo.pos.GetPositionZ() >= playerData.GetLastMovementInfo().pos.GetPositionZ())
         {
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_WRITELOG_ENABLE))
             {
                 uint32 latency = 0;
                 latency = player->GetSession()->GetLatency();
-                std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                LOG_INFO("anticheat", "AnticheatMgr:: Stricter Jump-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+                LOG_INFO("anticheat", "AnticheatMgr:: Stricter Jump-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
             }
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_ADVJUMPHACK))
             {   // display warning at the center of the screen, hacky way?
@@ -572,8 +565,7 @@ void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo  movementInfo,
 
                 if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_WRITELOG))
                 {
-                    std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                    LOG_INFO("anticheat.module", "ANTICHEAT COUNTER MEASURE:: {} ADVANCE JUMP Hack Countered and has been set to fall - Flagged at: {}", player->GetName(), goXYZ);
+                    LOG_INFO("anticheat.module", "ANTICHEAT COUNTER MEASURE:: {} ADVANCE JUMP Hack Countered and has been set to fall - Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
                 }
                 if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_ALERTSCREEN))
                 {   // display warning at the center of the screen, hacky way?
@@ -594,7 +586,7 @@ void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo  movementInfo,
     }
 }
 
-void AnticheatMgr::TeleportPlaneHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode)
+void AnticheatMgr::TeleportPlaneHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_TELEPANEHACK_ENABLE))
         return;
@@ -602,22 +594,22 @@ void AnticheatMgr::TeleportPlaneHackDetection(Player* player, MovementInfo movem
     if (player->HasAuraType(SPELL_AURA_WATER_WALK) || player->HasAuraType(SPELL_AURA_WATER_BREATHING) || player->HasAuraType(SPELL_AURA_GHOST))
         return;
 
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
-    uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&m_Players[key].GetLastMovementInfo().pos);
+    uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&playerData.GetLastMovementInfo().pos);
 
     // We don't need to check for a water walking hack if the player hasn't moved
     // This is necessary since MovementHandler fires if you rotate the camera in place
     if (!distance2D)
         return;
 
-    if (m_Players[key].GetLastOpcode() == MSG_MOVE_JUMP)
+    if (playerData.GetLastOpcode() == MSG_MOVE_JUMP)
         return;
 
     if (opcode == (MSG_MOVE_FALL_LAND))
         return;
 
-    if (player->GetLiquidData().Status == LIQUID_MAP_ABOVE_WATER)
+    if (state.Liquid == LIQUID_MAP_ABOVE_WATER)
         return;
 
     if (movementInfo.HasMovementFlag(MOVEMENTFLAG_FALLING | MOVEMENTFLAG_SWIMMING))
@@ -637,10 +629,10 @@ void AnticheatMgr::TeleportPlaneHackDetection(Player* player, MovementInfo movem
         }
     }
 
-    float pos_z = player->GetPositionZ();
-    float ground_Z = player->GetFloorZ();
-    float groundZ = player->GetMapHeight(player->GetPositionX(), player->GetPositionY(), MAX_HEIGHT);
-    float floorZ = player->GetMapHeight(player->GetPositionX(), player->GetPositionY(), player->GetPositionZ());
+    float pos_z = state.Pos.GetPositionZ();
+    float ground_Z = state.FloorZ;
+    float groundZ = player->GetMapHeight(state.Pos.GetPositionX(), state.Pos.GetPositionY(), MAX_HEIGHT);
+    float floorZ = player->GetMapHeight(state.Pos.GetPositionX(), state.Pos.GetPositionY(), state.Pos.GetPositionZ());
 
     // we are not really walking there
     if (groundZ == floorZ && (fabs(ground_Z - pos_z) > 2.0f || fabs(ground_Z - pos_z) < -1.0f))
@@ -649,23 +641,22 @@ void AnticheatMgr::TeleportPlaneHackDetection(Player* player, MovementInfo movem
         {
             uint32 latency = 0;
             latency = player->GetSession()->GetLatency();
-            std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-            LOG_INFO("anticheat", "AnticheatMgr:: Teleport To Plane - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+            LOG_INFO("anticheat", "AnticheatMgr:: Teleport To Plane - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
         }
         BuildReport(player, TELEPORT_PLANE_HACK_REPORT);
     }
 }
 
 // basic detection
-void AnticheatMgr::ClimbHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode)
+void AnticheatMgr::ClimbHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_CLIMBHACK_ENABLE))
         return;
 
     // in this case we don't care if they are "legal" flags, they are handled in another parts of the Anticheat Manager.
-    if (player->IsInWater() ||
-        player->IsFlying() ||
-        player->IsFalling())
+    if (state.InWater ||
+        state.Flying ||
+        state.Falling)
         return;
 
     // If the player jumped, we dont want to check for climb hack
@@ -673,7 +664,7 @@ void AnticheatMgr::ClimbHackDetection(Player* player, MovementInfo movementInfo,
     if (opcode == MSG_MOVE_JUMP)
         return;
 
-    if (player->HasUnitMovementFlag(MOVEMENTFLAG_FALLING))
+    if (state.HasMovementFlag(MOVEMENTFLAG_FALLING))
         return;
 
     Position playerPos;
@@ -681,7 +672,7 @@ void AnticheatMgr::ClimbHackDetection(Player* player, MovementInfo movementInfo,
     float diffz = fabs(movementInfo.pos.GetPositionZ() - playerPos.GetPositionZ());
     float tanangle = movementInfo.pos.GetExactDist2d(&playerPos) / diffz;
 
-    if (!player->HasUnitMovementFlag(MOVEMENTFLAG_CAN_FLY | MOVEMENTFLAG_FLYING | MOVEMENTFLAG_SWIMMING))
+    if (!state.HasMovementFlag(MOVEMENTFLAG_CAN_FLY | MOVEMENTFLAG_FLYING | MOVEMENTFLAG_SWIMMING))
     {
         if (movementInfo.pos.GetPositionZ() > playerPos.GetPositionZ() &&
             diffz > 1.87f && tanangle < 0.57735026919f) // 30 degrees
@@ -690,8 +681,7 @@ void AnticheatMgr::ClimbHackDetection(Player* player, MovementInfo movementInfo,
             {
                 uint32 latency = 0;
                 latency = player->GetSession()->GetLatency();
-                std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                LOG_INFO("anticheat", "AnticheatMgr:: Climb-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+                LOG_INFO("anticheat", "AnticheatMgr:: Climb-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
             }
 
             BuildReport(player, CLIMB_HACK_REPORT);
@@ -700,26 +690,26 @@ void AnticheatMgr::ClimbHackDetection(Player* player, MovementInfo movementInfo,
 
 }
 
-void AnticheatMgr::TeleportHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::TeleportHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_TELEPORTHACK_ENABLE))
         return;
 
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
-    float lastX = m_Players[key].GetLastMovementInfo().pos.GetPositionX();
+    float lastX = playerData.GetLastMovementInfo().pos.GetPositionX();
     float newX = movementInfo.pos.GetPositionX();
 
-    float lastY = m_Players[key].GetLastMovementInfo().pos.GetPositionY();
+    float lastY = playerData.GetLastMovementInfo().pos.GetPositionY();
     float newY = movementInfo.pos.GetPositionY();
 
-    float lastZ = m_Players[key].GetLastMovementInfo().pos.GetPositionZ();
+    float lastZ = playerData.GetLastMovementInfo().pos.GetPositionZ();
     float newZ = movementInfo.pos.GetPositionZ();
 
     float xDiff = fabs(lastX - newX);
     float yDiff = fabs(lastY - newY);
 
-    if (player->IsFalling() || (player->IsFalling() && player->IsMounted()))
+    if (state.Falling)
         return;
 
     // The anticheat is disabled on transports, so we need to be sure that the player is indeed on a transport.
@@ -747,16 +737,14 @@ void AnticheatMgr::TeleportHackDetection(Player* player, MovementInfo movementIn
             sWorld->SendGlobalGMMessage(&data);
             uint32 latency = 0;
             latency = player->GetSession()->GetLatency();
-            std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
             uint32 latency2 = 0;
             latency2 = opponent->GetSession()->GetLatency();
-            std::string goXYZ2 = ".go xyz " + std::to_string(opponent->GetPositionX()) + " " + std::to_string(opponent->GetPositionY()) + " " + std::to_string(opponent->GetPositionZ() + 1.0f) + " " + std::to_string(opponent->GetMap()->GetId()) + " " + std::to_string(opponent->GetOrientation());
             sWorld->SendGMText(LANG_ANTICHEAT_DUEL, player->GetName().c_str(), latency, opponent->GetName().c_str(), latency2);
 
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_WRITELOG_ENABLE))
             {
-                LOG_INFO("anticheat", "AnticheatMgr:: DUEL ALERT Teleport-Hack detected player {} ({}) while dueling {} - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), opponent->GetName(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
-                LOG_INFO("anticheat", "AnticheatMgr:: DUEL ALERT Teleport-Hack detected player {} ({}) while dueling {} - Latency: {} ms - IP: {} - Cheat Flagged at: {}", opponent->GetName(), opponent->GetGUID().ToString(), player->GetName(), latency2, opponent->GetSession()->GetRemoteAddress(), goXYZ2);
+                LOG_INFO("anticheat", "AnticheatMgr:: DUEL ALERT Teleport-Hack detected player {} ({}) while dueling {} - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), opponent->GetName(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
+                LOG_INFO("anticheat", "AnticheatMgr:: DUEL ALERT Teleport-Hack detected player {} ({}) while dueling {} - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", opponent->GetName(), opponent->GetGUID().ToString(), player->GetName(), latency2, opponent->GetSession()->GetRemoteAddress(), opponent->GetPositionX(), opponent->GetPositionY(), opponent->GetPositionZ() + 1.0f, opponent->GetMap()->GetId(), opponent->GetOrientation());
             }
             BuildReport(player, TELEPORT_HACK_REPORT);
             BuildReport(opponent, TELEPORT_HACK_REPORT);
@@ -767,13 +755,13 @@ void AnticheatMgr::TeleportHackDetection(Player* player, MovementInfo movementIn
     /* Please work */
     if ((xDiff >= 50.0f || yDiff >= 50.0f) && !player->CanTeleport() && !player->IsBeingTeleported())// teleport helpers in play
     {
-        if (m_Players[key].GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORTS_INGAME_NOTIFICATION))
+        if (playerData.GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORTS_INGAME_NOTIFICATION))
         {// we do this because we can not get the collumn count being propper when we add more collumns for the report, so we make a indvidual warning for Teleport Hack
-            _alertFrequency = sWorld->getIntConfig(CONFIG_ANTICHEAT_ALERT_FREQUENCY);
+            uint32 alertFrequency = sWorld->getIntConfig(CONFIG_ANTICHEAT_ALERT_FREQUENCY);
             // So we dont divide by 0 by accident
-            if (_alertFrequency < 1)
-                _alertFrequency = 1;
-            if (++_counter % _alertFrequency == 0)
+            if (alertFrequency < 1)
+                alertFrequency = 1;
+            if (++_counter % alertFrequency == 0)
             {
                 // display warning at the center of the screen, hacky way?
                 std::string str = "|cFFFFFC00[Playername:|cFF00FFFF[|cFF60FF00" + player->GetName() + "|cFF00FFFF] Possible Teleport Hack Detected!";
@@ -783,7 +771,7 @@ void AnticheatMgr::TeleportHackDetection(Player* player, MovementInfo movementIn
                 uint32 latency = 0;
                 latency = player->GetSession()->GetLatency();
                 // need better way to limit chat spam
-                if (m_Players[key].GetTotalReports() >= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MIN) && m_Players[key].GetTotalReports() <= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MAX))
+                if (playerData.GetTotalReports() >= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MIN) && playerData.GetTotalReports() <= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MAX))
                 {
                     sWorld->SendGMText(LANG_ANTICHEAT_TELEPORT, player->GetName().c_str(), latency);
                 }
@@ -794,15 +782,13 @@ void AnticheatMgr::TeleportHackDetection(Player* player, MovementInfo movementIn
         {
             uint32 latency = 0;
             latency = player->GetSession()->GetLatency();
-            std::string goXYZ = ".go xyz " + std::to_string(newX) + " " + std::to_string(newY) + " " + std::to_string(newZ + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-            LOG_INFO("anticheat", "AnticheatMgr:: Teleport-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+            LOG_INFO("anticheat", "AnticheatMgr:: Teleport-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), newX, newY, newZ + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
         }
         if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_TELEPORT))
         {
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_WRITELOG))
             {
-                std::string LastgoXYZ = ".go xyz " + std::to_string(lastX) + " " + std::to_string(lastY) + " " + std::to_string(lastZ + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                LOG_INFO("anticheat", "ANTICHEAT COUNTER MEASURE:: {} TELEPORT HACK REVERTED PLAYER BACK TO {}", player->GetName(), LastgoXYZ);
+                LOG_INFO("anticheat", "ANTICHEAT COUNTER MEASURE:: {} TELEPORT HACK REVERTED PLAYER BACK TO .go xyz {} {} {} {} {}", player->GetName(), lastX, lastY, lastZ + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
             }
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_ALERTSCREEN))
             {   // display warning at the center of the screen, hacky way?
@@ -825,20 +811,20 @@ void AnticheatMgr::TeleportHackDetection(Player* player, MovementInfo movementIn
         player->SetCanTeleport(false);
 }
 
-void AnticheatMgr::IgnoreControlHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode)
+void AnticheatMgr::IgnoreControlHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode, AnticheatPlayerState const& state)
 {
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
-    float lastX = m_Players[key].GetLastMovementInfo().pos.GetPositionX();
+    float lastX = playerData.GetLastMovementInfo().pos.GetPositionX();
     float newX = movementInfo.pos.GetPositionX();
 
-    float lastY = m_Players[key].GetLastMovementInfo().pos.GetPositionY();
+    float lastY = playerData.GetLastMovementInfo().pos.GetPositionY();
     float newY = movementInfo.pos.GetPositionY();
 
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_IGNORECONTROLHACK_ENABLE))
         return;
 
-    if (m_Players[key].GetLastOpcode() == MSG_MOVE_JUMP)
+    if (playerData.GetLastOpcode() == MSG_MOVE_JUMP)
         return;
 
     if (opcode == (MSG_MOVE_FALL_LAND))
@@ -851,18 +837,18 @@ void AnticheatMgr::IgnoreControlHackDetection(Player* player, MovementInfo movem
     latency = player->GetSession()->GetLatency() >= 400;
     //So here we check if hte player has a root state and not in a vehicle
     // except for lag, we can legitimately blame lag for false hits, so we see if they are above 400 then we exempt the check
-    if (player->HasAuraType(SPELL_AURA_MOD_ROOT) && !player->GetVehicle() && !latency)
+    if (player->HasAuraType(SPELL_AURA_MOD_ROOT) && !state.InVehicle && !latency)
     {// Here we check if the x and y position changes while rooted, Nothing moves when rooted, no exception
         bool unrestricted = newX != lastX || newY != lastY;
         if (unrestricted)
         {// we do this because we can not get the collumn count being propper when we add more collumns for the report, so we make a indvidual warning for Ignore Control
-            if (m_Players[key].GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORTS_INGAME_NOTIFICATION))
+            if (playerData.GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORTS_INGAME_NOTIFICATION))
             {
-                _alertFrequency = sWorld->getIntConfig(CONFIG_ANTICHEAT_ALERT_FREQUENCY);
+                uint32 alertFrequency = sWorld->getIntConfig(CONFIG_ANTICHEAT_ALERT_FREQUENCY);
                 // So we dont divide by 0 by accident
-                if (_alertFrequency < 1)
-                    _alertFrequency = 1;
-                if (++_counter % _alertFrequency == 0)
+                if (alertFrequency < 1)
+                    alertFrequency = 1;
+                if (++_counter % alertFrequency == 0)
                 {
                     // display warning at the center of the screen, hacky way?
                     std::string str = "|cFFFFFC00[Playername:|cFF00FFFF[|cFF60FF00" + player->GetName() + "|cFF00FFFF] Possible Ignore Control Hack Detected!";
@@ -872,7 +858,7 @@ void AnticheatMgr::IgnoreControlHackDetection(Player* player, MovementInfo movem
                     uint32 latency = 0;
                     latency = player->GetSession()->GetLatency();
                     // need better way to limit chat spam
-                    if (m_Players[key].GetTotalReports() >= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MIN) && m_Players[key].GetTotalReports() <= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MAX))
+                    if (playerData.GetTotalReports() >= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MIN) && playerData.GetTotalReports() <= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MAX))
                     {
                         sWorld->SendGMText(LANG_ANTICHEAT_IGNORECONTROL, player->GetName().c_str(), latency);
                     }
@@ -883,22 +869,20 @@ void AnticheatMgr::IgnoreControlHackDetection(Player* player, MovementInfo movem
             {
                 uint32 latency = 0;
                 latency = player->GetSession()->GetLatency();
-                std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                LOG_INFO("anticheat", "AnticheatMgr:: Ignore Control - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+                LOG_INFO("anticheat", "AnticheatMgr:: Ignore Control - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
             }
             BuildReport(player, IGNORE_CONTROL_REPORT);
         }
     }
 }
 
-void AnticheatMgr::WalkOnWaterHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::WalkOnWaterHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_WATERWALKHACK_ENABLE))
         return;
 
-    // we pull the player's individual guid
-    uint32 key = player->GetGUID().GetCounter();
-    uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&m_Players[key].GetLastMovementInfo().pos);
+    AnticheatData& playerData = player->GetAnticheatData();
+    uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&playerData.GetLastMovementInfo().pos);
 
     // We don't need to check for a waterwalk hack if the player hasn't moved
     // This is necessary since MovementHandler fires if you rotate the camera in place
@@ -906,16 +890,15 @@ void AnticheatMgr::WalkOnWaterHackDetection(Player* player, MovementInfo movemen
         return;
 
     // if the player is water walking on water then we are good.
-    if (player->GetLiquidData().Status == LIQUID_MAP_WATER_WALK && !player->IsFlying())
+    if (state.Liquid == LIQUID_MAP_WATER_WALK && !state.Flying)
     {
-        if (!m_Players[key].GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_WATERWALKING) && !movementInfo.HasMovementFlag(MOVEMENTFLAG_WATERWALKING))
+        if (!playerData.GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_WATERWALKING) && !movementInfo.HasMovementFlag(MOVEMENTFLAG_WATERWALKING))
         {
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_WRITELOG_ENABLE))
             {
                 uint32 latency = 0;
                 latency = player->GetSession()->GetLatency();
-                std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                LOG_INFO("anticheat", "AnticheatMgr:: Walk on Water - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+                LOG_INFO("anticheat", "AnticheatMgr:: Walk on Water - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
             }
             BuildReport(player, WALK_WATER_HACK_REPORT);
         }
@@ -926,11 +909,11 @@ void AnticheatMgr::WalkOnWaterHackDetection(Player* player, MovementInfo movemen
         return;
 
     // Prevents the False Positive for water walking when you ressurrect.
-    if (m_Players[key].GetLastOpcode() == MSG_DELAY_GHOST_TELEPORT)
+    if (playerData.GetLastOpcode() == MSG_DELAY_GHOST_TELEPORT)
         return;
 
     // if the player previous movement and current movement is water walking then we do a follow up check
-    if (m_Players[key].GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_WATERWALKING) && movementInfo.HasMovementFlag(MOVEMENTFLAG_WATERWALKING))
+    if (playerData.GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_WATERWALKING) && movementInfo.HasMovementFlag(MOVEMENTFLAG_WATERWALKING))
     { // if player has the following auras then we return
         if (player->HasAuraType(SPELL_AURA_WATER_WALK) || player->HasAuraType(SPELL_AURA_FEATHER_FALL) ||
             player->HasAuraType(SPELL_AURA_SAFE_FALL))
@@ -939,7 +922,7 @@ void AnticheatMgr::WalkOnWaterHackDetection(Player* player, MovementInfo movemen
         }
 
     }
-    else if (!m_Players[key].GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_WATERWALKING) && !movementInfo.HasMovementFlag(MOVEMENTFLAG_WATERWALKING))
+    else if (!playerData.GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_WATERWALKING) && !movementInfo.HasMovementFlag(MOVEMENTFLAG_WATERWALKING))
     {
         //Boomer Review Time:
         //Return stops code execution of the entire function
@@ -950,20 +933,19 @@ void AnticheatMgr::WalkOnWaterHackDetection(Player* player, MovementInfo movemen
     {
         uint32 latency = 0;
         latency = player->GetSession()->GetLatency();
-        std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-        LOG_INFO("anticheat", "AnticheatMgr:: Walk on Water - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+        LOG_INFO("anticheat", "AnticheatMgr:: Walk on Water - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
     }
     BuildReport(player, WALK_WATER_HACK_REPORT);
 
 }
 
-void AnticheatMgr::ZAxisHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::ZAxisHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_ZAXISHACK_ENABLE))
         return;
 
-   uint32 key = player->GetGUID().GetCounter();
-   uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&m_Players[key].GetLastMovementInfo().pos);
+   AnticheatData& playerData = player->GetAnticheatData();
+   uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&playerData.GetLastMovementInfo().pos);
 
    // We don't need to check for a waterwalk hack if the player hasn't moved
    // This is necessary since MovementHandler fires if you rotate the camera in place
@@ -976,12 +958,12 @@ void AnticheatMgr::ZAxisHackDetection(Player* player, MovementInfo movementInfo)
 
    // If the player is allowed to waterwalk (or he is dead because he automatically waterwalks then) we dont need to check any further
    // We also stop if the player is in water, because otherwise you get a false positive for swimming
-   if (movementInfo.HasMovementFlag(MOVEMENTFLAG_WATERWALKING) || player->IsInWater() || !player->IsAlive())
+   if (movementInfo.HasMovementFlag(MOVEMENTFLAG_WATERWALKING) || state.InWater || !player->IsAlive())
        return;
 
    // We want to exclude this LiquidStatus from detection because it leads to false positives on boats, docks etc.
    // Basically everytime you stand on a game object in water
-   if (player->GetLiquidData().Status == LIQUID_MAP_ABOVE_WATER)
+   if (state.Liquid == LIQUID_MAP_ABOVE_WATER)
        return;
 
    // The anticheat is disabled on transports, so we need to be sure that the player is indeed on a transport.
@@ -992,7 +974,7 @@ void AnticheatMgr::ZAxisHackDetection(Player* player, MovementInfo movementInfo)
    }
 
    // The anticheat check is disabled on Elevators, so we need to be sure that the player is indeed on a transport.
-   if (player->HasUnitMovementFlag(MOVEMENTFLAG_ONTRANSPORT))
+   if (state.HasMovementFlag(MOVEMENTFLAG_ONTRANSPORT))
    {
        return;
    }
@@ -1014,16 +996,16 @@ void AnticheatMgr::ZAxisHackDetection(Player* player, MovementInfo movementInfo)
    }
 
    // This is Black Magic. Check only for x and y difference but no z difference that is greater then or equal to z +2.5 of the ground
-   if (m_Players[key].GetLastMovementInfo().pos.GetPositionZ() == movementInfo.pos.GetPositionZ()
-       && player->GetPositionZ() >= player->GetFloorZ() + 2.5f)
+   if (playerData.GetLastMovementInfo().pos.GetPositionZ() == movementInfo.pos.GetPositionZ()
+       && state.Pos.GetPositionZ() >= state.FloorZ + 2.5f)
    {
-       if (m_Players[key].GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORTS_INGAME_NOTIFICATION))
+       if (playerData.GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORTS_INGAME_NOTIFICATION))
        {// we do this because we can not get the collumn count being propper when we add more collumns for the report, so we make a indvidual warning for Ignore Zaxis Hack
-           _alertFrequency = sWorld->getIntConfig(CONFIG_ANTICHEAT_ALERT_FREQUENCY);
+           uint32 alertFrequency = sWorld->getIntConfig(CONFIG_ANTICHEAT_ALERT_FREQUENCY);
            // So we dont divide by 0 by accident
-           if (_alertFrequency < 1)
-               _alertFrequency = 1;
-           if (++_counter % _alertFrequency == 0)
+           if (alertFrequency < 1)
+               alertFrequency = 1;
+           if (++_counter % alertFrequency == 0)
            {
                 // display warning at the center of the screen, hacky way?
                 std::string str = "|cFFFFFC00[Playername:|cFF00FFFF[|cFF60FF00" + player->GetName() + "|cFF00FFFF] Possible Ignore Zaxis Hack Detected!";
@@ -1033,7 +1015,7 @@ void AnticheatMgr::ZAxisHackDetection(Player* player, MovementInfo movementInfo)
                 uint32 latency = 0;
                 latency = player->GetSession()->GetLatency();
                 // need better way to limit chat spam
-                if (m_Players[key].GetTotalReports() >= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MIN) && m_Players[key].GetTotalReports() <= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MAX))
+                if (playerData.GetTotalReports() >= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MIN) && playerData.GetTotalReports() <= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MAX))
                 {
                     sWorld->SendGMText(LANG_ANTICHEAT_ALERT, player->GetName().c_str(), player->GetName().c_str(), latency);
                 }
@@ -1044,8 +1026,7 @@ void AnticheatMgr::ZAxisHackDetection(Player* player, MovementInfo movementInfo)
        {
            uint32 latency = 0;
            latency = player->GetSession()->GetLatency();
-           std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-           LOG_INFO("anticheat", "AnticheatMgr:: Ignore Zaxis Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+           LOG_INFO("anticheat", "AnticheatMgr:: Ignore Zaxis Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
        }
        if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_IGNOREZ))
        {   // display warning at the center of the screen, hacky way?
@@ -1058,8 +1039,7 @@ void AnticheatMgr::ZAxisHackDetection(Player* player, MovementInfo movementInfo)
 
            if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_WRITELOG))
            {
-               std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-               LOG_INFO("anticheat.module", "ANTICHEAT COUNTER MEASURE:: {} IGNORE-Z Hack Countered and has been set to fall - Flagged at: {}", player->GetName(), goXYZ);
+               LOG_INFO("anticheat.module", "ANTICHEAT COUNTER MEASURE:: {} IGNORE-Z Hack Countered and has been set to fall - Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
            }
            if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_ALERTSCREEN))
            {   // display warning at the center of the screen, hacky way?
@@ -1081,7 +1061,7 @@ void AnticheatMgr::ZAxisHackDetection(Player* player, MovementInfo movementInfo)
 }
 
 // basic detection
-void AnticheatMgr::AntiSwimHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode)
+void AnticheatMgr::AntiSwimHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_ANTISWIM_ENABLE))
         return;
@@ -1095,7 +1075,7 @@ void AnticheatMgr::AntiSwimHackDetection(Player* player, MovementInfo movementIn
         }
     }
 
-    if (player->GetLiquidData().Status == (LIQUID_MAP_ABOVE_WATER | LIQUID_MAP_WATER_WALK | LIQUID_MAP_IN_WATER))
+    if (state.Liquid == (LIQUID_MAP_ABOVE_WATER | LIQUID_MAP_WATER_WALK | LIQUID_MAP_IN_WATER))
         return;
 
     if (opcode == MSG_MOVE_JUMP)
@@ -1104,14 +1084,13 @@ void AnticheatMgr::AntiSwimHackDetection(Player* player, MovementInfo movementIn
     if (movementInfo.HasMovementFlag(MOVEMENTFLAG_FALLING | MOVEMENTFLAG_SWIMMING))
         return;
 
-    if (player->GetLiquidData().Status == LIQUID_MAP_UNDER_WATER && !movementInfo.HasMovementFlag(MOVEMENTFLAG_SWIMMING))
+    if (state.Liquid == LIQUID_MAP_UNDER_WATER && !movementInfo.HasMovementFlag(MOVEMENTFLAG_SWIMMING))
     {
         if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_WRITELOG_ENABLE))
         {
             uint32 latency = 0;
             latency = player->GetSession()->GetLatency();
-            std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-            LOG_INFO("anticheat", "AnticheatMgr:: Anti-Swim-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+            LOG_INFO("anticheat", "AnticheatMgr:: Anti-Swim-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
         }
 
         BuildReport(player, ANTISWIM_HACK_REPORT);
@@ -1119,7 +1098,7 @@ void AnticheatMgr::AntiSwimHackDetection(Player* player, MovementInfo movementIn
     }
 }
 
-void AnticheatMgr::GravityHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::GravityHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_GRAVITY_ENABLE))
         return;
@@ -1129,17 +1108,16 @@ void AnticheatMgr::GravityHackDetection(Player* player, MovementInfo movementInf
         return;
     }
 
-    uint32 key = player->GetGUID().GetCounter();
-    if (m_Players[key].GetLastOpcode() == MSG_MOVE_JUMP)
+    AnticheatData& playerData = player->GetAnticheatData();
+    if (playerData.GetLastOpcode() == MSG_MOVE_JUMP)
     {
-        if (!player->HasUnitMovementFlag(MOVEMENTFLAG_DISABLE_GRAVITY) && movementInfo.jump.zspeed < -10.0f)
+        if (!state.HasMovementFlag(MOVEMENTFLAG_DISABLE_GRAVITY) && movementInfo.jump.zspeed < -10.0f)
         {
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_WRITELOG_ENABLE))
             {
                 uint32 latency = 0;
                 latency = player->GetSession()->GetLatency();
-                std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                LOG_INFO("anticheat", "AnticheatMgr:: Gravity-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+                LOG_INFO("anticheat", "AnticheatMgr:: Gravity-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
             }
             BuildReport(player, GRAVITY_HACK_REPORT);
         }
@@ -1147,26 +1125,25 @@ void AnticheatMgr::GravityHackDetection(Player* player, MovementInfo movementInf
 }
 
 // basic detection
-void AnticheatMgr::AntiKnockBackHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::AntiKnockBackHackDetection(Player* player, MovementInfo const& movementInfo)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_ANTIKNOCKBACK_ENABLE))
         return;
 
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
     //if a knockback helper is not passed then we ignore
     //if player has root state we ignore, knock back does not break root
     if (!player->CanKnockback() || player->HasUnitState(UNIT_STATE_ROOT))
         return;
 
-    if (movementInfo.pos == m_Players[key].GetLastMovementInfo().pos)
+    if (movementInfo.pos == playerData.GetLastMovementInfo().pos)
     {
         if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_WRITELOG_ENABLE))
         {
             uint32 latency = 0;
             latency = player->GetSession()->GetLatency();
-            std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-            LOG_INFO("anticheat", "AnticheatMgr:: Anti-Knock Back - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+            LOG_INFO("anticheat", "AnticheatMgr:: Anti-Knock Back - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
         }
         BuildReport(player, ANTIKNOCK_BACK_HACK_REPORT);
     }
@@ -1175,7 +1152,7 @@ void AnticheatMgr::AntiKnockBackHackDetection(Player* player, MovementInfo movem
 }
 
 // basic detection
-void AnticheatMgr::NoFallDamageDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::NoFallDamageDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_NO_FALL_DAMAGE_ENABLE))
         return;
@@ -1185,15 +1162,15 @@ void AnticheatMgr::NoFallDamageDetection(Player* player, MovementInfo movementIn
         return;
 
     // players with water walk aura jumping on to the water from ledge would not get damage and neither will safe fall and feather fall
-    if (((player->HasAuraType(SPELL_AURA_WATER_WALK) && player->GetLiquidData().Status == LIQUID_MAP_WATER_WALK && !player->IsFlying())) ||
+    if (((player->HasAuraType(SPELL_AURA_WATER_WALK) && state.Liquid == LIQUID_MAP_WATER_WALK && !state.Flying)) ||
         player->HasAuraType(SPELL_AURA_FEATHER_FALL) || player->HasAuraType(SPELL_AURA_SAFE_FALL))
     {
         return;
     }
 
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
-    float lastZ = m_Players[key].GetLastMovementInfo().pos.GetPositionZ();
+    float lastZ = playerData.GetLastMovementInfo().pos.GetPositionZ();
     float newZ = movementInfo.pos.GetPositionZ();
     float zDiff = fabs(lastZ - newZ);
     int32 safe_fall = player->GetTotalAuraModifier(SPELL_AURA_SAFE_FALL);
@@ -1202,9 +1179,9 @@ void AnticheatMgr::NoFallDamageDetection(Player* player, MovementInfo movementIn
 
     // in the Player::Handlefall 14.57f is used to calculated the damageperc formula below to 0 for fall damamge
 
-    if (movementInfo.pos.GetPositionZ() < m_Players[key].GetLastMovementInfo().pos.GetPositionZ() && zDiff > 14.57f)
+    if (movementInfo.pos.GetPositionZ() < playerData.GetLastMovementInfo().pos.GetPositionZ() && zDiff > 14.57f)
     {
-        if (movementInfo.HasMovementFlag(MOVEMENTFLAG_FALLING) || m_Players[key].GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_FALLING))
+        if (movementInfo.HasMovementFlag(MOVEMENTFLAG_FALLING) || playerData.GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_FALLING))
         {
             if (damage == 0 && !player->IsImmunedToDamage(SPELL_SCHOOL_MASK_NORMAL))
             {
@@ -1212,8 +1189,7 @@ void AnticheatMgr::NoFallDamageDetection(Player* player, MovementInfo movementIn
                 {
                     uint32 latency = 0;
                     latency = player->GetSession()->GetLatency();
-                    std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                    LOG_INFO("anticheat", "AnticheatMgr:: No Fall Damage - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+                    LOG_INFO("anticheat", "AnticheatMgr:: No Fall Damage - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
                 }
                 BuildReport(player, NO_FALL_DAMAGE_HACK_REPORT);
             }
@@ -1223,13 +1199,13 @@ void AnticheatMgr::NoFallDamageDetection(Player* player, MovementInfo movementIn
 
 void AnticheatMgr::BGreport(Player* player)
 {
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
-    _alertFrequency = sWorld->getIntConfig(CONFIG_ANTICHEAT_ALERT_FREQUENCY);
+    uint32 alertFrequency = sWorld->getIntConfig(CONFIG_ANTICHEAT_ALERT_FREQUENCY);
     // So we dont divide by 0 by accident
-    if (_alertFrequency < 1)
-        _alertFrequency = 1;
-    if (++_counter % _alertFrequency == 0)
+    if (alertFrequency < 1)
+        alertFrequency = 1;
+    if (++_counter % alertFrequency == 0)
     {
         // display warning at the center of the screen, hacky way?
         std::string str = "|cFFFFFC00[Playername:|cFF00FFFF[|cFF60FF00" + player->GetName() + "|cFF00FFFF] Player Outside of Starting SPOT before BG has started!";
@@ -1239,7 +1215,7 @@ void AnticheatMgr::BGreport(Player* player)
         uint32 latency = 0;
         latency = player->GetSession()->GetLatency();
         // need better way to limit chat spam
-        if (m_Players[key].GetTotalReports() >= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MIN) && m_Players[key].GetTotalReports() <= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MAX))
+        if (playerData.GetTotalReports() >= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MIN) && playerData.GetTotalReports() <= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MAX))
         {
             sWorld->SendGMText(LANG_ANTICHEAT_BG_EXPLOIT, player->GetName().c_str(), player->GetName().c_str(), latency);
         }
@@ -1250,8 +1226,7 @@ void AnticheatMgr::BGreport(Player* player)
     {
         uint32 latency = 0;
         latency = player->GetSession()->GetLatency();
-        std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-        LOG_INFO("anticheat", "AnticheatMgr:: BG Start Spot Exploit-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+        LOG_INFO("anticheat", "AnticheatMgr:: BG Start Spot Exploit-Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
     }
 
     BuildReport(player, TELEPORT_HACK_REPORT);
@@ -1271,8 +1246,7 @@ void AnticheatMgr::CheckBGOriginPositions(Player* player)
 
     if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_WRITELOG))
     {
-        std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-        LOG_INFO("anticheat", "ANTICHEAT COUNTER MEASURE:: Sending {} back to start location (BG Map: {}) (possible exploit) - Flagged at: {}", player->GetName(), player->GetMapId(), goXYZ);
+        LOG_INFO("anticheat", "ANTICHEAT COUNTER MEASURE:: Sending {} back to start location (BG Map: {}) (possible exploit) - Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetMapId(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
     }
     if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_CM_ALERTSCREEN))
     {   // display warning at the center of the screen, hacky way?
@@ -1289,12 +1263,12 @@ void AnticheatMgr::CheckBGOriginPositions(Player* player)
     player->TeleportTo(player->GetMapId(), startPos->GetPositionX(), startPos->GetPositionY(), startPos->GetPositionZ(), startPos->GetOrientation());
 }
 
-void AnticheatMgr::BGStartExploit(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::BGStartExploit(Player* player, MovementInfo const& movementInfo)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_BG_START_HACK_ENABLE))
         return;
 
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
     switch (player->GetMapId())
     {
@@ -1326,7 +1300,7 @@ void AnticheatMgr::BGStartExploit(Player* player, MovementInfo movementInfo)
         case 489: // Warsong Gulch
         {
             // Only way to get this high is with engineering items malfunction.
-            if (!(movementInfo.HasMovementFlag(MOVEMENTFLAG_FALLING_FAR) || m_Players[key].GetLastOpcode() == MSG_MOVE_JUMP) && movementInfo.pos.GetPositionZ() > 380.0f)
+            if (!(movementInfo.HasMovementFlag(MOVEMENTFLAG_FALLING_FAR) || playerData.GetLastOpcode() == MSG_MOVE_JUMP) && movementInfo.pos.GetPositionZ() > 380.0f)
             {
                 sAnticheatMgr->BGreport(player);
                 sAnticheatMgr->CheckBGOriginPositions(player);
@@ -1440,14 +1414,28 @@ void AnticheatMgr::StartScripts()
 
 void AnticheatMgr::HandlePlayerLogin(Player* player)
 {
+    ObjectGuid::LowType guid = player->GetGUID().GetCounter();
+
     // we must delete this to prevent errors in case of crash
-    CharacterDatabase.Execute("DELETE FROM players_reports_status WHERE guid={}", player->GetGUID().GetCounter());
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYERS_REPORTS_STATUS);
+    stmt->SetData(0, guid);
+    CharacterDatabase.Execute(stmt, guid);
+
     // we initialize the pos of lastMovementPosition var.
-    m_Players[player->GetGUID().GetCounter()].SetPosition(player->GetPositionX(), player->GetPositionY(), player->GetPositionZ(), player->GetOrientation());
-    QueryResult resultDB = CharacterDatabase.Query("SELECT * FROM daily_players_reports WHERE guid={};", player->GetGUID().GetCounter());
+    player->GetAnticheatData().SetPosition(player->GetPositionX(), player->GetPositionY(), player->GetPositionZ(), player->GetOrientation());
 
-    if (resultDB)
-        m_Players[player->GetGUID().GetCounter()].SetDailyReportState(true);
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_DAILY_PLAYERS_REPORTS);
+    stmt->SetData(0, guid);
+
+    WorldSession* session = player->GetSession();
+    session->GetQueryProcessor().AddCallback(CharacterDatabase.AsyncQuery(stmt)
+        .WithPreparedCallback([session, guid](PreparedQueryResult result)
+        {
+            // the player may have logged out before the result arrived
+            Player* player = session->GetPlayer();
+            if (result && player && player->GetGUID().GetCounter() == guid)
+                player->GetAnticheatData().SetDailyReportState(true);
+        }));
 }
 
 void AnticheatMgr::HandlePlayerLogout(Player* player)
@@ -1455,22 +1443,52 @@ void AnticheatMgr::HandlePlayerLogout(Player* player)
     // TO-DO Make a table that stores the cheaters of the day, with more detailed information.
 
     // We must also delete it at logout to prevent have data of offline players in the db when we query the database (IE: The GM Command)
-    CharacterDatabase.Execute("DELETE FROM players_reports_status WHERE guid={}", player->GetGUID().GetCounter());
-    // Delete not needed data from the memory.
-    m_Players.erase(player->GetGUID().GetCounter());
+    // Keyed by guid so it is executed after the logout save of the same player.
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYERS_REPORTS_STATUS);
+    stmt->SetData(0, player->GetGUID().GetCounter());
+    CharacterDatabase.Execute(stmt, player->GetGUID().GetCounter());
 }
 
 void AnticheatMgr::AckUpdate(Player* player, uint32 diff)
 {
-    if (_updateCheckTimer <= diff)
+    AnticheatData& playerData = player->GetAnticheatData();
+
+    if (playerData.GetAckUpdateTimer() <= diff)
     {
         DoActions(player);
-        _updateCheckTimer = 4000;
+        playerData.SetAckUpdateTimer(4000);
     }
     else
     {
-        _updateCheckTimer -= diff;
+        playerData.SetAckUpdateTimer(playerData.GetAckUpdateTimer() - diff);
+    }
+}
+
+void AnticheatMgr::HandlePendingOperations(Player* player)
+{
+    uint8 operations = player->GetAnticheatData().TakePendingOperations();
+    if (!operations)
+        return;
+
+    AnticheatData& playerData = player->GetAnticheatData();
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+
+    if (operations & ANTICHEAT_PENDING_RESET)
+    {
+        playerData.ResetReports();
+
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYERS_REPORTS_STATUS);
+        stmt->SetData(0, player->GetGUID().GetCounter());
+        trans->Append(stmt);
+    }
+    else if (operations & ANTICHEAT_PENDING_SAVE)
+    {
+        SavePlayerData(player, trans);
+        SavePlayerDataDaily(player, trans);
+        playerData.SetReportsChanged(false);
     }
+
+    CharacterDatabase.CommitTransaction(trans, player->GetGUID().GetCounter());
 }
 
 void AnticheatMgr::DoActions(Player* player)
@@ -1485,8 +1503,7 @@ void AnticheatMgr::DoActions(Player* player)
             {
                 uint32 latency = 0;
                 latency = player->GetSession()->GetLatency();
-                std::string goXYZ = ".go xyz " + std::to_string(player->GetPositionX()) + " " + std::to_string(player->GetPositionY()) + " " + std::to_string(player->GetPositionZ() + 1.0f) + " " + std::to_string(player->GetMap()->GetId()) + " " + std::to_string(player->GetOrientation());
-                LOG_INFO("anticheat", "AnticheatMgr:: OP Ack Manipulation - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), goXYZ);
+                LOG_INFO("anticheat", "AnticheatMgr:: OP Ack Manipulation - Hack detected player {} ({}) - Latency: {} ms - IP: {} - Cheat Flagged at: .go xyz {} {} {} {} {}", player->GetName(), player->GetGUID().ToString(), latency, player->GetSession()->GetRemoteAddress(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() + 1.0f, player->GetMap()->GetId(), player->GetOrientation());
                 order.counter = 0;
             }
             BuildReport(player, OP_ACK_HACK_REPORT);
@@ -1524,37 +1541,108 @@ void AnticheatMgr::SetAllowedMovement(Player* player, bool)
     player->SetCanTeleport(true);
 }
 
-void AnticheatMgr::SavePlayerData(Player* player)
+void AnticheatMgr::SavePlayerData(Player* player, CharacterDatabaseTransaction trans)
 {
-    AnticheatData playerData = m_Players[player->GetGUID().GetCounter()];
-    CharacterDatabase.Execute("REPLACE INTO players_reports_status (guid,average,total_reports,speed_reports,fly_reports,jump_reports,waterwalk_reports,teleportplane_reports,climb_reports,teleport_reports,ignorecontrol_reports,zaxis_reports,antiswim_reports,gravity_reports,antiknockback_reports,no_fall_damage_reports,op_ack_hack_reports,counter_measures_reports,creation_time) VALUES ({},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{});", player->GetGUID().GetCounter(), playerData.GetAverage(), playerData.GetTotalReports(), playerData.GetTypeReports(SPEED_HACK_REPORT), playerData.GetTypeReports(FLY_HACK_REPORT), playerData.GetTypeReports(JUMP_HACK_REPORT), playerData.GetTypeReports(WALK_WATER_HACK_REPORT), playerData.GetTypeReports(TELEPORT_PLANE_HACK_REPORT), playerData.GetTypeReports(CLIMB_HACK_REPORT), playerData.GetTypeReports(TELEPORT_HACK_REPORT), playerData.GetTypeReports(IGNORE_CONTROL_REPORT), playerData.GetTypeReports(ZAXIS_HACK_REPORT), playerData.GetTypeReports(ANTISWIM_HACK_REPORT), playerData.GetTypeReports(GRAVITY_HACK_REPORT), playerData.GetTypeReports(ANTIKNOCK_BACK_HACK_REPORT), playerData.GetTypeReports(NO_FALL_DAMAGE_HACK_REPORT), playerData.GetTypeReports(OP_ACK_HACK_REPORT), playerData.GetTypeReports(COUNTER_MEASURES_REPORT), m_Players[player->GetGUID().GetCounter()].GetCreationTime());
+    AnticheatData const& playerData = player->GetAnticheatData();
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_PLAYERS_REPORTS_STATUS);
+    stmt->SetData(0, player->GetGUID().GetCounter());
+    stmt->SetData(1, playerData.GetAverage());
+    stmt->SetData(2, playerData.GetTotalReports());
+    stmt->SetData(3, playerData.GetTypeReports(SPEED_HACK_REPORT));
+    stmt->SetData(4, playerData.GetTypeReports(FLY_HACK_REPORT));
+    stmt->SetData(5, playerData.GetTypeReports(JUMP_HACK_REPORT));
+    stmt->SetData(6, playerData.GetTypeReports(WALK_WATER_HACK_REPORT));
+    stmt->SetData(7, playerData.GetTypeReports(TELEPORT_PLANE_HACK_REPORT));
+    stmt->SetData(8, playerData.GetTypeReports(CLIMB_HACK_REPORT));
+    stmt->SetData(9, playerData.GetTypeReports(TELEPORT_HACK_REPORT));
+    stmt->SetData(10, playerData.GetTypeReports(IGNORE_CONTROL_REPORT));
+    stmt->SetData(11, playerData.GetTypeReports(ZAXIS_HACK_REPORT));
+    stmt->SetData(12, playerData.GetTypeReports(ANTISWIM_HACK_REPORT));
+    stmt->SetData(13, playerData.GetTypeReports(GRAVITY_HACK_REPORT));
+    stmt->SetData(14, playerData.GetTypeReports(ANTIKNOCK_BACK_HACK_REPORT));
+    stmt->SetData(15, playerData.GetTypeReports(NO_FALL_DAMAGE_HACK_REPORT));
+    stmt->SetData(16, playerData.GetTypeReports(OP_ACK_HACK_REPORT));
+    stmt->SetData(17, playerData.GetTypeReports(COUNTER_MEASURES_REPORT));
+    stmt->SetData(18, playerData.GetCreationTime());
+    trans->Append(stmt);
 }
 
-void AnticheatMgr::SavePlayerDataDaily(Player* player)
+void AnticheatMgr::SavePlayerDataDaily(Player* player, CharacterDatabaseTransaction trans)
 {
-    AnticheatData playerData = m_Players[player->GetGUID().GetCounter()];
-    CharacterDatabase.Execute("REPLACE INTO daily_players_reports (guid,average,total_reports,speed_reports,fly_reports,jump_reports,waterwalk_reports,teleportplane_reports,climb_reports,teleport_reports,ignorecontrol_reports,zaxis_reports,antiswim_reports,gravity_reports,antiknockback_reports,no_fall_damage_reports,op_ack_hack_reports,counter_measures_reports,creation_time) VALUES ({},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{});", player->GetGUID().GetCounter(), playerData.GetAverage(), playerData.GetTotalReports(), playerData.GetTypeReports(SPEED_HACK_REPORT), playerData.GetTypeReports(FLY_HACK_REPORT), playerData.GetTypeReports(JUMP_HACK_REPORT), playerData.GetTypeReports(WALK_WATER_HACK_REPORT), playerData.GetTypeReports(TELEPORT_PLANE_HACK_REPORT), playerData.GetTypeReports(CLIMB_HACK_REPORT), playerData.GetTypeReports(TELEPORT_HACK_REPORT), playerData.GetTypeReports(IGNORE_CONTROL_REPORT), playerData.GetTypeReports(ZAXIS_HACK_REPORT), playerData.GetTypeReports(ANTISWIM_HACK_REPORT), playerData.GetTypeReports(GRAVITY_HACK_REPORT), playerData.GetTypeReports(ANTIKNOCK_BACK_HACK_REPORT), playerData.GetTypeReports(NO_FALL_DAMAGE_HACK_REPORT), playerData.GetTypeReports(OP_ACK_HACK_REPORT), playerData.GetTypeReports(COUNTER_MEASURES_REPORT), m_Players[player->GetGUID().GetCounter()].GetCreationTime());
+    AnticheatData const& playerData = player->GetAnticheatData();
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_DAILY_PLAYERS_REPORTS);
+    stmt->SetData(0, player->GetGUID().GetCounter());
+    stmt->SetData(1, playerData.GetAverage());
+    stmt->SetData(2, playerData.GetTotalReports());
+    stmt->SetData(3, playerData.GetTypeReports(SPEED_HACK_REPORT));
+    stmt->SetData(4, playerData.GetTypeReports(FLY_HACK_REPORT));
+    stmt->SetData(5, playerData.GetTypeReports(JUMP_HACK_REPORT));
+    stmt->SetData(6, playerData.GetTypeReports(WALK_WATER_HACK_REPORT));
+    stmt->SetData(7, playerData.GetTypeReports(TELEPORT_PLANE_HACK_REPORT));
+    stmt->SetData(8, playerData.GetTypeReports(CLIMB_HACK_REPORT));
+    stmt->SetData(9, playerData.GetTypeReports(TELEPORT_HACK_REPORT));
+    stmt->SetData(10, playerData.GetTypeReports(IGNORE_CONTROL_REPORT));
+    stmt->SetData(11, playerData.GetTypeReports(ZAXIS_HACK_REPORT));
+    stmt->SetData(12, playerData.GetTypeReports(ANTISWIM_HACK_REPORT));
+    stmt->SetData(13, playerData.GetTypeReports(GRAVITY_HACK_REPORT));
+    stmt->SetData(14, playerData.GetTypeReports(ANTIKNOCK_BACK_HACK_REPORT));
+    stmt->SetData(15, playerData.GetTypeReports(NO_FALL_DAMAGE_HACK_REPORT));
+    stmt->SetData(16, playerData.GetTypeReports(OP_ACK_HACK_REPORT));
+    stmt->SetData(17, playerData.GetTypeReports(COUNTER_MEASURES_REPORT));
+    stmt->SetData(18, playerData.GetCreationTime());
+    trans->Append(stmt);
 }
 
-void AnticheatMgr::OnPlayerMove(Player* player, MovementInfo mi, uint32 opcode)
+void AnticheatMgr::OnPlayerMove(Player* player, MovementInfo const& mi, uint32 opcode)
 {
+    if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_ENABLE))
+        return;
+
+    // the detectors run in AnalyzeMoveQueue, once the map has processed the packets of all its sessions
     if (!AccountMgr::IsAdminAccount(player->GetSession()->GetSecurity()) || sWorld->getBoolConfig(CONFIG_ANTICHEAT_ENABLE_ON_GM))
-        sAnticheatMgr->StartHackDetection(player, mi, opcode);
+        player->GetMap()->GetAnticheatMoveQueue().Push(player, mi, opcode);
+}
+
+AnticheatPlayerState::AnticheatPlayerState(Player const* player) : Pos(player->GetPosition()), MovementFlags(player->GetUnitMovementFlags()),
+    Liquid(player->GetLiquidData().Status), FloorZ(player->GetFloorZ()), Falling(player->IsFalling()), InWater(player->IsInWater()),
+    Flying(player->IsFlying()), InFlight(player->IsInFlight()), OnTransport(player->GetTransport() != nullptr), InVehicle(player->GetVehicle() != nullptr)
+{
+}
+
+void AnticheatMgr::AnalyzeMoveQueue(Map* map)
+{
+    AnticheatMoveQueue& queue = map->GetAnticheatMoveQueue();
+    if (queue.IsEmpty())
+        return;
+
+    for (AnticheatMoveSample const& sample : queue.GetSamples())
+    {
+        // the player may have left the map, or have been moved by a previous verdict, since the movement was received
+        Player* player = ObjectAccessor::GetPlayer(map, sample.PlayerGuid);
+        if (!player || !player->IsInWorld() || player->IsBeingTeleported())
+            continue;
+
+        StartHackDetection(player, sample);
+    }
+
+    queue.Clear();
 }
 
-uint32 AnticheatMgr::GetTotalReports(uint32 lowGUID)
+uint32 AnticheatMgr::GetTotalReports(Player const* player) const
 {
-    return m_Players[lowGUID].GetTotalReports();
+    return player->GetAnticheatData().GetTotalReports();
 }
 
-float AnticheatMgr::GetAverage(uint32 lowGUID)
+float AnticheatMgr::GetAverage(Player const* player) const
 {
-    return m_Players[lowGUID].GetAverage();
+    return player->GetAnticheatData().GetAverage();
 }
 
-uint32 AnticheatMgr::GetTypeReports(uint32 lowGUID, uint8 type)
+uint32 AnticheatMgr::GetTypeReports(Player const* player, uint8 type) const
 {
-    return m_Players[lowGUID].GetTypeReports(type);
+    return player->GetAnticheatData().GetTypeReports(type);
 }
 
 bool AnticheatMgr::MustCheckTempReports(uint8 type)
@@ -1596,66 +1684,69 @@ bool AnticheatMgr::MustCheckTempReports(uint8 type)
 
 void AnticheatMgr::BuildReport(Player* player, uint8 reportType)
 {
-    uint32 key = player->GetGUID().GetCounter();
+    AnticheatData& playerData = player->GetAnticheatData();
 
     if (MustCheckTempReports(reportType))
     {
         uint32 actualTime = getMSTime();
 
-        if (!m_Players[key].GetTempReportsTimer(reportType))
-            m_Players[key].SetTempReportsTimer(actualTime, reportType);
+        if (!playerData.GetTempReportsTimer(reportType))
+            playerData.SetTempReportsTimer(actualTime, reportType);
 
-        if (getMSTimeDiff(m_Players[key].GetTempReportsTimer(reportType), actualTime) < 3000)
+        if (getMSTimeDiff(playerData.GetTempReportsTimer(reportType), actualTime) < 3000)
         {
-            m_Players[key].SetTempReports(m_Players[key].GetTempReports(reportType) + 1, reportType);
+            playerData.SetTempReports(playerData.GetTempReports(reportType) + 1, reportType);
 
-            if (m_Players[key].GetTempReports(reportType) < 3)
+            if (playerData.GetTempReports(reportType) < 3)
                 return;
         }
         else
         {
-            m_Players[key].SetTempReportsTimer(actualTime, reportType);
-            m_Players[key].SetTempReports(1, reportType);
+            playerData.SetTempReportsTimer(actualTime, reportType);
+            playerData.SetTempReports(1, reportType);
             return;
         }
     }
 
     // generating creationTime for average calculation
-    if (!m_Players[key].GetTotalReports())
-        m_Players[key].SetCreationTime(getMSTime());
+    if (!playerData.GetTotalReports())
+        playerData.SetCreationTime(getMSTime());
 
     // increasing total_reports
-    m_Players[key].SetTotalReports(m_Players[key].GetTotalReports() + 1);
+    playerData.SetTotalReports(playerData.GetTotalReports() + 1);
     // increasing specific cheat report
-    m_Players[key].SetTypeReports(reportType, m_Players[key].GetTypeReports(reportType) + 1);
+    playerData.SetTypeReports(reportType, playerData.GetTypeReports(reportType) + 1);
+    playerData.SetReportsChanged(true);
 
     // diff time for average calculation
-    uint32 diffTime = getMSTimeDiff(m_Players[key].GetCreationTime(), getMSTime()) / IN_MILLISECONDS;
+    uint32 diffTime = getMSTimeDiff(playerData.GetCreationTime(), getMSTime()) / IN_MILLISECONDS;
 
     if (diffTime > 0)
     {
         // Average == Reports per second
-        float average = float(m_Players[key].GetTotalReports()) / float(diffTime);
-        m_Players[key].SetAverage(average);
+        float average = float(playerData.GetTotalReports()) / float(diffTime);
+        playerData.SetAverage(average);
     }
 
-    if (sWorld->getIntConfig(CONFIG_ANTICHEAT_MAX_REPORTS_FOR_DAILY_REPORT) < m_Players[key].GetTotalReports())
+    if (sWorld->getIntConfig(CONFIG_ANTICHEAT_MAX_REPORTS_FOR_DAILY_REPORT) < playerData.GetTotalReports())
     {
-        if (!m_Players[key].GetDailyReportState())
+        if (!playerData.GetDailyReportState())
         {
-            AnticheatData playerData = m_Players[player->GetGUID().GetCounter()];
-            CharacterDatabase.Execute("REPLACE INTO players_reports_status (guid,average,total_reports,speed_reports,fly_reports,jump_reports,waterwalk_reports,teleportplane_reports,climb_reports,teleport_reports,ignorecontrol_reports,zaxis_reports,antiswim_reports,gravity_reports,antiknockback_reports,no_fall_damage_reports,op_ack_hack_reports,counter_measures_reports,creation_time) VALUES ({},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{});", player->GetGUID().GetCounter(), playerData.GetAverage(), playerData.GetTotalReports(), playerData.GetTypeReports(SPEED_HACK_REPORT), playerData.GetTypeReports(FLY_HACK_REPORT), playerData.GetTypeReports(JUMP_HACK_REPORT), playerData.GetTypeReports(WALK_WATER_HACK_REPORT), playerData.GetTypeReports(TELEPORT_PLANE_HACK_REPORT), playerData.GetTypeReports(CLIMB_HACK_REPORT), playerData.GetTypeReports(TELEPORT_HACK_REPORT), playerData.GetTypeReports(IGNORE_CONTROL_REPORT), playerData.GetTypeReports(ZAXIS_HACK_REPORT), playerData.GetTypeReports(ANTISWIM_HACK_REPORT), playerData.GetTypeReports(GRAVITY_HACK_REPORT), playerData.GetTypeReports(ANTIKNOCK_BACK_HACK_REPORT), playerData.GetTypeReports(NO_FALL_DAMAGE_HACK_REPORT), playerData.GetTypeReports(OP_ACK_HACK_REPORT), playerData.GetTypeReports(COUNTER_MEASURES_REPORT), m_Players[player->GetGUID().GetCounter()].GetCreationTime());
-            m_Players[key].SetDailyReportState(true);
+            CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+            SavePlayerData(player, trans);
+            CharacterDatabase.CommitTransaction(trans, player->GetGUID().GetCounter());
+            playerData.SetReportsChanged(false);
+            playerData.SetDailyReportState(true);
         }
     }
 
-    if (m_Players[key].GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORTS_INGAME_NOTIFICATION))
+    if (playerData.GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORTS_INGAME_NOTIFICATION))
     {
-        _alertFrequency = sWorld->getIntConfig(CONFIG_ANTICHEAT_ALERT_FREQUENCY);
+        uint32 alertFrequency = sWorld->getIntConfig(CONFIG_ANTICHEAT_ALERT_FREQUENCY);
         // So we dont divide by 0 by accident
-        if (_alertFrequency < 1)
-            _alertFrequency = 1;
-        if (++_counter % _alertFrequency == 0)
+        if (alertFrequency < 1)
+            alertFrequency = 1;
+        if (++_counter % alertFrequency == 0)
         {
             // display warning at the center of the screen, hacky way?
             std::string str = "|cFFFFFC00[Playername:]|cFF00FFFF[|cFF60FF00" + player->GetName() + "|cFF00FFFF] Possible cheater!";
@@ -1664,7 +1755,7 @@ void AnticheatMgr::BuildReport(Player* player, uint8 reportType)
             sWorld->SendGlobalGMMessage(&data);
         }
         // need better way to limit chat spam
-        if (m_Players[key].GetTotalReports() >= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MIN) && (m_Players[key].GetTotalReports() <= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MAX)))
+        if (playerData.GetTotalReports() >= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MIN) && (playerData.GetTotalReports() <= sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORT_IN_CHAT_MAX)))
         {
             uint32 latency = 0;
             latency = player->GetSession()->GetLatency();
@@ -1676,7 +1767,7 @@ void AnticheatMgr::BuildReport(Player* player, uint8 reportType)
     // Auto Kick
     if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_AUTOKICK_ENABLE))
     {
-        if (m_Players[key].GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_MAX_REPORTS_FOR_KICKS))
+        if (playerData.GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_MAX_REPORTS_FOR_KICKS))
         {
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_WRITELOG_ENABLE))
             {
@@ -1706,7 +1797,7 @@ void AnticheatMgr::BuildReport(Player* player, uint8 reportType)
     // Auto Ban
     if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_AUTOBAN_ENABLE))
     {
-        if (m_Players[key].GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_MAX_REPORTS_FOR_BANS))
+        if (playerData.GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_MAX_REPORTS_FOR_BANS))
         {
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_WRITELOG_ENABLE))
             {
@@ -1738,7 +1829,7 @@ void AnticheatMgr::BuildReport(Player* player, uint8 reportType)
     //Auto Jail
     if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_AUTOJAIL_ENABLE))
     {
-        if (m_Players[key].GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_MAX_REPORTS_FOR_JAILS))
+        if (playerData.GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_MAX_REPORTS_FOR_JAILS))
         {
             if (sWorld->getBoolConfig(CONFIG_ANTICHEAT_WRITELOG_ENABLE))
             {
@@ -1791,13 +1882,11 @@ void AnticheatMgr::BuildReport(Player* player, uint8 reportType)
 // these are the supporters for the gm commands in cs_anticheat.cpp
 void AnticheatMgr::AnticheatGlobalCommand(ChatHandler* handler)
 {   // .anticheat global gm command
-    // save All Anticheat Player Data before displaying global stats
+    // the online players are updated by other threads, they save their data with their next update
+    // and the stats below show what was stored until then
     for (SessionMap::const_iterator itr = sWorld->GetAllSessions().begin(); itr != sWorld->GetAllSessions().end(); ++itr)
         if (Player* plr = itr->second->GetPlayer())
-        {
-            sAnticheatMgr->SavePlayerData(plr);
-            sAnticheatMgr->SavePlayerDataDaily(plr);
-        }
+            plr->GetAnticheatData().AddPendingOperation(ANTICHEAT_PENDING_SAVE);
 
     QueryResult resultDB = CharacterDatabase.Query("SELECT guid,average,total_reports FROM players_reports_status WHERE total_reports != 0 ORDER BY average ASC LIMIT 3;");
     if (!resultDB)
@@ -1852,34 +1941,23 @@ void AnticheatMgr::AnticheatGlobalCommand(ChatHandler* handler)
 // .anticheat delete gm cmd
 void AnticheatMgr::AnticheatDeleteCommand(uint32 guid)
 {
+    // online players reset their reports and delete their row with their next update,
+    // so a save of the old reports queued before cannot bring the row back
     if (!guid)
     {
-        for (AnticheatPlayersDataMap::iterator it = m_Players.begin(); it != m_Players.end(); ++it)
-        {
-            (*it).second.SetTotalReports(0);
-            (*it).second.SetAverage(0);
-            (*it).second.SetCreationTime(0);
-            for (uint8 i = 0; i < MAX_REPORT_TYPES; i++)
-            {
-                (*it).second.SetTempReports(0, i);
-                (*it).second.SetTempReportsTimer(0, i);
-                (*it).second.SetTypeReports(i, 0);
-            }
-        }
+        for (SessionMap::const_iterator itr = sWorld->GetAllSessions().begin(); itr != sWorld->GetAllSessions().end(); ++itr)
+            if (Player* plr = itr->second->GetPlayer())
+                plr->GetAnticheatData().AddPendingOperation(ANTICHEAT_PENDING_RESET);
+
         CharacterDatabase.Execute("DELETE FROM players_reports_status;");
     }
+    else if (Player* player = ObjectAccessor::FindPlayerByLowGUID(guid))
+        player->GetAnticheatData().AddPendingOperation(ANTICHEAT_PENDING_RESET);
     else
     {
-        m_Players[guid].SetTotalReports(0);
-        m_Players[guid].SetAverage(0);
-        m_Players[guid].SetCreationTime(0);
-        for (uint8 i = 0; i < MAX_REPORT_TYPES; i++)
-        {
-            m_Players[guid].SetTempReports(0, i);
-            m_Players[guid].SetTempReportsTimer(0, i);
-            m_Players[guid].SetTypeReports(i, 0);
-        }
-        CharacterDatabase.Execute("DELETE FROM players_reports_status WHERE guid={};", guid);
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYERS_REPORTS_STATUS);
+        stmt->SetData(0, guid);
+        CharacterDatabase.Execute(stmt, guid);
     }
 }
 
@@ -1891,6 +1969,7 @@ void AnticheatMgr::AnticheatPurgeCommand(ChatHandler* /*handler*/)
 
 void AnticheatMgr::ResetDailyReportStates()
 {// this resets the daily reports to zero
-    for (AnticheatPlayersDataMap::iterator it = m_Players.begin(); it != m_Players.end(); ++it)
-        m_Players[(*it).first].SetDailyReportState(false);
+    for (SessionMap::const_iterator itr = sWorld->GetAllSessions().begin(); itr != sWorld->GetAllSessions().end(); ++itr)
+        if (Player* plr = itr->second->GetPlayer())
+            plr->GetAnticheatData().SetDailyReportState(false);
 }
@@ -6,12 +6,15 @@
 #include "ScriptMgr.h"
 #include "AnticheatData.h"
 #include "Chat.h"
+#include "DatabaseEnvFwd.h"
 #include "Player.h"
+#include <atomic>
 #include <unordered_map>
 #include "WorldSession.h"
 
 class Player;
 class AnticheatData;
+class Map;
 
 enum ReportTypes
 {
@@ -34,8 +37,48 @@ enum ReportTypes
    // MAX_REPORT_TYPES
 };
 
-// GUIDLow is the key.
-typedef std::map<uint32, AnticheatData> AnticheatPlayersDataMap;
+// Player state when the movement was received, before MovementHandler applied it. The detectors
+// compare the movement against this instead of the player, who has moved on when the batch runs.
+struct AnticheatPlayerState
+{
+    explicit AnticheatPlayerState(Player const* player);
+
+    Position Pos;
+    uint32 MovementFlags;
+    LiquidStatus Liquid;
+    float FloorZ;
+    bool Falling;
+    bool InWater;
+    bool Flying;
+    bool InFlight;                                          // taxi
+    bool OnTransport;
+    bool InVehicle;
+
+    [[nodiscard]] bool HasMovementFlag(uint32 flags) const { return (MovementFlags & flags) != 0; }
+};
+
+struct AnticheatMoveSample
+{
+    ObjectGuid PlayerGuid;
+    MovementInfo Movement;
+    uint32 Opcode;
+    AnticheatPlayerState State;
+};
+
+// Movement received by the sessions of a map during one update, analyzed in a single batch
+// once all of them are processed. Only touched by the thread updating the map, and the storage
+// is kept between updates so queueing a sample does not allocate.
+class AnticheatMoveQueue
+{
+public:
+    void Push(Player const* player, MovementInfo const& movementInfo, uint32 opcode) { _samples.push_back({ player->GetGUID(), movementInfo, opcode, AnticheatPlayerState(player) }); }
+    [[nodiscard]] bool IsEmpty() const { return _samples.empty(); }
+    [[nodiscard]] std::vector<AnticheatMoveSample> const& GetSamples() const { return _samples; }
+    void Clear() { _samples.clear(); }
+
+private:
+    std::vector<AnticheatMoveSample> _samples;
+};
 
 class ServerOrderData
 {
@@ -64,15 +107,17 @@ class AnticheatMgr
            return instance;
         }
         void SetAllowedMovement(Player* player, bool);
-        void StartHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode);
-        void SavePlayerData(Player* player);
-        void SavePlayerDataDaily(Player* player);
-        void OnPlayerMove(Player* player, MovementInfo mi, uint32 opcode);
+        void StartHackDetection(Player* player, AnticheatMoveSample const& sample);
+        void SavePlayerData(Player* player, CharacterDatabaseTransaction trans);
+        void SavePlayerDataDaily(Player* player, CharacterDatabaseTransaction trans);
+        void OnPlayerMove(Player* player, MovementInfo const& mi, uint32 opcode);
+        void AnalyzeMoveQueue(Map* map);
         void StartScripts();
 
         void HandlePlayerLogin(Player* player);
         void HandlePlayerLogout(Player* player);
         void AckUpdate(Player* player, uint32 diff);
+        void HandlePendingOperations(Player* player);
         void DoActions(Player* player);
 
         // orders
@@ -80,9 +125,9 @@ class AnticheatMgr
         void CheckForOrderAck(uint32 opcode);
         std::vector<ServerOrderData> _opackorders; // Packets sent by server, triggering *_ACK from client
 
-        uint32 GetTotalReports(uint32 lowGUID);
-        float GetAverage(uint32 lowGUID);
-        uint32 GetTypeReports(uint32 lowGUID, uint8 type);
+        uint32 GetTotalReports(Player const* player) const;
+        float GetAverage(Player const* player) const;
+        uint32 GetTypeReports(Player const* player, uint8 type) const;
 
         void AnticheatGlobalCommand(ChatHandler* handler);
         void AnticheatDeleteCommand(uint32 guid);
@@ -96,34 +141,30 @@ class AnticheatMgr
         bool CheckBlockedLuaFunctions(AccountData accountData[NUM_ACCOUNT_DATA_TYPES], Player* player = nullptr);
 
     private:
-        void SpeedHackDetection(Player* player, MovementInfo movementInfo);
-        void FlyHackDetection(Player* player, MovementInfo movementInfo);
-        void WalkOnWaterHackDetection(Player* player, MovementInfo movementInfo);
-        void JumpHackDetection(Player* player, MovementInfo movementInfo,uint32 opcode);
-        void TeleportPlaneHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode);
-        void ClimbHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode);
-        void IgnoreControlHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode);
-        void TeleportHackDetection(Player* player, MovementInfo movementInfo);
-        void ZAxisHackDetection(Player* player, MovementInfo movementInfo);
-        void AntiSwimHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode);
-        void AntiKnockBackHackDetection(Player* player, MovementInfo movementInfo);
-        void GravityHackDetection(Player* player, MovementInfo movementInfo);
-        void NoFallDamageDetection(Player* player, MovementInfo movementInfo);
+        void SpeedHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state);
+        void FlyHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state);
+        void WalkOnWaterHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state);
+        void JumpHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode, AnticheatPlayerState const& state);
+        void TeleportPlaneHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode, AnticheatPlayerState const& state);
+        void ClimbHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode, AnticheatPlayerState const& state);
+        void IgnoreControlHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode, AnticheatPlayerState const& state);
+        void TeleportHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state);
+        void ZAxisHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state);
+        void AntiSwimHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode, AnticheatPlayerState const& state);
+        void AntiKnockBackHackDetection(Player* player, MovementInfo const& movementInfo);
+        void GravityHackDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state);
+        void NoFallDamageDetection(Player* player, MovementInfo const& movementInfo, AnticheatPlayerState const& state);
         void BGreport(Player* player);
         void CheckBGOriginPositions(Player* player);
-        void BGStartExploit(Player* player, MovementInfo movementInfo);
+        void BGStartExploit(Player* player, MovementInfo const& movementInfo);
         void BuildReport(Player* player,uint8 reportType);
 
         bool MustCheckTempReports(uint8 type);
-        uint32 _counter = 0;
-        uint32 _alertFrequency = 0;
-        uint32 _assignedspeeddiff = 0;
-        uint32 _updateCheckTimer = 4000;
+        std::atomic<uint32> _counter = 0;
         uint32 m_MapId = uint32(-1);
         std::unordered_map<std::string, bool> _luaBlockedFunctions;
         std::array<Position, PVP_TEAMS_COUNT> _startPosition;
         Position const* GetTeamStartPosition(TeamId teamId) const;
-        AnticheatPlayersDataMap m_Players;                        ///< Player data
 };
 
 #define sAnticheatMgr AnticheatMgr::instance()
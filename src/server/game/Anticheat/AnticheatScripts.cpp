@@ -2,7 +2,11 @@
 #include "AnticheatMgr.h"
 #include "World.h"
 
-AnticheatScripts::AnticheatScripts(): PlayerScript("AnticheatScripts") {}
+AnticheatScripts::AnticheatScripts(): PlayerScript("AnticheatScripts", {
+    PLAYERHOOK_ON_LOGOUT,
+    PLAYERHOOK_ON_LOGIN,
+    PLAYERHOOK_ON_UPDATE,
+}) {}
 
 void AnticheatScripts::OnLogout(Player* player)
 {
@@ -16,6 +20,9 @@ void AnticheatScripts::OnLogin(Player* player)
 
 void AnticheatScripts::OnUpdate(Player* player, uint32 diff)
 {
+    // requested by commands, also when the anticheat was disabled since
+    sAnticheatMgr->HandlePendingOperations(player);
+
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_OP_ACK_HACK_ENABLE) && !sWorld->getBoolConfig(CONFIG_ANTICHEAT_ENABLE))
     {
         return;
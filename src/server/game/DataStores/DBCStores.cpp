@@ -26,7 +26,11 @@
 #include "SpellMgr.h"
 #include "TransportMgr.h"
 #include "World.h"
+#include <atomic>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <thread>
 
 typedef std::map<uint16, uint32> AreaFlagByAreaID;
 typedef std::map<uint32, uint32> AreaFlagByMapID;
@@ -200,7 +204,8 @@ DBCStorage <WorldMapOverlayEntry> sWorldMapOverlayStore(WorldMapOverlayEntryfmt)
 
 typedef std::list<std::string> StoreProblemList;
 
-uint32 DBCFileCount = 0;
+std::atomic<uint32> DBCFileCount = 0;
+static std::mutex DBCErrorsLock;
 
 static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string& filename)
 {
@@ -211,7 +216,7 @@ static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string&
 }
 
 template<class T>
-inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, char const* dbTable = nullptr)
+inline void LoadDBC(std::atomic<uint32>& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, char const* dbTable = nullptr)
 {
     // compatibility format and C++ structure sizes
     ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
@@ -245,6 +250,8 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
 
     if (!existDBData)
     {
+        std::lock_guard<std::mutex> guard(DBCErrorsLock);
+
         // sort problematic dbc to (1) non compatible and (2) non-existed
         if (FILE* f = fopen(dbcFilename.c_str(), "rb"))
         {
@@ -266,9 +273,12 @@ void LoadDBCStores(const std::string& dataPath)
     std::string dbcPath = dataPath + "dbc/";
 
     StoreProblemList bad_dbc_files;
-    uint32 availableDbcLocales = 0xFFFFFFFF;
+    std::atomic<uint32> availableDbcLocales = 0xFFFFFFFF;
+
+    // stores are independent of each other until the post processing below, load them on all cores
+    std::vector<std::function<void()>> loaders;
 
-#define LOAD_DBC(store, file, dbtable) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, dbtable)
+#define LOAD_DBC(store, file, dbtable) loaders.emplace_back([&]() { LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, dbtable); })
 
     LOAD_DBC(sAreaTableStore,                       "AreaTable.dbc",                        "areatable_dbc");
     LOAD_DBC(sAchievementStore,                     "Achievement.dbc",                      "achievement_dbc");
@@ -385,6 +395,21 @@ void LoadDBCStores(const std::string& dataPath)
 
 #undef LOAD_DBC
 
+    std::atomic<size_t> nextLoader = 0;
+    std::vector<std::thread> loaderThreads;
+    size_t threadCount = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), loaders.size());
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        loaderThreads.emplace_back([&]()
+        {
+            for (size_t index = nextLoader++; index < loaders.size(); index = nextLoader++)
+                loaders[index]();
+        });
+    }
+
+    for (std::thread& thread : loaderThreads)
+        thread.join();
+
     for (CharStartOutfitEntry const* outfit : sCharStartOutfitStore)
         sCharStartOutfitMap[outfit->Race | (outfit->Class << 8) | (outfit->Gender << 16)] = outfit;
 
@@ -621,7 +646,7 @@ void LoadDBCStores(const std::string& dataPath)
     // error checks
     if (bad_dbc_files.size() >= DBCFileCount)
     {
-        LOG_ERROR("dbc", "Incorrect DataDir value in worldserver.conf or ALL required *.dbc files ({}) not found by path: {}dbc", DBCFileCount, dataPath);
+        LOG_ERROR("dbc", "Incorrect DataDir value in worldserver.conf or ALL required *.dbc files ({}) not found by path: {}dbc", DBCFileCount.load(), dataPath);
         exit(1);
     }
     else if (!bad_dbc_files.empty())
@@ -630,7 +655,7 @@ void LoadDBCStores(const std::string& dataPath)
         for (StoreProblemList::iterator i = bad_dbc_files.begin(); i != bad_dbc_files.end(); ++i)
             str += *i + "\n";
 
-        LOG_ERROR("dbc", "Some required *.dbc files ({} from {}) not found or not compatible:\n{}", (uint32)bad_dbc_files.size(), DBCFileCount, str);
+        LOG_ERROR("dbc", "Some required *.dbc files ({} from {}) not found or not compatible:\n{}", (uint32)bad_dbc_files.size(), DBCFileCount.load(), str);
         exit(1);
     }
 
@@ -647,7 +672,7 @@ void LoadDBCStores(const std::string& dataPath)
         exit(1);
     }
 
-    LOG_INFO("server.loading", ">> Initialized {} Data Stores in {} ms", DBCFileCount, GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", ">> Initialized {} Data Stores in {} ms", DBCFileCount.load(), GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
 
@@ -49,9 +49,12 @@ void AreaTrigger::AddToWorld()
         if (m_zoneScript)
             m_zoneScript->OnAreaTriggerCreate(this);
 
-        GetMap()->GetObjectsStore().Insert<AreaTrigger>(GetGUID(), this);
-        if (_spawnId)
-            GetMap()->GetAreaTriggerBySpawnIdStore().insert(std::make_pair(_spawnId, this));
+        {
+            auto guard = GetMap()->LockObjectStoresForWrite();
+            GetMap()->GetObjectsStore().Insert<AreaTrigger>(GetGUID(), this);
+            if (_spawnId)
+                GetMap()->GetAreaTriggerBySpawnIdStore().insert(std::make_pair(_spawnId, this));
+        }
 
         WorldObject::AddToWorld();
     }
@@ -78,6 +81,7 @@ void AreaTrigger::RemoveFromWorld()
         WorldObject::RemoveFromWorld();
 
 
+        auto guard = GetMap()->LockObjectStoresForWrite();
         if (_spawnId)
             Acore::Containers::MultimapErasePair(GetMap()->GetAreaTriggerBySpawnIdStore(), _spawnId, this);
         GetMap()->GetObjectsStore().Remove<AreaTrigger>(GetGUID());
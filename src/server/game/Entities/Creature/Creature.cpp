@@ -260,10 +260,13 @@ void Creature::AddToWorld()
         // it's also initialized in AIM_Initialize(), few lines below, but it's not a problem
         Motion_Initialize();
 
-        GetMap()->GetObjectsStore().Insert<Creature>(GetGUID(), this);
-        if (m_spawnId)
         {
-            GetMap()->GetCreatureBySpawnIdStore().insert(std::make_pair(m_spawnId, this));
+            auto guard = GetMap()->LockObjectStoresForWrite();
+            GetMap()->GetObjectsStore().Insert<Creature>(GetGUID(), this);
+            if (m_spawnId)
+            {
+                GetMap()->GetCreatureBySpawnIdStore().insert(std::make_pair(m_spawnId, this));
+            }
         }
         Unit::AddToWorld();
 
@@ -276,9 +279,9 @@ void Creature::AddToWorld()
             GetVehicleKit()->Install();
         }
 
-        if (GetZoneScript())
+        if (ZoneScript* zoneScript = GetZoneScript())
         {
-            GetZoneScript()->OnCreatureCreate(this);
+            GetMap()->RunRegionExclusive([&]() { zoneScript->OnCreatureCreate(this); });
         }
 
         loot.sourceWorldObjectGUID = GetGUID();
@@ -293,8 +296,8 @@ void Creature::RemoveFromWorld()
     {
         sScriptMgr->OnCreatureRemoveWorld(this);
 
-        if (GetZoneScript())
-            GetZoneScript()->OnCreatureRemove(this);
+        if (ZoneScript* zoneScript = GetZoneScript())
+            GetMap()->RunRegionExclusive([&]() { zoneScript->OnCreatureRemove(this); });
 
         if (m_formation)
             sFormationMgr->RemoveCreatureFromGroup(m_formation, this);
@@ -304,6 +307,7 @@ void Creature::RemoveFromWorld()
 
         Unit::RemoveFromWorld();
 
+        auto guard = GetMap()->LockObjectStoresForWrite();
         if (m_spawnId)
             Acore::Containers::MultimapErasePair(GetMap()->GetCreatureBySpawnIdStore(), m_spawnId, this);
 
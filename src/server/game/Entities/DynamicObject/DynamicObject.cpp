@@ -63,7 +63,10 @@ void DynamicObject::AddToWorld()
     ///- Register the dynamicObject for guid lookup and for caster
     if (!IsInWorld())
     {
-        GetMap()->GetObjectsStore().Insert<DynamicObject>(GetGUID(), this);
+        {
+            auto guard = GetMap()->LockObjectStoresForWrite();
+            GetMap()->GetObjectsStore().Insert<DynamicObject>(GetGUID(), this);
+        }
 
         WorldObject::AddToWorld();
 
@@ -93,6 +96,7 @@ void DynamicObject::RemoveFromWorld()
 
         WorldObject::RemoveFromWorld();
 
+        auto guard = GetMap()->LockObjectStoresForWrite();
         GetMap()->GetObjectsStore().Remove<DynamicObject>(GetGUID());
     }
 }
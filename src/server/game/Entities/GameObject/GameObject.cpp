@@ -144,11 +144,14 @@ void GameObject::AddToWorld()
     if (!IsInWorld())
     {
         if (m_zoneScript)
-            m_zoneScript->OnGameObjectCreate(this);
+            GetMap()->RunRegionExclusive([&]() { m_zoneScript->OnGameObjectCreate(this); });
 
-        GetMap()->GetObjectsStore().Insert<GameObject>(GetGUID(), this);
-        if (m_spawnId)
-            GetMap()->GetGameObjectBySpawnIdStore().insert(std::make_pair(m_spawnId, this));
+        {
+            auto guard = GetMap()->LockObjectStoresForWrite();
+            GetMap()->GetObjectsStore().Insert<GameObject>(GetGUID(), this);
+            if (m_spawnId)
+                GetMap()->GetGameObjectBySpawnIdStore().insert(std::make_pair(m_spawnId, this));
+        }
 
         if (m_model)
         {
@@ -174,7 +177,7 @@ void GameObject::RemoveFromWorld()
         sScriptMgr->OnGameObjectRemoveWorld(this);
 
         if (m_zoneScript)
-            m_zoneScript->OnGameObjectRemove(this);
+            GetMap()->RunRegionExclusive([&]() { m_zoneScript->OnGameObjectRemove(this); });
 
         RemoveFromOwner();
 
@@ -193,6 +196,7 @@ void GameObject::RemoveFromWorld()
 
         WorldObject::RemoveFromWorld();
 
+        auto guard = GetMap()->LockObjectStoresForWrite();
         if (m_spawnId)
             Acore::Containers::MultimapErasePair(GetMap()->GetGameObjectBySpawnIdStore(), m_spawnId, this);
         GetMap()->GetObjectsStore().Remove<GameObject>(GetGUID());
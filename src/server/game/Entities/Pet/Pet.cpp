@@ -73,7 +73,10 @@ void Pet::AddToWorld()
     if (!IsInWorld())
     {
         ///- Register the pet for guid lookup
-        GetMap()->GetObjectsStore().Insert<Pet>(GetGUID(), this);
+        {
+            auto guard = GetMap()->LockObjectStoresForWrite();
+            GetMap()->GetObjectsStore().Insert<Pet>(GetGUID(), this);
+        }
         Unit::AddToWorld();
         Motion_Initialize();
         AIM_Initialize();
@@ -116,6 +119,7 @@ void Pet::RemoveFromWorld()
     {
         ///- Don't call the function for Creature, normal mobs + totems go in a different storage
         Unit::RemoveFromWorld();
+        auto guard = GetMap()->LockObjectStoresForWrite();
         GetMap()->GetObjectsStore().Remove<Pet>(GetGUID());
     }
 }
@@ -390,6 +390,8 @@ Player::Player(WorldSession* session): Unit(true), m_mover(this)
     m_achievementMgr = new AchievementMgr(this);
     m_reputationMgr = new ReputationMgr(this);
 
+    m_committedSave = std::make_shared<PlayerSaveSnapshot>();
+
     // Ours
     m_NeedToSaveGlyphs = false;
     m_MountBlockId = 0;
@@ -3720,9 +3722,22 @@ void Player::_LoadSpellCooldowns(PreparedQueryResult result)
 
 void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    // rows store the end time, they only change when a cooldown starts, is modified or removed
+    Optional<SpellCooldowns> const& committedCooldowns = m_committedSave->spellCooldowns;
+    bool const fullSave = logout || !committedCooldowns;
+    SpellCooldowns savedCooldowns;
+
+    // whatever is left in here afterwards is no longer saved
+    SpellCooldowns unmatchedCooldowns = fullSave ? SpellCooldowns() : *committedCooldowns;
+
+    CharacterDatabasePreparedStatement* stmt = nullptr;
+
+    if (fullSave)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
+        stmt->SetData(0, GetGUID().GetCounter());
+        trans->Append(stmt);
+    }
 
     time_t curTime = GameTime::GetGameTime().count();
     uint32 curMSTime = GameTime::GetGameTimeMS().count();
@@ -3745,9 +3760,28 @@ void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout
             m_spellCooldowns.erase(itr++);
         else if (itr->second.end <= infTime && (logout || itr->second.end > (curMSTime + 5 * MINUTE * IN_MILLISECONDS)))             // not save locked cooldowns, it will be reset or set at reload
         {
+            savedCooldowns.emplace(itr->first, itr->second);
+
+            if (!fullSave)
+            {
+                auto saved = unmatchedCooldowns.find(itr->first);
+                if (saved != unmatchedCooldowns.end())
+                {
+                    bool const unchanged = saved->second.end == itr->second.end && saved->second.category == itr->second.category &&
+                        saved->second.itemid == itr->second.itemid && saved->second.needSendToClient == itr->second.needSendToClient;
+                    unmatchedCooldowns.erase(saved);
+
+                    if (unchanged)
+                    {
+                        ++itr;
+                        continue;
+                    }
+                }
+            }
+
             if (first_round)
             {
-                ss << "INSERT INTO character_spell_cooldown (guid, spell, category, item, time, needSend) VALUES ";
+                ss << (fullSave ? "INSERT" : "REPLACE") << " INTO character_spell_cooldown (guid, spell, category, item, time, needSend) VALUES ";
                 first_round = false;
             }
             // next new/changed record prefix
@@ -3765,6 +3799,27 @@ void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout
     if (!first_round)
         trans->Append(ss.str().c_str());
 
+    for (auto const& [spellId, cooldown] : unmatchedCooldowns)
+    {
+        // rows of expired cooldowns are skipped at load and dropped by the next full save
+        if (cooldown.end <= curMSTime)
+            continue;
+
+        // still running, just no longer worth saving: the row stays accurate
+        SpellCooldowns::const_iterator current = m_spellCooldowns.find(spellId);
+        if (current != m_spellCooldowns.end() && current->second.end == cooldown.end)
+        {
+            savedCooldowns.emplace(spellId, cooldown);
+            continue;
+        }
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN_BY_SPELL);
+        stmt->SetData(0, GetGUID().GetCounter());
+        stmt->SetData(1, spellId);
+        trans->Append(stmt);
+    }
+
+    m_pendingSave.spellCooldowns = std::move(savedCooldowns);
 }
 
 uint32 Player::resetTalentsCost() const
@@ -4643,7 +4698,7 @@ void Player::ResurrectPlayer(float restore_percent, bool applySickness)
     uint32 newzone, newarea;
     GetZoneAndAreaId(newzone, newarea);
     UpdateZone(newzone, newarea);
-    sOutdoorPvPMgr->HandlePlayerResurrects(this, newzone);
+    GetMap()->RunRegionExclusive([&]() { sOutdoorPvPMgr->HandlePlayerResurrects(this, newzone); });
 
     if (Battleground* bg = GetBattleground())
         bg->HandlePlayerResurrect(this);
@@ -6027,22 +6082,24 @@ void Player::SaveRecallPosition()
 
 void Player::SendMessageToSetInRange(WorldPacket const* data, float dist, bool self, bool includeMargin, Player const* skipped_rcvr) const
 {
-    if (self)
-        GetSession()->SendPacket(data);
-
     dist += GetObjectSize();
     if (includeMargin)
         dist += VISIBILITY_COMPENSATION; // pussywizard: to ensure everyone receives all important packets
     Acore::MessageDistDeliverer notifier(this, data, dist, false, skipped_rcvr);
+
+    if (self)
+        GetSession()->SendPacket(notifier.GetSharedMessage());
+
     Cell::VisitWorldObjects(this, notifier, dist);
 }
 
 void Player::SendMessageToSetInRange_OwnTeam(WorldPacket const* data, float dist, bool self) const
 {
+    Acore::MessageDistDeliverer notifier(this, data, dist, true);
+
     if (self)
-        GetSession()->SendPacket(data);
+        GetSession()->SendPacket(notifier.GetSharedMessage());
 
-    Acore::MessageDistDeliverer notifier(this, data, dist, true);
     Cell::VisitWorldObjects(this, notifier, dist);
 }
 
@@ -9862,23 +9919,57 @@ void Player::SendForgeUIMsg(std::string topic, std::string message) {
     if (message.length() == 0)
         return;
 
-    if (2048 < message.length())
+    std::vector<std::string> parts;
+    BuildForgeUIMsgParts(topic, message, parts);
+    SendForgeUIMsgParts(parts);
+}
+
+void Player::BuildForgeUIMsgParts(ForgeTopic topic, std::string_view message, std::vector<std::string>& parts)
+{
+    BuildForgeUIMsgParts(std::to_string((int)topic), message, parts);
+}
+
+void Player::BuildForgeUIMsgParts(std::string_view topic, std::string_view message, std::vector<std::string>& parts)
+{
+    constexpr std::size_t partLength = 2048;
+
+    parts.clear();
+
+    if (message.empty())
+        return;
+
+    // FORGE\t<topic>|<message> or, for long messages, FORGE\t<topic>}<part>}<total>|<message part>
+    if (partLength >= message.length())
+    {
+        std::string& part = parts.emplace_back();
+        part.reserve(MSG_TYPE_FORGE.length() + topic.length() + message.length() + 2);
+        part.append(MSG_TYPE_FORGE).append("\t").append(topic).append("|").append(message);
+        return;
+    }
+
+    std::size_t const count = (message.length() + partLength - 1) / partLength;
+    std::string const countStr = std::to_string(count);
+    parts.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
     {
-        std::vector<std::string> msgParts = SplitString(message, 2048);
-        std::string sizeStr = std::to_string(msgParts.size());
+        std::string_view const chunk = message.substr(i * partLength, partLength);
+        std::string const index = std::to_string(i + 1);
 
-        for (std::size_t i = 0; i < msgParts.size(); ++i)
-        {
-            std::string msg = topic + "}" + std::to_string(i + 1) + "}" + sizeStr + "|" + msgParts[i];
-            msg = MSG_TYPE_FORGE + "\t" + msg;
-            Whisper(msg, LANG_ADDON, this);
-        }
+        std::string& part = parts.emplace_back();
+        part.reserve(MSG_TYPE_FORGE.length() + topic.length() + index.length() + countStr.length() + chunk.length() + 4);
+        part.append(MSG_TYPE_FORGE).append("\t").append(topic).append("}").append(index).append("}").append(countStr).append("|").append(chunk);
     }
-    else
+}
+
+void Player::SendForgeUIMsgParts(std::vector<std::string> const& parts)
+{
+    // Addon payloads whispered to ourselves, there is nothing for the chat hooks and whisper checks to act on
+    WorldPacket data;
+    for (std::string const& part : parts)
     {
-        message = topic + "|" + message;
-        message = MSG_TYPE_FORGE + "\t" + message;
-        Whisper(message, LANG_ADDON, this);
+        ChatHandler::BuildChatPacket(data, CHAT_MSG_WHISPER, LANG_ADDON, this, this, part);
+        GetSession()->SendPacket(&data);
     }
 }
 
@@ -15106,6 +15197,13 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     if (!mEntry)
         return;
 
+    Optional<EntryPointData> const& committedEntryPoint = m_committedSave->entryPoint;
+    if (committedEntryPoint && committedEntryPoint->mountSpell == m_entryPointData.mountSpell && committedEntryPoint->taxiPath == m_entryPointData.taxiPath &&
+        committedEntryPoint->joinPos.GetMapId() == m_entryPointData.joinPos.GetMapId() && committedEntryPoint->joinPos == m_entryPointData.joinPos)
+        return;
+
+    m_pendingSave.entryPoint = m_entryPointData;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -16460,6 +16558,11 @@ void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
     if (_instanceResetTimes.empty())
         return;
 
+    if (m_committedSave->instanceResetTimes && *m_committedSave->instanceResetTimes == _instanceResetTimes)
+        return;
+
+    m_pendingSave.instanceResetTimes = _instanceResetTimes;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
     stmt->SetData(0, GetSession()->GetAccountId());
     trans->Append(stmt);
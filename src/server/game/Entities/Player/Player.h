@@ -18,6 +18,7 @@
 #ifndef _PLAYER_H
 #define _PLAYER_H
 
+#include "AnticheatData.h"
 #include "ArenaTeam.h"
 #include "Battleground.h"
 #include "CharacterCache.h"
@@ -45,7 +46,10 @@
 #include "TradeData.h"
 #include "Unit.h"
 #include "WorldSession.h"
+#include <map>
+#include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 struct CreatureTemplate;
@@ -214,8 +218,8 @@ struct SpellModifier
 struct ForgeAddonMessage
 {
     Player* player;
-    std::string topic;
-    std::string message;
+    ForgeTopic topic;
+    std::string_view message;   // points into the received chat message, only valid while it is handled
 };
 
 struct PresetData
@@ -244,6 +248,22 @@ struct SpellCooldown
 typedef std::map<uint32, SpellCooldown> SpellCooldowns;
 typedef std::unordered_map<uint32 /*instanceId*/, time_t/*releaseTime*/> InstanceTimeMap;
 
+// character_aura row as last written, without the remaining duration: it changes every tick and only full saves refresh it
+struct SavedAura
+{
+    uint8 recalculateMask;
+    uint8 stackAmount;
+    uint8 charges;
+    int32 maxDuration;
+    std::array<int32, MAX_SPELL_EFFECTS> amount;
+    std::array<int32, MAX_SPELL_EFFECTS> baseAmount;
+
+    bool operator==(SavedAura const& right) const = default;
+};
+
+typedef std::tuple<uint64 /*casterGuid*/, uint64 /*itemGuid*/, uint32 /*spell*/, uint8 /*effectMask*/> SavedAuraKey;
+typedef std::map<SavedAuraKey, SavedAura> SavedAuraMap;
+
 enum TrainerSpellState
 {
     TRAINER_SPELL_GREEN = 0,
@@ -1090,6 +1110,32 @@ struct EntryPointData
     [[nodiscard]] bool HasTaxiPath() const { return taxiPath[0] && taxiPath[1]; }
 };
 
+// Database state of the sections autosaves only write when they changed.
+// A section is unset until its first full save, which rewrites it.
+struct PlayerSaveSnapshot
+{
+    Optional<SavedAuraMap> auras;
+    Optional<SpellCooldowns> spellCooldowns;
+    Optional<EntryPointData> entryPoint;
+    Optional<InstanceTimeMap> instanceResetTimes;
+    Optional<std::map<std::string, std::string>> settings;          // source -> saved data
+
+    // takes over the sections written by a committed save
+    void Update(PlayerSaveSnapshot&& saved)
+    {
+        if (saved.auras)
+            auras = std::move(saved.auras);
+        if (saved.spellCooldowns)
+            spellCooldowns = std::move(saved.spellCooldowns);
+        if (saved.entryPoint)
+            entryPoint = std::move(saved.entryPoint);
+        if (saved.instanceResetTimes)
+            instanceResetTimes = std::move(saved.instanceResetTimes);
+        if (saved.settings)
+            settings = std::move(saved.settings);
+    }
+};
+
 class Player : public Unit, public GridObject<Player>
 {
     friend class WorldSession;
@@ -1260,6 +1306,10 @@ public:
     std::vector<std::string> SplitString(const std::string& str, int splitLength);
     void SendForgeUIMsg(ForgeTopic topic, std::string message);
     void SendForgeUIMsg(int topic, std::string message);
+    /// Splits a Forge UI message into the framed addon whispers SendForgeUIMsg sends, so static payloads can be built once and reused
+    static void BuildForgeUIMsgParts(std::string_view topic, std::string_view message, std::vector<std::string>& parts);
+    static void BuildForgeUIMsgParts(ForgeTopic topic, std::string_view message, std::vector<std::string>& parts);
+    void SendForgeUIMsgParts(std::vector<std::string> const& parts);
 
     /*********************************************************/
     /***                    STORAGE SYSTEM                 ***/
@@ -1606,6 +1656,7 @@ public:
     void SaveToDB(bool create, bool logout);
     void SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout);
     void SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans);                    // fast save function for item/money cheating preventing
+    static void LogSaveMetrics();                                                        // sections skipped by the saves since the last call
     void _SaveSkills(CharacterDatabaseTransaction trans);
 
     static void Customize(CharacterCustomizeInfo const* customizeInfo, CharacterDatabaseTransaction trans);
@@ -2640,6 +2691,9 @@ public:
     void CompletedAchievement(AchievementEntry const* entry);
     [[nodiscard]] AchievementMgr* GetAchievementMgr() const { return m_achievementMgr; }
 
+    AnticheatData& GetAnticheatData() { return m_anticheatData; }
+    [[nodiscard]] AnticheatData const& GetAnticheatData() const { return m_anticheatData; }
+
     void SetCreationTime(Seconds creationTime) { m_creationTime = creationTime; }
     [[nodiscard]] Seconds GetCreationTime() const { return m_creationTime; }
 
@@ -3109,8 +3163,16 @@ private:
     AchievementMgr* m_achievementMgr;
     ReputationMgr*  m_reputationMgr;
 
+    AnticheatData m_anticheatData;
+
     SpellCooldowns m_spellCooldowns;
 
+    // Autosaves diff against m_committedSave, which only moves forward from the commit callback of
+    // SaveToDB: a failed or still queued save is written again by the next one.
+    // The _Save* functions record what they wrote in m_pendingSave.
+    std::shared_ptr<PlayerSaveSnapshot> m_committedSave;
+    PlayerSaveSnapshot m_pendingSave;
+
     uint32 m_ChampioningFaction;
 
     InstanceTimeMap _instanceResetTimes;
@@ -95,6 +95,8 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
         return;
     }
 
+    std::map<std::string, std::string> savedSettings;
+
     for (auto& itr : m_charSettingsMap)
     {
         std::ostringstream data;
@@ -104,12 +106,27 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
             data << setting.value << ' ';
         }
 
+        std::string& saved = savedSettings[itr.first];
+        saved = data.str();
+
+        // only sources that differ from the last committed save
+        if (m_committedSave->settings)
+        {
+            auto committed = m_committedSave->settings->find(itr.first);
+            if (committed != m_committedSave->settings->end() && committed->second == saved)
+            {
+                continue;
+            }
+        }
+
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_SETTINGS);
         stmt->SetData(0, GetGUID().GetCounter());
         stmt->SetData(1, itr.first);
-        stmt->SetData(2, data.str());
+        stmt->SetData(2, saved);
         trans->Append(stmt);
     }
+
+    m_pendingSave.settings = std::move(savedSettings);
 }
 
 void Player::UpdatePlayerSetting(std::string source, uint8 index, uint32 value)
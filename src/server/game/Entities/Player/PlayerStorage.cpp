@@ -47,6 +47,7 @@
 #include "Log.h"
 #include "LootItemStorage.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -80,6 +81,8 @@
 //  there is probably some underlying problem with imports which should properly addressed
 //  see: https://github.com/azerothcore/azerothcore-wotlk/issues/9766
 #include "GridNotifiersImpl.h"
+#include <array>
+#include <atomic>
 
 /*********************************************************/
 /***                    STORAGE SYSTEM                 ***/
@@ -7195,13 +7198,80 @@ bool Player::_LoadHomeBind(PreparedQueryResult result)
 /***                   SAVE SYSTEM                     ***/
 /*********************************************************/
 
+// Parts of the character that are only written when they changed, a section without any statement is reported as skipped
+enum PlayerSaveSection
+{
+    PLAYER_SAVE_SECTION_INVENTORY,
+    PLAYER_SAVE_SECTION_QUESTS,
+    PLAYER_SAVE_SECTION_TALENTS,
+    PLAYER_SAVE_SECTION_SPELLS,
+    PLAYER_SAVE_SECTION_SPELL_COOLDOWNS,
+    PLAYER_SAVE_SECTION_ACTIONS,
+    PLAYER_SAVE_SECTION_AURAS,
+    PLAYER_SAVE_SECTION_SKILLS,
+    PLAYER_SAVE_SECTION_ACHIEVEMENTS,
+    PLAYER_SAVE_SECTION_REPUTATION,
+    PLAYER_SAVE_SECTION_EQUIPMENT_SETS,
+    PLAYER_SAVE_SECTION_GLYPHS,
+    PLAYER_SAVE_SECTION_ENTRY_POINT,
+    PLAYER_SAVE_SECTION_INSTANCE_TIMES,
+    PLAYER_SAVE_SECTION_SETTINGS,
+    MAX_PLAYER_SAVE_SECTIONS
+};
+
+static char const* const PlayerSaveSectionNames[MAX_PLAYER_SAVE_SECTIONS] =
+{
+    "inventory",
+    "quests",
+    "talents",
+    "spells",
+    "spell_cooldowns",
+    "actions",
+    "auras",
+    "skills",
+    "achievements",
+    "reputation",
+    "equipment_sets",
+    "glyphs",
+    "entry_point",
+    "instance_times",
+    "settings"
+};
+
+// Skipped sections are summed over every save and reported with the overall status, not per player and save
+static std::array<std::atomic<uint32>, MAX_PLAYER_SAVE_SECTIONS> SkippedPlayerSaveSections;
+static std::atomic<uint32> PlayerSaves;
+
+void Player::LogSaveMetrics()
+{
+    uint32 const saves = PlayerSaves.exchange(0);
+    if (!saves)
+        return;
+
+    METRIC_VALUE("player_saves", saves);
+
+    for (uint8 i = 0; i < MAX_PLAYER_SAVE_SECTIONS; ++i)
+        METRIC_VALUE("player_save_skipped_sections", SkippedPlayerSaveSections[i].exchange(0), METRIC_TAG("section", PlayerSaveSectionNames[i]));
+}
+
 void Player::SaveToDB(bool create, bool logout)
 {
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
     SaveToDB(trans, create, logout);
 
-    CharacterDatabase.CommitTransaction(trans);
+    // the next autosaves keep writing these rows until the database has them
+    GetSession()->AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(trans, GetGUID().GetCounter())).AfterComplete(
+        [committedSave = std::weak_ptr<PlayerSaveSnapshot>(m_committedSave), pendingSave = std::move(m_pendingSave)](bool success) mutable
+    {
+        if (!success)
+            return;
+
+        if (std::shared_ptr<PlayerSaveSnapshot> snapshot = committedSave.lock())
+            snapshot->Update(std::move(pendingSave));
+    });
+
+    m_pendingSave = PlayerSaveSnapshot();
 }
 
 void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout)
@@ -7216,6 +7286,9 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
         return;
     }
 
+    // only what this transaction writes, callers committing it themselves leave the snapshot as it is
+    m_pendingSave = PlayerSaveSnapshot();
+
     // pussywizard: full save now, so clear partial additional saves
     m_additionalSaveTimer = 0;
     m_additionalSaveMask = 0;
@@ -7234,37 +7307,56 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
     if (m_mailsUpdated)                                     //save mails only when needed
         _SaveMail(trans);
 
-    _SaveEntryPoint(trans);
-    _SaveInventory(trans);
-    _SaveQuestStatus(trans);
-    _SaveDailyQuestStatus(trans);
-    _SaveWeeklyQuestStatus(trans);
-    _SaveSeasonalQuestStatus(trans);
-    _SaveMonthlyQuestStatus(trans);
-    _SaveTalents(trans);
-    _SaveSpells(trans);
-    _SaveSpellCooldowns(trans, logout);
-    _SaveActions(trans);
-    _SaveAuras(trans, logout);
-    _SaveSkills(trans);
-    m_achievementMgr->SaveToDB(trans);
-    m_reputationMgr->SaveToDB(trans);
-    _SaveEquipmentSets(trans);
+    uint32 skippedSections = 0;
+    auto saveSection = [&](PlayerSaveSection section, auto&& save)
+    {
+        std::size_t const statements = trans->GetSize();
+        save();
+
+        if (trans->GetSize() == statements)
+            skippedSections |= 1 << section;
+    };
+
+    saveSection(PLAYER_SAVE_SECTION_ENTRY_POINT, [&]() { _SaveEntryPoint(trans); });
+    saveSection(PLAYER_SAVE_SECTION_INVENTORY, [&]() { _SaveInventory(trans); });
+    saveSection(PLAYER_SAVE_SECTION_QUESTS, [&]()
+    {
+        _SaveQuestStatus(trans);
+        _SaveDailyQuestStatus(trans);
+        _SaveWeeklyQuestStatus(trans);
+        _SaveSeasonalQuestStatus(trans);
+        _SaveMonthlyQuestStatus(trans);
+    });
+    saveSection(PLAYER_SAVE_SECTION_TALENTS, [&]() { _SaveTalents(trans); });
+    saveSection(PLAYER_SAVE_SECTION_SPELLS, [&]() { _SaveSpells(trans); });
+    saveSection(PLAYER_SAVE_SECTION_SPELL_COOLDOWNS, [&]() { _SaveSpellCooldowns(trans, logout); });
+    saveSection(PLAYER_SAVE_SECTION_ACTIONS, [&]() { _SaveActions(trans); });
+    saveSection(PLAYER_SAVE_SECTION_AURAS, [&]() { _SaveAuras(trans, logout); });
+    saveSection(PLAYER_SAVE_SECTION_SKILLS, [&]() { _SaveSkills(trans); });
+    saveSection(PLAYER_SAVE_SECTION_ACHIEVEMENTS, [&]() { m_achievementMgr->SaveToDB(trans); });
+    saveSection(PLAYER_SAVE_SECTION_REPUTATION, [&]() { m_reputationMgr->SaveToDB(trans); });
+    saveSection(PLAYER_SAVE_SECTION_EQUIPMENT_SETS, [&]() { _SaveEquipmentSets(trans); });
     GetSession()->SaveTutorialsData(trans);                 // changed only while character in game
-    _SaveGlyphs(trans);
-    _SaveInstanceTimeRestrictions(trans);
-    _SavePlayerSettings(trans);
+    saveSection(PLAYER_SAVE_SECTION_GLYPHS, [&]() { _SaveGlyphs(trans); });
+    saveSection(PLAYER_SAVE_SECTION_INSTANCE_TIMES, [&]() { _SaveInstanceTimeRestrictions(trans); });
+    saveSection(PLAYER_SAVE_SECTION_SETTINGS, [&]() { _SavePlayerSettings(trans); });
+
+    ++PlayerSaves;
+    for (uint8 i = 0; i < MAX_PLAYER_SAVE_SECTIONS; ++i)
+        if (skippedSections & (1 << i))
+            ++SkippedPlayerSaveSections[i];
 
     // check if stats should only be saved on logout
     // save stats can be out of transaction
     if (m_session->isLogingOut() || !sWorld->getBoolConfig(CONFIG_STATS_SAVE_ONLY_ON_LOGOUT))
         _SaveStats(trans);
 
-    // we save the data here to prevent spamming
-    sAnticheatMgr->SavePlayerData(this);
-
-    // in this way we prevent to spam the db by each report made!
-    // sAnticheatMgr->SavePlayerData(this);
+    // we save the data here to prevent spamming, and only when reports were added since the last save
+    if (m_anticheatData.HasReportsChanged())
+    {
+        sAnticheatMgr->SavePlayerData(this, trans);
+        m_anticheatData.SetReportsChanged(false);
+    }
 
     // save pet (hunter pet level and experience and all type pets health/mana).
     if (Pet* pet = GetPet())
@@ -7360,9 +7452,22 @@ void Player::SaveLoadoutActions(uint32 specId, uint8 loadoutId)
 
 void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    // a full save rewrites every aura to refresh remaining durations, autosaves only write the auras that were added, removed or changed
+    Optional<SavedAuraMap> const& committedAuras = m_committedSave->auras;
+    bool const fullSave = logout || !committedAuras;
+    SavedAuraMap savedAuras;
+
+    // whatever is left in here afterwards was removed
+    SavedAuraMap unmatchedAuras = fullSave ? SavedAuraMap() : *committedAuras;
+
+    CharacterDatabasePreparedStatement* stmt = nullptr;
+
+    if (fullSave)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
+        stmt->SetData(0, GetGUID().GetCounter());
+        trans->Append(stmt);
+    }
 
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
@@ -7373,47 +7478,79 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
         if( !logout && aura->GetDuration() < 60 * IN_MILLISECONDS )
             continue;
 
-        int32 damage[MAX_SPELL_EFFECTS];
-        int32 baseDamage[MAX_SPELL_EFFECTS];
+        SavedAura row;
+        row.recalculateMask = 0;
+        row.stackAmount = aura->GetStackAmount();
+        row.charges = aura->GetCharges();
+        row.maxDuration = aura->GetMaxDuration();
+
         uint8 effMask = 0;
-        uint8 recalculateMask = 0;
         for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
         {
             if (AuraEffect const* effect = aura->GetEffect(i))
             {
-                baseDamage[i] = effect->GetBaseAmount();
-                damage[i] = effect->GetAmount();
+                row.baseAmount[i] = effect->GetBaseAmount();
+                row.amount[i] = effect->GetAmount();
                 effMask |= 1 << i;
                 if (effect->CanBeRecalculated())
-                    recalculateMask |= 1 << i;
+                    row.recalculateMask |= 1 << i;
             }
             else
             {
-                baseDamage[i] = 0;
-                damage[i] = 0;
+                row.baseAmount[i] = 0;
+                row.amount[i] = 0;
+            }
+        }
+
+        SavedAuraKey key(aura->GetCasterGUID().GetRawValue(), aura->GetCastItemGUID().GetRawValue(), aura->GetId(), effMask);
+        savedAuras.emplace(key, row);
+
+        if (!fullSave)
+        {
+            auto saved = unmatchedAuras.find(key);
+            if (saved != unmatchedAuras.end())
+            {
+                bool const unchanged = saved->second == row;
+                unmatchedAuras.erase(saved);
+
+                if (unchanged)
+                    continue;
             }
         }
 
         uint8 index = 0;
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AURA);
+        stmt = CharacterDatabase.GetPreparedStatement(fullSave ? CHAR_INS_AURA : CHAR_REP_AURA);
         stmt->SetData(index++, GetGUID().GetCounter());
-        stmt->SetData(index++, itr->second->GetCasterGUID().GetRawValue());
-        stmt->SetData(index++, itr->second->GetCastItemGUID().GetRawValue());
-        stmt->SetData(index++, itr->second->GetId());
+        stmt->SetData(index++, std::get<0>(key));
+        stmt->SetData(index++, std::get<1>(key));
+        stmt->SetData(index++, std::get<2>(key));
         stmt->SetData(index++, effMask);
-        stmt->SetData(index++, recalculateMask);
-        stmt->SetData(index++, itr->second->GetStackAmount());
-        stmt->SetData(index++, damage[0]);
-        stmt->SetData(index++, damage[1]);
-        stmt->SetData(index++, damage[2]);
-        stmt->SetData(index++, baseDamage[0]);
-        stmt->SetData(index++, baseDamage[1]);
-        stmt->SetData(index++, baseDamage[2]);
-        stmt->SetData(index++, itr->second->GetMaxDuration());
-        stmt->SetData(index++, itr->second->GetDuration());
-        stmt->SetData(index, itr->second->GetCharges());
+        stmt->SetData(index++, row.recalculateMask);
+        stmt->SetData(index++, row.stackAmount);
+        stmt->SetData(index++, row.amount[0]);
+        stmt->SetData(index++, row.amount[1]);
+        stmt->SetData(index++, row.amount[2]);
+        stmt->SetData(index++, row.baseAmount[0]);
+        stmt->SetData(index++, row.baseAmount[1]);
+        stmt->SetData(index++, row.baseAmount[2]);
+        stmt->SetData(index++, row.maxDuration);
+        stmt->SetData(index++, aura->GetDuration());
+        stmt->SetData(index, row.charges);
+        trans->Append(stmt);
+    }
+
+    for (auto const& [key, row] : unmatchedAuras)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA_BY_SPELL);
+        stmt->SetData(0, GetGUID().GetCounter());
+        stmt->SetData(1, std::get<0>(key));
+        stmt->SetData(2, std::get<1>(key));
+        stmt->SetData(3, std::get<2>(key));
+        stmt->SetData(4, std::get<3>(key));
         trans->Append(stmt);
     }
+
+    m_pendingSave.auras = std::move(savedAuras);
 }
 
 void Player::_SaveInventory(CharacterDatabaseTransaction trans)
@@ -1247,10 +1247,13 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea)
 
     if (m_zoneUpdateId != newZone)
     {
-        sOutdoorPvPMgr->HandlePlayerLeaveZone(this, m_zoneUpdateId);
-        sOutdoorPvPMgr->HandlePlayerEnterZone(this, newZone);
-        sBattlefieldMgr->HandlePlayerLeaveZone(this, m_zoneUpdateId);
-        sBattlefieldMgr->HandlePlayerEnterZone(this, newZone);
+        GetMap()->RunRegionExclusive([&]()
+        {
+            sOutdoorPvPMgr->HandlePlayerLeaveZone(this, m_zoneUpdateId);
+            sOutdoorPvPMgr->HandlePlayerEnterZone(this, newZone);
+            sBattlefieldMgr->HandlePlayerLeaveZone(this, m_zoneUpdateId);
+            sBattlefieldMgr->HandlePlayerEnterZone(this, newZone);
+        });
         SendInitWorldStates(newZone,
                             newArea); // only if really enters to new zone, not
                                       // just area change, works strange...
@@ -1281,7 +1284,7 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea)
             WeatherMgr::SendFineWeatherUpdateToPlayer(this);
     }
 
-    sScriptMgr->OnPlayerUpdateZone(this, newZone, newArea);
+    GetMap()->RunRegionExclusive([&]() { sScriptMgr->OnPlayerUpdateZone(this, newZone, newArea); });
 
     // in PvP, any not controlled zone (except zone->team == 6, default case)
     // in PvE, only opposition team capital
@@ -15,7 +15,6 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "Config.h"
 #include "Creature.h"
 #include "Pet.h"
 #include "Player.h"
@@ -24,6 +23,7 @@
 #include "SpellAuraEffects.h"
 #include "SpellMgr.h"
 #include "Unit.h"
+#include "World.h"
 
 inline bool _ModifyUInt32(bool apply, uint32& baseValue, int32& amount)
 {
@@ -650,9 +650,9 @@ void Player::UpdateBlockPercentage()
         // Increase from rating
         value += GetRatingBonusValue(CR_BLOCK);
 
-        if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false))
+        if (sWorld->getBoolConfig(CONFIG_STATS_LIMITS_ENABLE))
         {
-            value = value > sConfigMgr->GetOption<float>("Stats.Limits.Block", 95.0f) ? sConfigMgr->GetOption<float>("Stats.Limits.Block", 95.0f) : value;
+            value = std::min(value, sWorld->getFloatConfig(CONFIG_STATS_LIMITS_BLOCK));
         }
 
         value = value < 0.0f ? 0.0f : value;
@@ -690,9 +690,9 @@ void Player::UpdateCritPercentage(WeaponAttackType attType)
     // Modify crit from weapon skill and maximized defense skill of same level victim difference
     value += (int32(GetWeaponSkillValue(attType)) - int32(GetMaxSkillValueForLevel())) * 0.04f;
 
-    if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false))
+    if (sWorld->getBoolConfig(CONFIG_STATS_LIMITS_ENABLE))
     {
-        value = value > sConfigMgr->GetOption<float>("Stats.Limits.Crit", 95.0f) ? sConfigMgr->GetOption<float>("Stats.Limits.Crit", 95.0f) : value;
+        value = std::min(value, sWorld->getFloatConfig(CONFIG_STATS_LIMITS_CRIT));
     }
 
     value = value < 0.0f ? 0.0f : value;
@@ -800,9 +800,9 @@ void Player::UpdateParryPercentage()
 
         value = std::max(diminishing + nondiminishing, 0.0f);
 
-        if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false))
+        if (sWorld->getBoolConfig(CONFIG_STATS_LIMITS_ENABLE))
         {
-            value = value > sConfigMgr->GetOption<float>("Stats.Limits.Parry", 95.0f) ? sConfigMgr->GetOption<float>("Stats.Limits.Parry", 95.0f) : value;
+            value = std::min(value, sWorld->getFloatConfig(CONFIG_STATS_LIMITS_PARRY));
         }
     }
 
@@ -845,9 +845,9 @@ void Player::UpdateDodgePercentage()
     m_realDodge = m_realDodge < 0.0f ? 0.0f : m_realDodge;
     float value = std::max(diminishing + nondiminishing, 0.0f);
 
-    if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false))
+    if (sWorld->getBoolConfig(CONFIG_STATS_LIMITS_ENABLE))
     {
-        value = value > sConfigMgr->GetOption<float>("Stats.Limits.Dodge", 95.0f) ? sConfigMgr->GetOption<float>("Stats.Limits.Dodge", 95.0f) : value;
+        value = std::min(value, sWorld->getFloatConfig(CONFIG_STATS_LIMITS_DODGE));
     }
 
     SetStatFloatValue(PLAYER_DODGE_PERCENTAGE, value);
@@ -278,7 +278,7 @@ Unit::Unit(bool isWorldObject) : WorldObject(isWorldObject),
     m_lastSanctuaryTime(0),
     IsAIEnabled(false), NeedChangeAI(false), m_ControlledByPlayer(false),
     movespline(new Movement::MoveSpline()), i_AI(nullptr), i_disabledAI(nullptr),
-    m_AutoRepeatFirstCast(false), m_procDeep(0), m_removedAurasCount(0),
+    m_AutoRepeatFirstCast(false), m_procDeep(0), m_removedAurasCount(0), m_procAurasFlags(0), m_procAurasGeneration(0),
     i_motionMaster(new MotionMaster(this)), m_regenTimer(0), m_vehicle(nullptr),
     m_vehicleKit(nullptr), m_unitTypeMask(UNIT_MASK_NONE), m_Diminishing(), m_combatManager(this),
     m_threatManager(this), m_comboTarget(nullptr), m_comboPoints(0)
@@ -468,7 +468,7 @@ void Unit::Update(uint32 p_time)
             {
                 m_delayed_unit_relocation_timer = 0;
                 //ExecuteDelayedUnitRelocationEvent();
-                FindMap()->i_objectsForDelayedVisibility.insert(this);
+                FindMap()->AddToDelayedVisibility(this);
             }
             else
                 m_delayed_unit_relocation_timer -= p_time;
@@ -4516,6 +4516,7 @@ AuraApplication* Unit::_CreateAuraApplication(Aura* aura, uint8 effMask)
 
     AuraApplication* aurApp = new AuraApplication(this, caster, aura, effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
+    _AddProcAura(aurApp);
 
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: even if it gets removed, it will be reapplied in a second
@@ -4648,6 +4649,7 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
 
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
+    _RemoveProcAura(aurApp);
 
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: event if it gets removed, it will be reapplied in a second
@@ -4766,6 +4768,29 @@ void Unit::_RegisterAuraEffect(AuraEffect* aurEff, bool apply)
         m_modAuras[aurEff->GetAuraType()].push_back(aurEff);
     else
         m_modAuras[aurEff->GetAuraType()].remove(aurEff);
+
+    InvalidateAuraModifierTotals(aurEff->GetAuraType());
+}
+
+void Unit::InvalidateAuraModifierTotals(AuraType auraType)
+{
+    // an aura of another grid region changed, its region may be reading this cache right now
+    if (Map* map = FindMap(); map && !map->IsObjectUpdatedByCurrentThread(this))
+    {
+        map->RunRegionExclusive([this, auraType]() { m_auraModifierTotals.Invalidate(auraType); });
+        return;
+    }
+
+    m_auraModifierTotals.Invalidate(auraType);
+}
+
+AuraModifierTotals Unit::GetAuraModifierTotals(AuraType auraType) const
+{
+    // other grid regions of a parallel map update must not touch the cache, they get a plain walk
+    if (Map const* map = FindMap(); map && !map->IsObjectUpdatedByCurrentThread(this))
+        return AuraModifierTotals::Compute(GetAuraEffectsByType(auraType));
+
+    return m_auraModifierTotals.Get(auraType, GetAuraEffectsByType(auraType));
 }
 
 // All aura base removes should go threw this function!
@@ -6056,16 +6081,10 @@ int32 Unit::GetTotalAuraModifierAreaExclusive(AuraType auratype) const
 
 int32 Unit::GetTotalAuraModifier(AuraType auratype) const
 {
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    if (mTotalAuraList.empty())
+    if (m_modAuras[auratype].empty())
         return 0;
 
-    int32 modifier = 0;
-
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        modifier += (*i)->GetAmount();
-
-    return modifier;
+    return GetAuraModifierTotals(auratype).Total;
 }
 
 int32 Unit::GetTotalAuraModifier(AuraType auratype, bool checkCombat) const
@@ -6086,39 +6105,26 @@ int32 Unit::GetTotalAuraModifier(AuraType auratype, bool checkCombat) const
 
 float Unit::GetTotalAuraMultiplier(AuraType auratype) const
 {
-    float multiplier = 1.0f;
-
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        AddPct(multiplier, (*i)->GetAmount());
+    if (m_modAuras[auratype].empty())
+        return 1.0f;
 
-    return multiplier;
+    return GetAuraModifierTotals(auratype).Multiplier;
 }
 
 int32 Unit::GetMaxPositiveAuraModifier(AuraType auratype)
 {
-    int32 modifier = 0;
-
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-    {
-        if ((*i)->GetAmount() > modifier)
-            modifier = (*i)->GetAmount();
-    }
+    if (m_modAuras[auratype].empty())
+        return 0;
 
-    return modifier;
+    return GetAuraModifierTotals(auratype).MaxPositive;
 }
 
 int32 Unit::GetMaxNegativeAuraModifier(AuraType auratype) const
 {
-    int32 modifier = 0;
-
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        if ((*i)->GetAmount() < modifier)
-            modifier = (*i)->GetAmount();
+    if (m_modAuras[auratype].empty())
+        return 0;
 
-    return modifier;
+    return GetAuraModifierTotals(auratype).MaxNegative;
 }
 
 int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const
@@ -11556,10 +11562,13 @@ void Unit::setDeathState(DeathState s, bool despawn)
         // players in instance don't have ZoneScript, but they have InstanceScript
         if (ZoneScript* zoneScript = GetZoneScript() ? GetZoneScript() : (ZoneScript*)GetInstanceScript())
         {
-            zoneScript->OnUnitDeath(this);
+            GetMap()->RunRegionExclusive([&]()
+            {
+                zoneScript->OnUnitDeath(this);
 
-            if (IsPlayer())
-                zoneScript->OnPlayerDeath(ToPlayer());
+                if (IsPlayer())
+                    zoneScript->OnPlayerDeath(ToPlayer());
+            });
         }
     }
     else if (s == DeathState::JustRespawned)
@@ -13118,6 +13127,42 @@ void Unit::ProcSkillsAndReactives(bool isVictim, Unit* procTarget, uint32 typeMa
         }
     }
 }
+void Unit::_AddProcAura(AuraApplication* aurApp)
+{
+    uint32 spellId = aurApp->GetBase()->GetId();
+    SpellProcEntry const* procEntry = sSpellMgr->GetSpellProcEntry(spellId);
+    if (!procEntry)
+        return;
+
+    // same position a multimap insert gives, after the applications of the same spell
+    auto itr = std::upper_bound(m_procAuras.begin(), m_procAuras.end(), spellId, [](uint32 id, ProcAuraEntry const& entry) { return id < entry.SpellId; });
+    m_procAuras.insert(itr, { spellId, procEntry->ProcFlags, aurApp });
+    m_procAurasFlags |= procEntry->ProcFlags;
+}
+
+void Unit::_RemoveProcAura(AuraApplication* aurApp)
+{
+    auto itr = std::find_if(m_procAuras.begin(), m_procAuras.end(), [aurApp](ProcAuraEntry const& entry) { return entry.Application == aurApp; });
+    if (itr == m_procAuras.end())
+        return;
+
+    m_procAuras.erase(itr);
+
+    m_procAurasFlags = 0;
+    for (ProcAuraEntry const& entry : m_procAuras)
+        m_procAurasFlags |= entry.ProcFlags;
+}
+
+void Unit::_RebuildProcAuras()
+{
+    m_procAuras.clear();
+    m_procAurasFlags = 0;
+    m_procAurasGeneration = sSpellMgr->GetSpellProcGeneration();
+
+    for (auto const& [spellId, aurApp] : m_appliedAuras)
+        _AddProcAura(aurApp);
+}
+
 void Unit::GetProcAurasTriggeredOnEvent(AuraApplicationProcContainer & aurasTriggeringProc, AuraApplicationList * procAuras, ProcEventInfo & eventInfo)
 {
     std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
@@ -13139,14 +13184,40 @@ void Unit::GetProcAurasTriggeredOnEvent(AuraApplicationProcContainer & aurasTrig
     // or generate one on our own
     else
     {
-        for (AuraApplicationMap::iterator itr = GetAppliedAuras().begin(); itr != GetAppliedAuras().end(); ++itr)
+        if (m_procAurasGeneration != sSpellMgr->GetSpellProcGeneration())
+            _RebuildProcAuras();
+
+        // only auras with a spell proc entry matching the event type can proc, see SpellMgr::CanSpellTriggerProcOnEvent
+        uint32 typeMask = eventInfo.GetTypeMask();
+        uint32 candidates = 0;
+
+        if (typeMask & m_procAurasFlags)
         {
-            if (uint8 procEffectMask = itr->second->GetBase()->GetProcEffectMask(itr->second, eventInfo, now))
+            // scripts run from the checks may apply or remove auras, so the index must not be walked while checking
+            std::vector<AuraApplication*> procCandidates;
+            procCandidates.reserve(m_procAuras.size());
+            for (ProcAuraEntry const& entry : m_procAuras)
+                if (entry.ProcFlags & typeMask)
+                    procCandidates.push_back(entry.Application);
+
+            candidates = procCandidates.size();
+
+            for (AuraApplication* aurApp : procCandidates)
             {
-                itr->second->GetBase()->PrepareProcToTrigger(itr->second, eventInfo, now);
-                aurasTriggeringProc.emplace_back(procEffectMask, itr->second);
+                // removed by the check of a previous candidate, still allocated until the owner deletes its removed applications
+                if (aurApp->GetRemoveMode())
+                    continue;
+
+                if (uint8 procEffectMask = aurApp->GetBase()->GetProcEffectMask(aurApp, eventInfo, now))
+                {
+                    aurApp->GetBase()->PrepareProcToTrigger(aurApp, eventInfo, now);
+                    aurasTriggeringProc.emplace_back(procEffectMask, aurApp);
+                }
             }
         }
+
+        if (Map* map = FindMap())
+            map->AddProcEventStats(candidates, m_appliedAuras.size());
     }
 }
 
@@ -14457,11 +14528,14 @@ void Unit::Kill(Unit* killer, Unit* victim, bool durabilityLoss, WeaponAttackTyp
     // handle player kill only if not suicide (spirit of redemption for example)
     if (player && killer != victim)
     {
-        if (OutdoorPvP* pvp = player->GetOutdoorPvP())
-            pvp->HandleKill(player, victim);
+        victim->GetMap()->RunRegionExclusive([&]()
+        {
+            if (OutdoorPvP* pvp = player->GetOutdoorPvP())
+                pvp->HandleKill(player, victim);
 
-        if (Battlefield* bf = sBattlefieldMgr->GetBattlefieldToZoneId(player->GetZoneId()))
-            bf->HandleKill(player, victim);
+            if (Battlefield* bf = sBattlefieldMgr->GetBattlefieldToZoneId(player->GetZoneId()))
+                bf->HandleKill(player, victim);
+        });
     }
 
     //if (victim->GetTypeId() == TYPEID_PLAYER)
@@ -19,6 +19,7 @@
 #define __UNIT_H
 
 #include "AreaTrigger.h"
+#include "AuraModifierTotals.h"
 #include "EventProcessor.h"
 #include "EnumFlag.h"
 #include "EventProcessor.h"
@@ -1955,6 +1956,8 @@ public:
     void _RemoveNoStackAurasDueToAura(Aura* aura);
     bool _IsNoStackAuraDueToAura(Aura* appliedAura, Aura* existingAura) const;
     void _RegisterAuraEffect(AuraEffect* aurEff, bool apply);
+    // drops the cached modifier totals of the type, needed whenever a registered effect changes its amount
+    void InvalidateAuraModifierTotals(AuraType auraType);
 
     // m_ownedAuras container management
     AuraMap&       GetOwnedAuras()       { return m_ownedAuras; }
@@ -2565,7 +2568,27 @@ protected:
     AuraMap::iterator m_auraUpdateIterator;
     uint32 m_removedAurasCount;
 
+    // applied auras having a spell_proc entry, kept in m_appliedAuras order so procs trigger in the same order
+    struct ProcAuraEntry
+    {
+        uint32 SpellId;
+        uint32 ProcFlags;
+        AuraApplication* Application;
+    };
+
+    void _AddProcAura(AuraApplication* aurApp);
+    void _RemoveProcAura(AuraApplication* aurApp);
+    void _RebuildProcAuras();
+
+    std::vector<ProcAuraEntry> m_procAuras;
+    uint32 m_procAurasFlags;                   // union of the ProcFlags in m_procAuras
+    uint32 m_procAurasGeneration;              // SpellMgr::GetSpellProcGeneration() m_procAuras was built with
+
+    // sums of every registered effect of one type, cached only by the thread updating the unit
+    AuraModifierTotals GetAuraModifierTotals(AuraType auraType) const;
+
     AuraEffectList m_modAuras[TOTAL_AURAS];
+    mutable AuraModifierTotalsCache m_auraModifierTotals;
     AuraList m_scAuras;                        // casted singlecast auras
     AuraApplicationList m_interruptableAuras;             // auras which have interrupt mask applied on unit
     AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
@@ -296,6 +296,7 @@ Creature* ObjectAccessor::GetSpawnedCreatureByDBGUID(uint32 mapId, uint64 guid)
 {
     if (Map* map = sMapMgr->FindBaseMap(mapId))
     {
+        auto guard = map->LockObjectStoresForRead();
         auto bounds = map->GetCreatureBySpawnIdStore().equal_range(guid);
 
         if (bounds.first == bounds.second)
@@ -322,6 +323,7 @@ GameObject* ObjectAccessor::GetSpawnedGameObjectByDBGUID(uint32 mapId, uint64 gu
 {
     if (Map* map = sMapMgr->FindBaseMap(mapId))
     {
+        auto guard = map->LockObjectStoresForRead();
         auto bounds = map->GetGameObjectBySpawnIdStore().equal_range(guid);
 
         if (bounds.first == bounds.second)
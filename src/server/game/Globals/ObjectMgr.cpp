@@ -40,6 +40,7 @@
 #include "MapMgr.h"
 #include "Pet.h"
 #include "PoolMgr.h"
+#include "QuerySnapshot.h"
 #include "ReputationMgr.h"
 #include "ScriptMgr.h"
 #include "Spell.h"
@@ -452,7 +453,7 @@ void ObjectMgr::LoadCreatureLocales()
     _creatureLocaleStore.clear();                              // need for reload case
 
     //                                               0      1       2     3
-    QueryResult result = WorldDatabase.Query("SELECT entry, locale, Name, Title FROM creature_template_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, locale, Name, Title FROM creature_template_locale");
     if (!result)
         return;
 
@@ -481,7 +482,7 @@ void ObjectMgr::LoadGossipMenuItemsLocales()
     _gossipMenuItemsLocaleStore.clear();                              // need for reload case
 
     //                                               0       1            2       3           4
-    QueryResult result = WorldDatabase.Query("SELECT MenuID, OptionID, Locale, OptionText, BoxText FROM gossip_menu_option_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT MenuID, OptionID, Locale, OptionText, BoxText FROM gossip_menu_option_locale");
 
     if (!result)
         return;
@@ -510,7 +511,7 @@ void ObjectMgr::LoadPetNamesLocales()
     uint32 oldMSTime = getMSTime();
 
     //                                                  0     1      2    3
-    QueryResult result = WorldDatabase.Query("SELECT Locale, Word, Entry, Half FROM pet_name_generation_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT Locale, Word, Entry, Half FROM pet_name_generation_locale");
 
     if (!result)
     {
@@ -552,7 +553,7 @@ void ObjectMgr::LoadPointOfInterestLocales()
     _pointOfInterestLocaleStore.clear();                              // need for reload case
 
     //                                               0   1       2
-    QueryResult result = WorldDatabase.Query("SELECT ID, locale, Name FROM points_of_interest_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, locale, Name FROM points_of_interest_locale");
 
     if (!result)
         return;
@@ -579,7 +580,7 @@ void ObjectMgr::LoadCreatureTemplates()
     uint32 oldMSTime = getMSTime();
 
 //                                                   0      1                   2                   3                   4            5            6         7         8
-    QueryResult result = WorldDatabase.Query("SELECT entry, difficulty_entry_1, difficulty_entry_2, difficulty_entry_3, KillCredit1, KillCredit2, modelid1, modelid2, modelid3, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, difficulty_entry_1, difficulty_entry_2, difficulty_entry_3, KillCredit1, KillCredit2, modelid1, modelid2, modelid3, "
 //                        9         10    11       12        13              14        15        16   17       18       19          20         21          22
                          "modelid4, name, subname, IconName, gossip_menu_id, minlevel, maxlevel, exp, faction, npcflag, speed_walk, speed_run, speed_swim, speed_flight, "
 //                        23               24     25      26         27              28              29               30            31             32          33          34
@@ -769,7 +770,7 @@ void ObjectMgr::LoadCreatureTemplateResistances()
     uint32 oldMSTime = getMSTime();
 
     //                                               0           1       2
-    QueryResult result = WorldDatabase.Query("SELECT CreatureID, School, Resistance FROM creature_template_resistance");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT CreatureID, School, Resistance FROM creature_template_resistance");
 
     if (!result)
     {
@@ -815,7 +816,7 @@ void ObjectMgr::LoadCreatureTemplateSpells()
     uint32 oldMSTime = getMSTime();
 
     //                                               0           1       2
-    QueryResult result = WorldDatabase.Query("SELECT CreatureID, `Index`, Spell FROM creature_template_spell");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT CreatureID, `Index`, Spell FROM creature_template_spell");
 
     if (!result)
     {
@@ -861,7 +862,7 @@ void ObjectMgr::LoadCreatureTemplateAddons()
     uint32 oldMSTime = getMSTime();
 
     //                                                0       1       2      3       4       5              6               7
-    QueryResult result = WorldDatabase.Query("SELECT entry, path_id, mount, bytes1, bytes2, emote, visibilityDistanceType, auras FROM creature_template_addon");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, path_id, mount, bytes1, bytes2, emote, visibilityDistanceType, auras FROM creature_template_addon");
 
     if (!result)
     {
@@ -1354,7 +1355,7 @@ void ObjectMgr::LoadCreatureAddons()
     uint32 oldMSTime = getMSTime();
 
     //                                                0       1       2      3       4       5             6                7
-    QueryResult result = WorldDatabase.Query("SELECT guid, path_id, mount, bytes1, bytes2, emote, visibilityDistanceType, auras FROM creature_addon");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT guid, path_id, mount, bytes1, bytes2, emote, visibilityDistanceType, auras FROM creature_addon");
 
     if (!result)
     {
@@ -1455,7 +1456,7 @@ void ObjectMgr::LoadGameObjectAddons()
     uint32 oldMSTime = getMSTime();
 
     //                                               0     1                 2
-    QueryResult result = WorldDatabase.Query("SELECT guid, invisibilityType, invisibilityValue FROM gameobject_addon");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT guid, invisibilityType, invisibilityValue FROM gameobject_addon");
 
     if (!result)
     {
@@ -1565,7 +1566,7 @@ void ObjectMgr::LoadEquipmentTemplates()
     uint32 oldMSTime = getMSTime();
 
     //                                                 0         1       2       3       4
-    QueryResult result = WorldDatabase.Query("SELECT CreatureID, ID, ItemID1, ItemID2, ItemID3 FROM creature_equip_template");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT CreatureID, ID, ItemID1, ItemID2, ItemID3 FROM creature_equip_template");
 
     if (!result)
     {
@@ -1645,7 +1646,7 @@ void ObjectMgr::LoadCreatureMovementOverrides()
     _creatureMovementOverrides.clear();
 
     // Load the data from creature_movement_override and if NULL fallback to creature_template_movement
-    QueryResult result = WorldDatabase.Query("SELECT cmo.SpawnId,"
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT cmo.SpawnId,"
                                              "COALESCE(cmo.Ground, ctm.Ground),"
                                              "COALESCE(cmo.Swim, ctm.Swim),"
                                              "COALESCE(cmo.Flight, ctm.Flight),"
@@ -1787,7 +1788,7 @@ void ObjectMgr::LoadCreatureModelInfo()
     uint32 oldMSTime = getMSTime();
 
     //                                                   0             1             2          3               4
-    QueryResult result = WorldDatabase.Query("SELECT DisplayID, BoundingRadius, CombatReach, Gender, DisplayID_Other_Gender FROM creature_model_info");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT DisplayID, BoundingRadius, CombatReach, Gender, DisplayID_Other_Gender FROM creature_model_info");
 
     if (!result)
     {
@@ -1845,7 +1846,7 @@ void ObjectMgr::LoadLinkedRespawn()
 
     _linkedRespawnStore.clear();
     //                                                 0        1          2
-    QueryResult result = WorldDatabase.Query("SELECT guid, linkedGuid, linkType FROM linked_respawn ORDER BY guid ASC");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT guid, linkedGuid, linkType FROM linked_respawn ORDER BY guid ASC");
 
     if (!result)
     {
@@ -2076,7 +2077,7 @@ void ObjectMgr::LoadTempSummons()
     uint32 oldMSTime = getMSTime();
 
     //                                                    0           1             2        3      4           5           6           7            8           9
-    QueryResult result = WorldDatabase.Query("SELECT summonerId, summonerType, groupId, entry, position_x, position_y, position_z, orientation, summonType, summonTime FROM creature_summon_groups");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT summonerId, summonerType, groupId, entry, position_x, position_y, position_z, orientation, summonType, summonTime FROM creature_summon_groups");
 
     if (!result)
     {
@@ -2162,7 +2163,7 @@ void ObjectMgr::LoadCreatures()
     uint32 oldMSTime = getMSTime();
 
     //                                                     0         1    2    3    4        5            6           7           8            9              10            11
-    QueryResult result = WorldDatabase.Query("SELECT creature.guid, id1, id2, id3, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT creature.guid, id1, id2, id3, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
                          //      12            13       14          15           16         17         18          19             20                 21                    22
                          "currentwaypoint, curhealth, curmana, MovementType, spawnMask, phaseMask, eventEntry, pool_entry, creature.npcflag, creature.unit_flags, creature.dynamicflags, "
                          //       23
@@ -2495,7 +2496,7 @@ void ObjectMgr::LoadGameobjects()
     uint32 count = 0;
 
     //                                                0                1   2    3           4           5           6
-    QueryResult result = WorldDatabase.Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
                          //   7          8          9          10         11             12            13     14         15         16          17
                          "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, spawnMask, phaseMask, eventEntry, pool_entry, "
                          //   18
@@ -2694,7 +2695,7 @@ void ObjectMgr::LoadItemLocales()
 
     _itemLocaleStore.clear();                                 // need for reload case
 
-    QueryResult result = WorldDatabase.Query("SELECT ID, locale, Name, Description FROM item_template_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, locale, Name, Description FROM item_template_locale");
     if (!result)
         return;
 
@@ -2721,7 +2722,7 @@ void ObjectMgr::LoadItemTemplates()
     uint32 oldMSTime = getMSTime();
 
     //                                                 0      1       2               3              4        5        6       7          8         9        10        11           12
-    QueryResult result = WorldDatabase.Query("SELECT entry, class, subclass, SoundOverrideSubclass, name, displayid, Quality, Flags, FlagsExtra, BuyCount, BuyPrice, SellPrice, InventoryType, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, class, subclass, SoundOverrideSubclass, name, displayid, Quality, Flags, FlagsExtra, BuyCount, BuyPrice, SellPrice, InventoryType, "
                          //                                              13              14           15          16             17               18                19              20
                          "AllowableClass, AllowableRace, ItemLevel, RequiredLevel, RequiredSkill, RequiredSkillRank, requiredspell, requiredhonorrank, "
                          //                                              21                      22                       23               24        25          26             27           28
@@ -3536,7 +3537,7 @@ void ObjectMgr::LoadItemSetNameLocales()
 
     _itemSetNameLocaleStore.clear();                                 // need for reload case
 
-    QueryResult result = WorldDatabase.Query("SELECT ID, locale, Name FROM item_set_names_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, locale, Name FROM item_set_names_locale");
 
     if (!result)
         return;
@@ -3579,7 +3580,7 @@ void ObjectMgr::LoadItemSetNames()
     }
 
     //                                                  0        1            2
-    QueryResult result = WorldDatabase.Query("SELECT `entry`, `name`, `InventoryType` FROM `item_set_names`");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT `entry`, `name`, `InventoryType` FROM `item_set_names`");
 
     if (!result)
     {
@@ -3651,7 +3652,7 @@ void ObjectMgr::LoadVehicleTemplateAccessories()
     uint32 count = 0;
 
     //                                                  0             1              2          3           4             5
-    QueryResult result = WorldDatabase.Query("SELECT `entry`, `accessory_entry`, `seat_id`, `minion`, `summontype`, `summontimer` FROM `vehicle_template_accessory`");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT `entry`, `accessory_entry`, `seat_id`, `minion`, `summontype`, `summontimer` FROM `vehicle_template_accessory`");
 
     if (!result)
     {
@@ -3707,7 +3708,7 @@ void ObjectMgr::LoadVehicleAccessories()
     uint32 count = 0;
 
     //                                                  0             1             2          3           4             5
-    QueryResult result = WorldDatabase.Query("SELECT `guid`, `accessory_entry`, `seat_id`, `minion`, `summontype`, `summontimer` FROM `vehicle_accessory`");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT `guid`, `accessory_entry`, `seat_id`, `minion`, `summontype`, `summontimer` FROM `vehicle_accessory`");
 
     if (!result)
     {
@@ -3747,7 +3748,7 @@ void ObjectMgr::LoadPetLevelInfo()
     uint32 oldMSTime = getMSTime();
 
     //                                                 0               1      2   3     4    5    6    7     8    9      10       11
-    QueryResult result = WorldDatabase.Query("SELECT creature_entry, level, hp, mana, str, agi, sta, inte, spi, armor, min_dmg, max_dmg FROM pet_levelstats");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT creature_entry, level, hp, mana, str, agi, sta, inte, spi, armor, min_dmg, max_dmg FROM pet_levelstats");
 
     if (!result)
     {
@@ -3887,7 +3888,7 @@ void ObjectMgr::LoadPlayerInfo()
     {
         uint32 oldMSTime = getMSTime();
         //                                                0     1      2    3        4          5           6
-        QueryResult result = WorldDatabase.Query("SELECT race, class, map, zone, position_x, position_y, position_z, orientation FROM playercreateinfo");
+        QueryResult result = sWorldDatabaseSnapshot->Query("SELECT race, class, map, zone, position_x, position_y, position_z, orientation FROM playercreateinfo");
 
         if (!result)
         {
@@ -3974,7 +3975,7 @@ void ObjectMgr::LoadPlayerInfo()
     {
         uint32 oldMSTime = getMSTime();
         //                                                0     1      2       3
-        QueryResult result = WorldDatabase.Query("SELECT race, class, itemid, amount FROM playercreateinfo_item");
+        QueryResult result = sWorldDatabaseSnapshot->Query("SELECT race, class, itemid, amount FROM playercreateinfo_item");
 
         if (!result)
         {
@@ -4045,7 +4046,7 @@ void ObjectMgr::LoadPlayerInfo()
     {
         uint32 oldMSTime = getMSTime();
 
-        QueryResult result = WorldDatabase.Query("SELECT raceMask, classMask, skill, `rank` FROM playercreateinfo_skills");
+        QueryResult result = sWorldDatabaseSnapshot->Query("SELECT raceMask, classMask, skill, `rank` FROM playercreateinfo_skills");
 
         if (!result)
         {
@@ -4120,7 +4121,7 @@ void ObjectMgr::LoadPlayerInfo()
     {
         uint32 oldMSTime = getMSTime();
 
-        QueryResult result = WorldDatabase.Query("SELECT racemask, classmask, Spell FROM playercreateinfo_spell_custom");
+        QueryResult result = sWorldDatabaseSnapshot->Query("SELECT racemask, classmask, Spell FROM playercreateinfo_spell_custom");
 
         if (!result)
         {
@@ -4178,7 +4179,7 @@ void ObjectMgr::LoadPlayerInfo()
     {
         uint32 oldMSTime = getMSTime();
 
-        QueryResult result = WorldDatabase.Query("SELECT raceMask, classMask, spell FROM playercreateinfo_cast_spell");
+        QueryResult result = sWorldDatabaseSnapshot->Query("SELECT raceMask, classMask, spell FROM playercreateinfo_cast_spell");
 
         if (!result)
         {
@@ -4237,7 +4238,7 @@ void ObjectMgr::LoadPlayerInfo()
         uint32 oldMSTime = getMSTime();
 
         //                                                0     1      2       3       4
-        QueryResult result = WorldDatabase.Query("SELECT race, class, button, action, type FROM playercreateinfo_action");
+        QueryResult result = sWorldDatabaseSnapshot->Query("SELECT race, class, button, action, type FROM playercreateinfo_action");
 
         if (!result)
         {
@@ -4290,7 +4291,7 @@ void ObjectMgr::LoadPlayerInfo()
         uint32 oldMSTime = getMSTime();
 
         //                                                          0       1         2        3         4        5
-        QueryResult raceStatsResult  = WorldDatabase.Query("SELECT Race, Strength, Agility, Stamina, Intellect, Spirit FROM player_race_stats");
+        QueryResult raceStatsResult  = sWorldDatabaseSnapshot->Query("SELECT Race, Strength, Agility, Stamina, Intellect, Spirit FROM player_race_stats");
 
         if (!raceStatsResult)
         {
@@ -4316,7 +4317,7 @@ void ObjectMgr::LoadPlayerInfo()
         } while (raceStatsResult->NextRow());
 
         //                                                 0      1       2         3        4         5        6       7        8
-        QueryResult result = WorldDatabase.Query("SELECT Class, Level, Strength, Agility, Stamina, Intellect, Spirit, BaseHP, BaseMana FROM player_class_stats");
+        QueryResult result = sWorldDatabaseSnapshot->Query("SELECT Class, Level, Strength, Agility, Stamina, Intellect, Spirit, BaseHP, BaseMana FROM player_class_stats");
 
         if (!result)
         {
@@ -4453,7 +4454,7 @@ void ObjectMgr::LoadPlayerInfo()
             _playerXPperLevel[level] = 0;
 
         //                                                 0    1
-        QueryResult result  = WorldDatabase.Query("SELECT Level, Experience FROM player_xp_for_level");
+        QueryResult result  = sWorldDatabaseSnapshot->Query("SELECT Level, Experience FROM player_xp_for_level");
 
         if (!result)
         {
@@ -4617,7 +4618,7 @@ void ObjectMgr::LoadQuests()
 
     mExclusiveQuestGroups.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT "
                          //0      1         2           3           4           5             6                 7            8
                          "ID, QuestType, QuestLevel, MinLevel, QuestSortID, QuestInfoID, SuggestedGroupNum, TimeAllowed, AllowableRaces,"
                          //      9                     10                   11                    12
@@ -4685,7 +4686,7 @@ void ObjectMgr::LoadQuests()
 
     // Load `quest_details`
     //                                   0   1       2       3       4       5            6            7            8
-    result = WorldDatabase.Query("SELECT ID, Emote1, Emote2, Emote3, Emote4, EmoteDelay1, EmoteDelay2, EmoteDelay3, EmoteDelay4 FROM quest_details");
+    result = sWorldDatabaseSnapshot->Query("SELECT ID, Emote1, Emote2, Emote3, Emote4, EmoteDelay1, EmoteDelay2, EmoteDelay3, EmoteDelay4 FROM quest_details");
 
     if (!result)
     {
@@ -4708,7 +4709,7 @@ void ObjectMgr::LoadQuests()
 
     // Load `quest_request_items`
     //                                   0   1                2                  3
-    result = WorldDatabase.Query("SELECT ID, EmoteOnComplete, EmoteOnIncomplete, CompletionText FROM quest_request_items");
+    result = sWorldDatabaseSnapshot->Query("SELECT ID, EmoteOnComplete, EmoteOnIncomplete, CompletionText FROM quest_request_items");
 
     if (!result)
     {
@@ -4731,7 +4732,7 @@ void ObjectMgr::LoadQuests()
 
     // Load `quest_offer_reward`
     //                                   0   1       2       3       4       5            6            7            8            9
-    result = WorldDatabase.Query("SELECT ID, Emote1, Emote2, Emote3, Emote4, EmoteDelay1, EmoteDelay2, EmoteDelay3, EmoteDelay4, RewardText FROM quest_offer_reward");
+    result = sWorldDatabaseSnapshot->Query("SELECT ID, Emote1, Emote2, Emote3, Emote4, EmoteDelay1, EmoteDelay2, EmoteDelay3, EmoteDelay4, RewardText FROM quest_offer_reward");
 
     if (!result)
     {
@@ -4754,7 +4755,7 @@ void ObjectMgr::LoadQuests()
 
     // Load `quest_template_addon`
     //                                   0   1         2                 3              4            5            6               7                     8
-    result = WorldDatabase.Query("SELECT ID, MaxLevel, AllowableClasses, SourceSpellID, PrevQuestID, NextQuestID, ExclusiveGroup, RewardMailTemplateID, RewardMailDelay, "
+    result = sWorldDatabaseSnapshot->Query("SELECT ID, MaxLevel, AllowableClasses, SourceSpellID, PrevQuestID, NextQuestID, ExclusiveGroup, RewardMailTemplateID, RewardMailDelay, "
                                  //9               10                   11                     12                     13                   14                   15                 16                     17
                                  "RequiredSkillID, RequiredSkillPoints, RequiredMinRepFaction, RequiredMaxRepFaction, RequiredMinRepValue, RequiredMaxRepValue, ProvidedItemCount, RewardMailSenderEntry, SpecialFlags FROM quest_template_addon LEFT JOIN quest_mail_sender ON Id=QuestId");
 
@@ -5381,7 +5382,7 @@ void ObjectMgr::LoadQuestLocales()
     _questLocaleStore.clear();                                // need for reload case
 
     //                                               0   1       2      3        4           5        6              7               8               9               10
-    QueryResult result = WorldDatabase.Query("SELECT ID, locale, Title, Details, Objectives, EndText, CompletedText, ObjectiveText1, ObjectiveText2, ObjectiveText3, ObjectiveText4 FROM quest_template_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, locale, Title, Details, Objectives, EndText, CompletedText, ObjectiveText1, ObjectiveText2, ObjectiveText3, ObjectiveText4 FROM quest_template_locale");
 
     if (!result)
         return;
@@ -5431,7 +5432,7 @@ void ObjectMgr::LoadScripts(ScriptsType type)
 
     bool isSpellScriptTable = (type == SCRIPTS_SPELL);
     //                                                 0    1       2         3         4          5    6  7  8  9
-    QueryResult result = WorldDatabase.Query("SELECT id, delay, command, datalong, datalong2, dataint, x, y, z, o{} FROM {}", isSpellScriptTable ? ", effIndex" : "", tableName);
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT id, delay, command, datalong, datalong2, dataint, x, y, z, o{} FROM {}", isSpellScriptTable ? ", effIndex" : "", tableName);
 
     if (!result)
     {
@@ -5829,7 +5830,7 @@ void ObjectMgr::LoadSpellScriptNames()
 
     _spellScriptsStore.clear();                            // need for reload case
 
-    QueryResult result = WorldDatabase.Query("SELECT spell_id, ScriptName FROM spell_script_names");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT spell_id, ScriptName FROM spell_script_names");
 
     if (!result)
     {
@@ -5958,7 +5959,7 @@ void ObjectMgr::LoadPageTexts()
     uint32 oldMSTime = getMSTime();
 
     //                                               0     1       2
-    QueryResult result = WorldDatabase.Query("SELECT ID, Text, NextPageID FROM page_text");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, Text, NextPageID FROM page_text");
 
     if (!result)
     {
@@ -6010,7 +6011,7 @@ void ObjectMgr::LoadPageTextLocales()
     _pageTextLocaleStore.clear();                             // need for reload case
 
     //                                               0   1       2
-    QueryResult result = WorldDatabase.Query("SELECT ID, locale, Text FROM page_text_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, locale, Text FROM page_text_locale");
 
     if (!result)
         return;
@@ -6037,7 +6038,7 @@ void ObjectMgr::LoadInstanceTemplate()
     uint32 oldMSTime = getMSTime();
 
     //                                                0     1       2        4
-    QueryResult result = WorldDatabase.Query("SELECT map, parent, script, allowMount FROM instance_template");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT map, parent, script, allowMount FROM instance_template");
 
     if (!result)
     {
@@ -6088,7 +6089,7 @@ void ObjectMgr::LoadInstanceEncounters()
     uint32 oldMSTime = getMSTime();
 
     //                                                 0         1            2                3
-    QueryResult result = WorldDatabase.Query("SELECT entry, creditType, creditEntry, lastEncounterDungeon FROM instance_encounters");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, creditType, creditEntry, lastEncounterDungeon FROM instance_encounters");
     if (!result)
     {
         LOG_WARN("server.loading", ">> Loaded 0 instance encounters, table is empty!");
@@ -6180,7 +6181,7 @@ void ObjectMgr::LoadGossipText()
 {
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = WorldDatabase.Query("SELECT ID, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, "
                          "text0_0, text0_1, BroadcastTextID0, lang0, Probability0, em0_0, em0_1, em0_2, em0_3, em0_4, em0_5, "
                          "text1_0, text1_1, BroadcastTextID1, lang1, Probability1, em1_0, em1_1, em1_2, em1_3, em1_4, em1_5, "
                          "text2_0, text2_1, BroadcastTextID2, lang2, Probability2, em2_0, em2_1, em2_2, em2_3, em2_4, em2_5, "
@@ -6258,7 +6259,7 @@ void ObjectMgr::LoadNpcTextLocales()
 
     _npcTextLocaleStore.clear();                              // need for reload case
 
-    QueryResult result = WorldDatabase.Query("SELECT ID, Locale, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, Locale, "
                          //   2        3        4        5        6        7        8        9        10       11       12       13       14       15       16       17
                          "Text0_0, Text0_1, Text1_0, Text1_1, Text2_0, Text2_1, Text3_0, Text3_1, Text4_0, Text4_1, Text5_0, Text5_1, Text6_0, Text6_1, Text7_0, Text7_1 "
                          "FROM npc_text_locale");
@@ -6416,7 +6417,7 @@ void ObjectMgr::LoadQuestAreaTriggers()
 
     _questAreaTriggerStore.clear();                           // need for reload case
 
-    QueryResult result = WorldDatabase.Query("SELECT id, quest FROM areatrigger_involvedrelation");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT id, quest FROM areatrigger_involvedrelation");
 
     if (!result)
     {
@@ -6489,7 +6490,7 @@ void ObjectMgr::LoadQuestGreetings()
         _questGreetingStore[i].clear();
 
     //                                                0   1          2                3             4
-    QueryResult result = WorldDatabase.Query("SELECT ID, Type, GreetEmoteType, GreetEmoteDelay, Greeting FROM quest_greeting");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, Type, GreetEmoteType, GreetEmoteDelay, Greeting FROM quest_greeting");
     if (!result)
     {
         LOG_WARN("server.loading", ">> Loaded 0 quest greetings. DB table `quest_greeting` is empty.");
@@ -6545,7 +6546,7 @@ void ObjectMgr::LoadQuestGreetingsLocales()
     _questGreetingLocaleStore.clear();
 
     //                                               0     1      2       3
-    QueryResult result = WorldDatabase.Query("SELECT ID, Type, Locale, Greeting FROM quest_greeting_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, Type, Locale, Greeting FROM quest_greeting_locale");
     if (!result)
     {
         LOG_WARN("server.loading", ">> Loaded 0 quest_greeting locales. DB table `quest_greeting_locale` is empty.");
@@ -6603,7 +6604,7 @@ void ObjectMgr::LoadQuestOfferRewardLocale()
     _questOfferRewardLocaleStore.clear(); // need for reload case
 
     //                                               0     1          2
-    QueryResult result = WorldDatabase.Query("SELECT Id, locale, RewardText FROM quest_offer_reward_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT Id, locale, RewardText FROM quest_offer_reward_locale");
     if (!result)
         return;
 
@@ -6632,7 +6633,7 @@ void ObjectMgr::LoadQuestRequestItemsLocale()
     _questRequestItemsLocaleStore.clear(); // need for reload case
 
     //                                               0     1          2
-    QueryResult result = WorldDatabase.Query("SELECT Id, locale, CompletionText FROM quest_request_items_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT Id, locale, CompletionText FROM quest_request_items_locale");
     if (!result)
         return;
 
@@ -6660,7 +6661,7 @@ void ObjectMgr::LoadTavernAreaTriggers()
 
     _tavernAreaTriggerStore.clear();                          // need for reload case
 
-    QueryResult result = WorldDatabase.Query("SELECT id, faction FROM areatrigger_tavern");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT id, faction FROM areatrigger_tavern");
 
     if (!result)
     {
@@ -6700,7 +6701,7 @@ void ObjectMgr::LoadAreaTriggerScripts()
     uint32 oldMSTime = getMSTime();
 
     _areaTriggerScriptStore.clear();                            // need for reload case
-    QueryResult result = WorldDatabase.Query("SELECT entry, ScriptName FROM areatrigger_scripts");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, ScriptName FROM areatrigger_scripts");
 
     if (!result)
     {
@@ -6841,7 +6842,7 @@ void ObjectMgr::LoadAreaTriggers()
 
     _areaTriggerStore.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT entry, map, x, y, z, radius, length, width, height, orientation FROM areatrigger");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, map, x, y, z, radius, length, width, height, orientation FROM areatrigger");
 
     if (!result)
     {
@@ -6892,7 +6893,7 @@ void ObjectMgr::LoadAreaTriggerTeleports()
     _areaTriggerTeleportStore.clear();                                  // need for reload case
 
     //                                               0        1              2                  3                  4                   5
-    QueryResult result = WorldDatabase.Query("SELECT ID,  target_map, target_position_x, target_position_y, target_position_z, target_orientation FROM areatrigger_teleport");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID,  target_map, target_position_x, target_position_y, target_position_z, target_orientation FROM areatrigger_teleport");
 
     if (!result)
     {
@@ -6979,7 +6980,7 @@ void ObjectMgr::LoadAccessRequirements()
         _accessRequirementStore.clear();                                  // need for reload case
     }
     //                                                               0       1            2           3          4            5
-    QueryResult access_template_result = WorldDatabase.Query("SELECT id, map_id, difficulty, min_level, max_level, min_avg_item_level FROM dungeon_access_template");
+    QueryResult access_template_result = sWorldDatabaseSnapshot->Query("SELECT id, map_id, difficulty, min_level, max_level, min_avg_item_level FROM dungeon_access_template");
     if (!access_template_result)
     {
         LOG_WARN("server.loading", ">> Loaded 0 access requirement definitions. DB table `dungeon_access_template` is empty.");
@@ -7006,7 +7007,7 @@ void ObjectMgr::LoadAccessRequirements()
         ar->reqItemLevel = fields[5].Get<uint16>();
 
         //                                                                              0                 1               2                 3        4         6
-        QueryResult progression_requirements_results = WorldDatabase.Query("SELECT requirement_type, requirement_id, requirement_note, faction, priority, leader_only FROM dungeon_access_requirements where dungeon_access_id = {}", dungeon_access_id);
+        QueryResult progression_requirements_results = sWorldDatabaseSnapshot->Query("SELECT requirement_type, requirement_id, requirement_note, faction, priority, leader_only FROM dungeon_access_requirements where dungeon_access_id = {}", dungeon_access_id);
         if (progression_requirements_results)
         {
             do
@@ -7273,7 +7274,7 @@ void ObjectMgr::LoadGameObjectLocales()
     _gameObjectLocaleStore.clear(); // need for reload case
 
     //                                               0      1       2     3
-    QueryResult result = WorldDatabase.Query("SELECT entry, locale, name, castBarCaption FROM gameobject_template_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, locale, name, castBarCaption FROM gameobject_template_locale");
     if (!result)
         return;
 
@@ -7359,7 +7360,7 @@ void ObjectMgr::LoadGameObjectTemplate()
     uint32 oldMSTime = getMSTime();
 
     //                                                 0      1      2        3       4             5          6      7
-    QueryResult result = WorldDatabase.Query("SELECT entry, type, displayId, name, IconName, castBarCaption, unk1, size, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, type, displayId, name, IconName, castBarCaption, unk1, size, "
                          //                                          8      9      10     11     12     13     14     15     16     17     18      19      20
                          "Data0, Data1, Data2, Data3, Data4, Data5, Data6, Data7, Data8, Data9, Data10, Data11, Data12, "
                          //                                          21      22      23      24      25      26      27      28      29      30      31      32        33
@@ -7548,7 +7549,7 @@ void ObjectMgr::LoadGameObjectTemplateAddons()
     uint32 oldMSTime = getMSTime();
 
     //                                                0       1       2      3        4       5        6        7        8
-    QueryResult result = WorldDatabase.Query("SELECT entry, faction, flags, mingold, maxgold, artkit0, artkit1, artkit2, artkit3 FROM gameobject_template_addon");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, faction, flags, mingold, maxgold, artkit0, artkit1, artkit2, artkit3 FROM gameobject_template_addon");
 
     if (!result)
     {
@@ -7626,7 +7627,7 @@ void ObjectMgr::LoadExplorationBaseXP()
 {
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = WorldDatabase.Query("SELECT level, basexp FROM exploration_basexp");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT level, basexp FROM exploration_basexp");
 
     if (!result)
     {
@@ -7666,7 +7667,7 @@ void ObjectMgr::LoadPetNames()
 {
     uint32 oldMSTime = getMSTime();
     //                                                0     1      2
-    QueryResult result = WorldDatabase.Query("SELECT word, entry, half FROM pet_name_generation");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT word, entry, half FROM pet_name_generation");
 
     if (!result)
     {
@@ -7753,7 +7754,7 @@ void ObjectMgr::LoadReputationRewardRate()
     _repRewardRateStore.clear();                             // for reload case
 
     uint32 count = 0; //                                0          1             2                  3                  4                 5                      6             7
-    QueryResult result = WorldDatabase.Query("SELECT faction, quest_rate, quest_daily_rate, quest_weekly_rate, quest_monthly_rate, quest_repeatable_rate, creature_rate, spell_rate FROM reputation_reward_rate");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT faction, quest_rate, quest_daily_rate, quest_weekly_rate, quest_monthly_rate, quest_repeatable_rate, creature_rate, spell_rate FROM reputation_reward_rate");
     if (!result)
     {
         LOG_INFO("server.loading", ">> Loaded `reputation_reward_rate`, table is empty!");
@@ -7844,7 +7845,7 @@ void ObjectMgr::LoadReputationOnKill()
     uint32 count = 0;
 
     //                                                0            1                     2
-    QueryResult result = WorldDatabase.Query("SELECT creature_id, RewOnKillRepFaction1, RewOnKillRepFaction2, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT creature_id, RewOnKillRepFaction1, RewOnKillRepFaction2, "
                          //   3             4             5                   6             7             8                   9
                          "IsTeamAward1, MaxStanding1, RewOnKillRepValue1, IsTeamAward2, MaxStanding2, RewOnKillRepValue2, TeamDependent "
                          "FROM creature_onkill_reputation");
@@ -7915,7 +7916,7 @@ void ObjectMgr::LoadReputationSpilloverTemplate()
     _repSpilloverTemplateStore.clear();                      // for reload case
 
     uint32 count = 0; //                                0         1        2       3        4       5       6         7        8      9        10       11     12        13       14      15       16       17     18
-    QueryResult result = WorldDatabase.Query("SELECT faction, faction1, rate_1, rank_1, faction2, rate_2, rank_2, faction3, rate_3, rank_3, faction4, rate_4, rank_4, faction5, rate_5, rank_5, faction6, rate_6, rank_6 FROM reputation_spillover_template");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT faction, faction1, rate_1, rank_1, faction2, rate_2, rank_2, faction3, rate_3, rank_3, faction4, rate_4, rank_4, faction5, rate_5, rank_5, faction6, rate_6, rank_6 FROM reputation_spillover_template");
 
     if (!result)
     {
@@ -8034,7 +8035,7 @@ void ObjectMgr::LoadPointsOfInterest()
     uint32 count = 0;
 
     //                                               0       1          2        3     4      5    6
-    QueryResult result = WorldDatabase.Query("SELECT ID, PositionX, PositionY, Icon, Flags, Importance, Name FROM points_of_interest");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, PositionX, PositionY, Icon, Flags, Importance, Name FROM points_of_interest");
 
     if (!result)
     {
@@ -8089,7 +8090,7 @@ void ObjectMgr::LoadQuestPOI()
     uint32 count = 0;
 
     //                                               0        1          2          3           4          5       6        7
-    QueryResult result = WorldDatabase.Query("SELECT QuestID, id, ObjectiveIndex, MapID, WorldMapAreaId, Floor, Priority, Flags FROM quest_poi order by QuestID");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT QuestID, id, ObjectiveIndex, MapID, WorldMapAreaId, Floor, Priority, Flags FROM quest_poi order by QuestID");
 
     if (!result)
     {
@@ -8099,7 +8100,7 @@ void ObjectMgr::LoadQuestPOI()
     }
 
     //                                                  0       1   2  3
-    QueryResult points = WorldDatabase.Query("SELECT QuestID, Idx1, X, Y FROM quest_poi_points ORDER BY QuestID DESC, Idx2");
+    QueryResult points = sWorldDatabaseSnapshot->Query("SELECT QuestID, Idx1, X, Y FROM quest_poi_points ORDER BY QuestID DESC, Idx2");
 
     std::vector<std::vector<std::vector<QuestPOIPoint> > > POIs;
 
@@ -8162,7 +8163,7 @@ void ObjectMgr::LoadNPCSpellClickSpells()
 
     _spellClickInfoStore.clear();
     //                                                0          1         2            3
-    QueryResult result = WorldDatabase.Query("SELECT npc_entry, spell_id, cast_flags, user_type FROM npc_spellclick_spells");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT npc_entry, spell_id, cast_flags, user_type FROM npc_spellclick_spells");
 
     if (!result)
     {
@@ -8251,7 +8252,7 @@ void ObjectMgr::LoadQuestRelationsHelper(QuestRelations& map, std::string const&
 
     uint32 count = 0;
 
-    QueryResult result = WorldDatabase.Query("SELECT id, quest, pool_entry FROM {} qr LEFT JOIN pool_quest pq ON qr.quest = pq.entry", table);
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT id, quest, pool_entry FROM {} qr LEFT JOIN pool_quest pq ON qr.quest = pq.entry", table);
 
     if (!result)
     {
@@ -8793,7 +8794,7 @@ bool ObjectMgr::LoadAcoreStrings()
     uint32 oldMSTime = getMSTime();
 
     _acoreStringStore.clear(); // for reload case
-    QueryResult result = WorldDatabase.Query("SELECT entry, content_default, locale_koKR, locale_frFR, locale_deDE, locale_zhCN, locale_zhTW, locale_esES, locale_esMX, locale_ruRU FROM acore_string");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, content_default, locale_koKR, locale_frFR, locale_deDE, locale_zhCN, locale_zhTW, locale_esES, locale_esMX, locale_ruRU FROM acore_string");
     if (!result)
     {
         LOG_WARN("server.loading", ">> Loaded 0 acore strings. DB table `acore_strings` is empty.");
@@ -8842,7 +8843,7 @@ void ObjectMgr::LoadFishingBaseSkillLevel()
 
     _fishingBaseForAreaStore.clear();                            // for reload case
 
-    QueryResult result = WorldDatabase.Query("SELECT entry, skill FROM skill_fishing_base_level");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, skill FROM skill_fishing_base_level");
 
     if (!result)
     {
@@ -8983,7 +8984,7 @@ void ObjectMgr::LoadNpcSounds()
     _npcSounds.clear();                                  // for reload case
 
     //                                                0      1        2       3    4
-    QueryResult result = WorldDatabase.Query("SELECT id, hello, goodbye, pissed, ack FROM npc_sounds");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT id, hello, goodbye, pissed, ack FROM npc_sounds");
 
     if (!result)
     {
@@ -9033,7 +9034,7 @@ void ObjectMgr::LoadCreatureOutfits()
 
     _creatureOutfitStore.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT entry, npcsoundsid, race, class, gender, skin, face, hair, haircolor, facialhair, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, npcsoundsid, race, class, gender, skin, face, hair, haircolor, facialhair, "
         "head, shoulders, body, chest, waist, "
         "legs, feet, wrists, hands, back, tabard, "
         "guildid FROM creature_template_outfits");
@@ -9160,7 +9161,7 @@ void ObjectMgr::LoadGameTele()
     _gameTeleStore.clear();                                  // for reload case
 
     //                                                0       1           2           3           4        5     6
-    QueryResult result = WorldDatabase.Query("SELECT id, position_x, position_y, position_z, orientation, map, name FROM game_tele");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT id, position_x, position_y, position_z, orientation, map, name FROM game_tele");
 
     if (!result)
     {
@@ -9300,7 +9301,7 @@ void ObjectMgr::LoadMailLevelRewards()
     _mailLevelRewardStore.clear();                           // for reload case
 
     //                                                 0        1             2            3
-    QueryResult result = WorldDatabase.Query("SELECT level, raceMask, mailTemplateId, senderEntry FROM mail_level_reward");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT level, raceMask, mailTemplateId, senderEntry FROM mail_level_reward");
 
     if (!result)
     {
@@ -9445,7 +9446,7 @@ void ObjectMgr::LoadTrainerSpell()
     // For reload case
     _cacheTrainerSpellStore.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT b.ID, a.SpellID, a.MoneyCost, a.ReqSkillLine, a.ReqSkillRank, a.ReqLevel, a.ReqSpell FROM npc_trainer AS a "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT b.ID, a.SpellID, a.MoneyCost, a.ReqSkillLine, a.ReqSkillRank, a.ReqLevel, a.ReqSpell FROM npc_trainer AS a "
                          "INNER JOIN npc_trainer AS b ON a.ID = -(b.SpellID) "
                          "UNION SELECT * FROM npc_trainer WHERE SpellID > 0");
 
@@ -9529,7 +9530,7 @@ void ObjectMgr::LoadVendors()
 
     std::set<uint32> skip_vendors;
 
-    QueryResult result = WorldDatabase.Query("SELECT entry, item, maxcount, incrtime, ExtendedCost FROM npc_vendor ORDER BY entry, slot ASC, item, ExtendedCost");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, item, maxcount, incrtime, ExtendedCost FROM npc_vendor ORDER BY entry, slot ASC, item, ExtendedCost");
     if (!result)
     {
         LOG_INFO("server.loading", " ");
@@ -9575,7 +9576,7 @@ void ObjectMgr::LoadGossipMenu()
 
     _gossipMenusStore.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT MenuID, TextID FROM gossip_menu");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT MenuID, TextID FROM gossip_menu");
 
     if (!result)
     {
@@ -9612,7 +9613,7 @@ void ObjectMgr::LoadGossipMenuItems()
 
     _gossipMenuItemsStore.clear();
 
-    QueryResult result = WorldDatabase.Query(
+    QueryResult result = sWorldDatabaseSnapshot->Query(
                              //      0       1         2           3           4                      5           6              7             8            9         10        11       12
                              "SELECT MenuID, OptionID, OptionIcon, OptionText, OptionBroadcastTextID, OptionType, OptionNpcFlag, ActionMenuID, ActionPoiID, BoxCoded, BoxMoney, BoxText, BoxBroadcastTextID "
                              "FROM gossip_menu_option ORDER BY MenuID, OptionID");
@@ -9807,7 +9808,7 @@ void ObjectMgr::LoadScriptNames()
     // script id 0 as dummy for "no script found".
     _scriptNamesStore.emplace_back("");
 
-    QueryResult result = WorldDatabase.Query(
+    QueryResult result = sWorldDatabaseSnapshot->Query(
                              "SELECT DISTINCT(ScriptName) FROM achievement_criteria_data WHERE ScriptName <> '' AND type = 11 "
                              "UNION "
                              "SELECT DISTINCT(ScriptName) FROM battleground_template WHERE ScriptName <> '' "
@@ -9885,7 +9886,7 @@ void ObjectMgr::LoadBroadcastTexts()
     _broadcastTextStore.clear(); // for reload case
 
     //                                               0   1           2         3           4         5         6         7            8            9            10              11        12
-    QueryResult result = WorldDatabase.Query("SELECT ID, LanguageID, MaleText, FemaleText, EmoteID1, EmoteID2, EmoteID3, EmoteDelay1, EmoteDelay2, EmoteDelay3, SoundEntriesID, EmotesID, Flags FROM broadcast_text");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, LanguageID, MaleText, FemaleText, EmoteID1, EmoteID2, EmoteID3, EmoteDelay1, EmoteDelay2, EmoteDelay3, SoundEntriesID, EmotesID, Flags FROM broadcast_text");
     if (!result)
     {
         LOG_WARN("server.loading", ">> Loaded 0 broadcast texts. DB table `broadcast_text` is empty.");
@@ -9968,7 +9969,7 @@ void ObjectMgr::LoadBroadcastTextLocales()
     uint32 oldMSTime = getMSTime();
 
     //                                               0   1       2         3
-    QueryResult result = WorldDatabase.Query("SELECT ID, locale, MaleText, FemaleText FROM broadcast_text_locale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, locale, MaleText, FemaleText FROM broadcast_text_locale");
 
     if (!result)
     {
@@ -10034,7 +10035,7 @@ void ObjectMgr::LoadCreatureClassLevelStats()
 {
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = WorldDatabase.Query("SELECT level, class, basehp0, basehp1, basehp2, basemana, basearmor, attackpower, rangedattackpower, damage_base, damage_exp1, damage_exp2 FROM creature_classlevelstats");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT level, class, basehp0, basehp1, basehp2, basemana, basearmor, attackpower, rangedattackpower, damage_base, damage_exp1, damage_exp2 FROM creature_classlevelstats");
 
     if (!result)
     {
@@ -10183,7 +10184,7 @@ void ObjectMgr::LoadFactionChangeAchievements()
 {
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = WorldDatabase.Query("SELECT alliance_id, horde_id FROM player_factionchange_achievement");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT alliance_id, horde_id FROM player_factionchange_achievement");
 
     if (!result)
     {
@@ -10219,7 +10220,7 @@ void ObjectMgr::LoadFactionChangeItems()
 {
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = WorldDatabase.Query("SELECT alliance_id, horde_id FROM player_factionchange_items");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT alliance_id, horde_id FROM player_factionchange_items");
 
     if (!result)
     {
@@ -10255,7 +10256,7 @@ void ObjectMgr::LoadFactionChangeQuests()
 {
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = WorldDatabase.Query("SELECT alliance_id, horde_id FROM player_factionchange_quests");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT alliance_id, horde_id FROM player_factionchange_quests");
 
     if (!result)
     {
@@ -10291,7 +10292,7 @@ void ObjectMgr::LoadFactionChangeReputations()
 {
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = WorldDatabase.Query("SELECT alliance_id, horde_id FROM player_factionchange_reputations");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT alliance_id, horde_id FROM player_factionchange_reputations");
 
     if (!result)
     {
@@ -10327,7 +10328,7 @@ void ObjectMgr::LoadFactionChangeSpells()
 {
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = WorldDatabase.Query("SELECT alliance_id, horde_id FROM player_factionchange_spells");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT alliance_id, horde_id FROM player_factionchange_spells");
 
     if (!result)
     {
@@ -10363,7 +10364,7 @@ void ObjectMgr::LoadFactionChangeTitles()
 {
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = WorldDatabase.Query("SELECT alliance_id, horde_id FROM player_factionchange_titles");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT alliance_id, horde_id FROM player_factionchange_titles");
 
     if (!result)
     {
@@ -10462,7 +10463,7 @@ void ObjectMgr::LoadGameObjectQuestItems()
     uint32 oldMSTime = getMSTime();
 
     //                                               0                1        2
-    QueryResult result = WorldDatabase.Query("SELECT GameObjectEntry, ItemId, Idx FROM gameobject_questitem ORDER BY Idx ASC");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT GameObjectEntry, ItemId, Idx FROM gameobject_questitem ORDER BY Idx ASC");
 
     if (!result)
     {
@@ -10507,7 +10508,7 @@ void ObjectMgr::LoadCreatureQuestItems()
     uint32 oldMSTime = getMSTime();
 
     //                                               0              1        2
-    QueryResult result = WorldDatabase.Query("SELECT CreatureEntry, ItemId, Idx FROM creature_questitem ORDER BY Idx ASC");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT CreatureEntry, ItemId, Idx FROM creature_questitem ORDER BY Idx ASC");
 
     if (!result)
     {
@@ -10554,7 +10555,7 @@ void ObjectMgr::LoadQuestMoneyRewards()
     _questMoneyRewards.clear();
 
     //                                                0       1       2       3       4       5       6       7       8       9       10
-    QueryResult result = WorldDatabase.Query("SELECT `Level`, Money0, Money1, Money2, Money3, Money4, Money5, Money6, Money7, Money8, Money9 FROM `quest_money_reward` ORDER BY `Level`");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT `Level`, Money0, Money1, Money2, Money3, Money4, Money5, Money6, Money7, Money8, Money9 FROM `quest_money_reward` ORDER BY `Level`");
     if (!result)
     {
         LOG_WARN("server.loading", ">> Loaded 0 quest money rewards. DB table `quest_money_reward` is empty.");
@@ -10716,7 +10717,7 @@ void ObjectMgr::LoadInstanceDifficultyMultiplier()
 
     _instanceDifficultyMultipliers.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT mapId, difficultyId, healthMultiplier, damageMultiplier FROM instance_difficulty_multiplier");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT mapId, difficultyId, healthMultiplier, damageMultiplier FROM instance_difficulty_multiplier");
 
     if (!result)
     {
@@ -10747,7 +10748,7 @@ void ObjectMgr::LoadMythicLevelScale()
 
     _mythicLevelScales.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT * FROM forge_mythic_level_scale");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_mythic_level_scale");
 
     if (!result)
     {
@@ -10776,7 +10777,7 @@ void ObjectMgr::LoadMythicMinionValue()
 
     _cacheMythicMinionValues.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT * FROM forge_mythic_minion_value");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_mythic_minion_value");
 
     if (!result)
     {
@@ -10806,7 +10807,7 @@ void ObjectMgr::LoadMythicDungeonKeyMap()
     _forgeMythicKeys.clear();
     _forgeMythicMaps.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT * FROM forge_mythic_instance_key");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_mythic_instance_key");
 
     if (!result)
     {
@@ -10839,7 +10840,7 @@ void ObjectMgr::LoadMythicAffixes()
 
     _forgeAffixes.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT * FROM forge_mythic_affixes");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_mythic_affixes");
 
     if (!result)
     {
@@ -10873,7 +10874,7 @@ void ObjectMgr::LoadSpellChargeMap()
 
     _chargeSpellMap.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT * FROM forge_spell_charge");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT * FROM forge_spell_charge");
 
     if (!result)
     {
@@ -10910,7 +10911,7 @@ void ObjectMgr::LoadWorldSafeLocs()
     uint32 oldMSTime = getMSTime();
 
     //                                                   0   1      2     3     4     5
-    if (QueryResult result = WorldDatabase.Query("SELECT ID, Map, LocX, LocY, LocZ, Facing FROM world_safe_locs"))
+    if (QueryResult result = sWorldDatabaseSnapshot->Query("SELECT ID, Map, LocX, LocY, LocZ, Facing FROM world_safe_locs"))
     {
         do
         {
@@ -10944,7 +10945,7 @@ void ObjectMgr::LoadJumpChargeParams()
     _jumpChargeParams.clear();
 
     //                                               0   1      2                            3            4
-    QueryResult result = WorldDatabase.Query("SELECT id, speed, treatSpeedAsMoveTimeSeconds, jumpGravity, comments FROM forge_spell_jump_charge_params");
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT id, speed, treatSpeedAsMoveTimeSeconds, jumpGravity, comments FROM forge_spell_jump_charge_params");
 
     if (!result)
     {
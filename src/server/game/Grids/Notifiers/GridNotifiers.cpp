@@ -22,6 +22,7 @@
 #include "Transport.h"
 #include "UpdateData.h"
 #include "WorldPacket.h"
+#include <limits>
 
 using namespace Acore;
 
@@ -380,6 +381,140 @@ bool AnyDeadUnitSpellTargetInRangeCheck::operator()(Creature* u)
     return AnyDeadUnitObjectInRangeCheck::operator()(u) && i_check(u);
 }
 
+void WorldObjectCandidates::Clear()
+{
+    _objects.clear();
+    _x.clear();
+    _y.clear();
+    _z.clear();
+    _size.clear();
+}
+
+void WorldObjectCandidates::Add(WorldObject* object)
+{
+    _objects.push_back(object);
+    _x.push_back(object->GetPositionX());
+    _y.push_back(object->GetPositionY());
+    _z.push_back(object->GetPositionZ());
+    _size.push_back(object->GetTypeId() == TYPEID_GAMEOBJECT ? std::numeric_limits<float>::infinity() : object->GetObjectSize());
+}
+
+void WorldObjectCandidates::FilterInRange(Position const& center, float range)
+{
+    std::size_t const count = _objects.size();
+    float const centerX = center.GetPositionX();
+    float const centerY = center.GetPositionY();
+    float const centerZ = center.GetPositionZ();
+    // slack against rounding differences with the exact checks done by the callers
+    float const reach = range + 0.01f;
+
+    _keep.resize(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        float dx = centerX - _x[i];
+        float dy = centerY - _y[i];
+        float dz = centerZ - _z[i];
+        float maxDist = reach + _size[i];
+        _keep[i] = (dx * dx + dy * dy + dz * dz) <= maxDist * maxDist;
+    }
+
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (!_keep[i])
+            continue;
+
+        _objects[kept] = _objects[i];
+        _x[kept] = _x[i];
+        _y[kept] = _y[i];
+        _z[kept] = _z[i];
+        _size[kept] = _size[i];
+        ++kept;
+    }
+
+    _objects.resize(kept);
+    _x.resize(kept);
+    _y.resize(kept);
+    _z.resize(kept);
+    _size.resize(kept);
+}
+
+namespace
+{
+    thread_local WorldObjectCandidates t_candidates;
+    thread_local bool t_candidatesLent = false;
+}
+
+ScopedWorldObjectCandidates::ScopedWorldObjectCandidates()
+{
+    if (t_candidatesLent)
+    {
+        _nested = std::make_unique<WorldObjectCandidates>();
+        _candidates = _nested.get();
+    }
+    else
+    {
+        t_candidatesLent = true;
+        _candidates = &t_candidates;
+        _candidates->Clear();
+    }
+}
+
+ScopedWorldObjectCandidates::~ScopedWorldObjectCandidates()
+{
+    if (!_nested)
+    {
+        _candidates->Clear();
+        t_candidatesLent = false;
+    }
+}
+
+void WorldObjectCandidateCollector::Visit(GameObjectMapType& m)
+{
+    if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_GAMEOBJECT))
+        return;
+
+    for (GameObjectMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+        i_candidates.Add(itr->GetSource());
+}
+
+void WorldObjectCandidateCollector::Visit(PlayerMapType& m)
+{
+    if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_PLAYER))
+        return;
+
+    for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+        i_candidates.Add(itr->GetSource());
+}
+
+void WorldObjectCandidateCollector::Visit(CreatureMapType& m)
+{
+    if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CREATURE))
+        return;
+
+    for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+        i_candidates.Add(itr->GetSource());
+}
+
+void WorldObjectCandidateCollector::Visit(CorpseMapType& m)
+{
+    if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CORPSE))
+        return;
+
+    for (CorpseMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+        i_candidates.Add(itr->GetSource());
+}
+
+void WorldObjectCandidateCollector::Visit(DynamicObjectMapType& m)
+{
+    if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_DYNAMICOBJECT))
+        return;
+
+    for (DynamicObjectMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+        i_candidates.Add(itr->GetSource());
+}
+
 template void ObjectUpdater::Visit<Creature>(CreatureMapType&);
 template void ObjectUpdater::Visit<GameObject>(GameObjectMapType&);
 template void ObjectUpdater::Visit<DynamicObject>(DynamicObjectMapType&);
@@ -32,6 +32,8 @@
 #include "UpdateData.h"
 #include "WorldSession.h"
 #include <iostream>
+#include <memory>
+#include <vector>
 
 class Player;
 //class Map;
@@ -102,6 +104,7 @@ namespace Acore
         float i_distSq;
         TeamId teamId;
         Player const* skipped_receiver;
+        SharedWorldPacket i_sharedMessage;
         MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, bool own_team_only = false, Player const* skipped = nullptr)
             : i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
             , teamId((own_team_only && src->GetTypeId() == TYPEID_PLAYER) ? src->ToPlayer()->GetTeamId() : TEAM_NEUTRAL)
@@ -122,7 +125,16 @@ namespace Acore
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            player->GetSession()->SendPacket(GetSharedMessage());
+        }
+
+        // copied once on first use, every receiver shares it
+        SharedWorldPacket const& GetSharedMessage()
+        {
+            if (!i_sharedMessage)
+                i_sharedMessage = std::make_shared<WorldPacket const>(*i_message);
+
+            return i_sharedMessage;
         }
     };
 
@@ -132,6 +144,7 @@ namespace Acore
         WorldPacket* i_message;
         uint32 i_phaseMask;
         float i_distSq;
+        SharedWorldPacket i_sharedMessage;
         MessageDistDelivererToHostile(Unit* src, WorldPacket* msg, float dist)
             : i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
         {
@@ -147,7 +160,10 @@ namespace Acore
             if (player == i_source || !player->HaveAtClient(i_source) || player->IsFriendlyTo(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            if (!i_sharedMessage)
+                i_sharedMessage = std::make_shared<WorldPacket const>(*i_message);
+
+            player->GetSession()->SendPacket(i_sharedMessage);
         }
     };
 
@@ -191,6 +207,71 @@ namespace Acore
         }
     };
 
+    // Objects found by a grid walk with their positions in struct of arrays layout. The range filter
+    // is one branch free loop over plain floats the compiler vectorizes, so the per object checks
+    // only run for objects that can be in range.
+    class WorldObjectCandidates
+    {
+    public:
+        typedef std::vector<WorldObject*>::const_iterator const_iterator;
+
+        void Clear();
+        void Add(WorldObject* object);
+
+        // Drops objects whose bounding sphere cannot reach into the sphere around center, conservative
+        // so callers still do their exact checks. Gameobjects are always kept, their range uses model bounds.
+        void FilterInRange(Position const& center, float range);
+
+        [[nodiscard]] std::size_t size() const { return _objects.size(); }
+        [[nodiscard]] bool empty() const { return _objects.empty(); }
+        const_iterator begin() const { return _objects.begin(); }
+        const_iterator end() const { return _objects.end(); }
+
+    private:
+        std::vector<WorldObject*> _objects;
+        std::vector<float> _x;
+        std::vector<float> _y;
+        std::vector<float> _z;
+        std::vector<float> _size;
+        std::vector<uint8> _keep;
+    };
+
+    // Lends the calling thread's WorldObjectCandidates, so searches reuse the allocations of previous ones.
+    // A search started while the buffer is lent (e.g. from a script run by a target check) gets its own.
+    class ScopedWorldObjectCandidates
+    {
+    public:
+        ScopedWorldObjectCandidates();
+        ~ScopedWorldObjectCandidates();
+
+        ScopedWorldObjectCandidates(ScopedWorldObjectCandidates const&) = delete;
+        ScopedWorldObjectCandidates& operator=(ScopedWorldObjectCandidates const&) = delete;
+
+        WorldObjectCandidates& operator*() { return *_candidates; }
+        WorldObjectCandidates* operator->() { return _candidates; }
+
+    private:
+        WorldObjectCandidates* _candidates;
+        std::unique_ptr<WorldObjectCandidates> _nested;
+    };
+
+    struct WorldObjectCandidateCollector
+    {
+        uint32 i_mapTypeMask;
+        WorldObjectCandidates& i_candidates;
+
+        WorldObjectCandidateCollector(WorldObjectCandidates& candidates, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
+            : i_mapTypeMask(mapTypeMask), i_candidates(candidates) { }
+
+        void Visit(GameObjectMapType& m);
+        void Visit(PlayerMapType& m);
+        void Visit(CreatureMapType& m);
+        void Visit(CorpseMapType& m);
+        void Visit(DynamicObjectMapType& m);
+
+        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+    };
+
     template<class Check>
     struct WorldObjectSearcher
     {
@@ -18,7 +18,6 @@
 #include "Group.h"
 #include "Battleground.h"
 #include "BattlegroundMgr.h"
-#include "Config.h"
 #include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "GroupMgr.h"
@@ -283,7 +282,7 @@ bool Group::CheckLevelForRaid()
 {
     for (member_citerator citr = m_memberSlots.begin(); citr != m_memberSlots.end(); ++citr)
         if (Player* player = ObjectAccessor::FindPlayer(citr->guid))
-            if (player->GetLevel() < sConfigMgr->GetOption<int32>("Group.Raid.LevelRestriction", 10))
+            if (player->GetLevel() < int32(sWorld->getIntConfig(CONFIG_GROUP_RAID_LEVEL_RESTRICTION)))
                 return true;
 
     return false;
@@ -1724,6 +1723,9 @@ void Group::UpdatePlayerOutOfRange(Player* player)
 
 void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRaid, int group, ObjectGuid ignore)
 {
+    // copied once for the whole raid, every member's socket references the same payload
+    SharedWorldPacket sharedPacket;
+
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player* player = itr->GetSource();
@@ -1731,7 +1733,12 @@ void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRai
             continue;
 
         if (group == -1 || itr->getSubGroup() == group)
-            player->GetSession()->SendPacket(packet);
+        {
+            if (!sharedPacket)
+                sharedPacket = std::make_shared<WorldPacket const>(*packet);
+
+            player->GetSession()->SendPacket(sharedPacket);
+        }
     }
 }
 
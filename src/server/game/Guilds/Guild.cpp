@@ -20,7 +20,6 @@
 #include "CalendarMgr.h"
 #include "CharacterCache.h"
 #include "Chat.h"
-#include "Config.h"
 #include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "GuildMgr.h"
@@ -1439,7 +1438,7 @@ void Guild::HandleInviteMember(WorldSession* session, std::string const& name)
     if (pInvitee->GetSocial()->HasIgnore(player->GetGUID()))
         return;
 
-    uint32 memberLimit = sConfigMgr->GetOption<uint32>("Guild.MemberLimit", 0);
+    uint32 memberLimit = sWorld->getIntConfig(CONFIG_GUILD_MEMBER_LIMIT);
     if (memberLimit > 0 && player->GetGuild()->GetMemberCount() >= memberLimit)
     {
         ChatHandler(player->GetSession()).PSendSysMessage("Your guild has reached the maximum amount of members (%u). You cannot send another invite until the guild member count is lower.", memberLimit);
@@ -2093,7 +2092,7 @@ bool Guild::Validate()
         _SetLeaderGUID(*pLeader);
 
     // Check config if multiple guildmasters are allowed
-    if (!sConfigMgr->GetOption<bool>("Guild.AllowMultipleGuildMaster", 0))
+    if (!sWorld->getBoolConfig(CONFIG_GUILD_ALLOW_MULTIPLE_GUILD_MASTER))
         for (auto& [guid, member] : m_members)
             if ((member.GetRankId() == GR_GUILDMASTER) && !member.IsSamePlayer(m_leaderGuid))
                 member.ChangeRank(GR_OFFICER);
@@ -0,0 +1,101 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridPrefetcher.h"
+#include "MMapFactory.h"
+#include "VMapFactory.h"
+#include "VMapMgr2.h"
+#include "World.h"
+
+namespace
+{
+    uint64 MakeTileKey(uint32 mapId, uint32 x, uint32 y)
+    {
+        return (uint64(mapId) << 32) | (x << 16) | y;
+    }
+}
+
+GridPrefetcher::GridPrefetcher() : _cancelationToken(false)
+{
+}
+
+void GridPrefetcher::activate(size_t num_threads)
+{
+    _workerThreads.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        _workerThreads.push_back(std::thread(&GridPrefetcher::WorkerThread, this));
+    }
+}
+
+void GridPrefetcher::deactivate()
+{
+    _cancelationToken = true;
+
+    _queue.Cancel();
+
+    for (auto& thread : _workerThreads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+
+    _workerThreads.clear();
+}
+
+bool GridPrefetcher::activated()
+{
+    return _workerThreads.size() > 0;
+}
+
+void GridPrefetcher::schedule_prefetch(uint32 mapId, uint32 x, uint32 y, bool loadMMap)
+{
+    {
+        std::lock_guard<std::mutex> guard(_pendingLock);
+        if (!_pending.insert(MakeTileKey(mapId, x, y)).second)
+            return;
+    }
+
+    _queue.Push(new PrefetchRequest{ mapId, x, y, loadMMap });
+}
+
+void GridPrefetcher::WorkerThread()
+{
+    while (!_cancelationToken)
+    {
+        PrefetchRequest* request = nullptr;
+
+        _queue.WaitAndPop(request);
+
+        if (!request)
+            continue;
+
+        VMAP::VMapFactory::createOrGetVMapMgr()->prefetchMap((sWorld->GetDataPath() + "vmaps").c_str(), request->mapId, request->x, request->y);
+
+        if (request->loadMMap)
+            MMAP::MMapFactory::createOrGetMMapMgr()->prefetchTile(request->mapId, request->x, request->y);
+
+        {
+            std::lock_guard<std::mutex> guard(_pendingLock);
+            _pending.erase(MakeTileKey(request->mapId, request->x, request->y));
+        }
+
+        delete request;
+    }
+}
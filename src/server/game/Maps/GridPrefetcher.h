@@ -0,0 +1,62 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GRID_PREFETCHER_H_INCLUDED
+#define _GRID_PREFETCHER_H_INCLUDED
+
+#include "Define.h"
+#include "PCQueue.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// Reads vmap and mmap tiles on background threads before the grids using them are created,
+// so Map::EnsureGridCreated only has to install data that is already in memory
+class GridPrefetcher
+{
+public:
+    GridPrefetcher();
+    ~GridPrefetcher() = default;
+
+    // tile coordinates as used by Map::LoadMapAndVMap, requests for a tile still in the queue are dropped
+    void schedule_prefetch(uint32 mapId, uint32 x, uint32 y, bool loadMMap);
+    void activate(size_t num_threads);
+    void deactivate();
+    bool activated();
+
+private:
+    struct PrefetchRequest
+    {
+        uint32 mapId;
+        uint32 x;
+        uint32 y;
+        bool loadMMap;
+    };
+
+    void WorkerThread();
+
+    ProducerConsumerQueue<PrefetchRequest*> _queue;
+    std::vector<std::thread> _workerThreads;
+    std::atomic<bool> _cancelationToken;
+
+    std::mutex _pendingLock;
+    std::unordered_set<uint64> _pending;            // tiles queued or being read
+};
+
+#endif //_GRID_PREFETCHER_H_INCLUDED
@@ -16,6 +16,7 @@
  */
 
 #include "Map.h"
+#include "AnticheatMgr.h"
 #include "Battleground.h"
 #include "CellImpl.h"
 #include "Chat.h"
@@ -28,8 +29,10 @@
 #include "InstanceScript.h"
 #include "LFGMgr.h"
 #include "MapInstanced.h"
+#include "MapMgr.h"
 #include "Metric.h"
 #include "MiscPackets.h"
+#include "MoveSpline.h"
 #include "Object.h"
 #include "ObjectAccessor.h"
 #include "ObjectGridLoader.h"
@@ -57,6 +60,15 @@ u_map_magic MapLiquidMagic  = { {'M', 'L', 'I', 'Q'} };
 static uint16 const holetab_h[4] = { 0x1111, 0x2222, 0x4444, 0x8888 };
 static uint16 const holetab_v[4] = { 0x000F, 0x00F0, 0x0F00, 0xF000 };
 
+static uint32 const GRID_PREFETCH_INTERVAL = 1000;                    // ms between two predictions
+static float const GRID_PREFETCH_LOOKAHEAD = 30.0f;                   // seconds of movement looked ahead
+static float const GRID_PREFETCH_DISTANCE = SIZE_OF_GRIDS * 2.0f;     // never further than two grids
+
+// Grid region run by the current thread, see Map::UpdateRegion
+static thread_local Map const* t_regionMap = nullptr;
+static thread_local uint32 t_region = 0;                              // region index + 1
+static thread_local uint32 t_regionExclusive = 0;                     // nesting depth of Map::RegionExclusiveGuard
+
 ZoneDynamicInfo::ZoneDynamicInfo() : MusicId(0), WeatherId(WEATHER_STATE_FINE),
                                      WeatherGrade(0.0f), OverrideLightId(0), LightFadeInTime(0) { }
 
@@ -223,6 +235,63 @@ void Map::LoadMap(int gx, int gy, bool reload)
     sScriptMgr->OnLoadGridMap(this, GridMaps[gx][gy], gx, gy);
 }
 
+void Map::PrefetchGridsAhead()
+{
+    if (!sMapMgr->GetGridPrefetcher()->activated())
+        return;
+
+    for (MapRefMgr::iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
+    {
+        Player* player = itr->GetSource();
+
+        if (!player || !player->IsInWorld())
+            continue;
+
+        // taxi flights follow a known spline, queue the grids of the nodes still ahead
+        if (player->IsInFlight() && player->movespline->Initialized() && !player->movespline->Finalized())
+        {
+            Movement::MoveSpline::MySpline::ControlArray const& path = player->movespline->_Spline().getPoints();
+            for (size_t i = std::max(player->movespline->_currentSplineIdx(), 0); i < path.size(); ++i)
+            {
+                if (player->GetExactDist2d(path[i].x, path[i].y) > GRID_PREFETCH_DISTANCE)
+                    break;
+
+                PrefetchGrid(path[i].x, path[i].y);
+            }
+
+            continue;
+        }
+
+        if (!player->isMoving())
+            continue;
+
+        // otherwise extrapolate the current movement
+        float angle = player->GetOrientation();
+        if (player->HasUnitMovementFlag(MOVEMENTFLAG_BACKWARD))
+            angle += float(M_PI);
+
+        float distance = std::min(player->GetSpeed(player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN) * GRID_PREFETCH_LOOKAHEAD, GRID_PREFETCH_DISTANCE);
+        for (float dist = SIZE_OF_GRIDS / 2.0f; dist < distance + SIZE_OF_GRIDS / 2.0f; dist += SIZE_OF_GRIDS / 2.0f)
+            PrefetchGrid(player->GetPositionX() + std::cos(angle) * std::min(dist, distance), player->GetPositionY() + std::sin(angle) * std::min(dist, distance));
+    }
+}
+
+void Map::PrefetchGrid(float x, float y)
+{
+    if (!Acore::IsValidMapCoord(x, y))
+        return;
+
+    // vmaps and mmaps are loaded along with the grids of the base map, instances share them
+    GridCoord p = Acore::ComputeGridCoord(x, y);
+    if (m_parentMap->getNGrid(p.x_coord, p.y_coord))
+        return;
+
+    int gx = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
+    int gy = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
+
+    sMapMgr->GetGridPrefetcher()->schedule_prefetch(GetId(), gx, gy, DisableMgr::IsPathfindingEnabled(m_parentMap));
+}
+
 void Map::LoadMapAndVMap(int gx, int gy)
 {
     LoadMap(gx, gy);
@@ -237,9 +306,23 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
     m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
     _instanceResetPeriod(0), m_activeNonPlayersIter(m_activeNonPlayers.end()),
-    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
+    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id)),
+    _updateCost(0)
 {
     m_parentMap = (_parent ? _parent : this);
+    _anticheatMoveQueue = std::make_unique<AnticheatMoveQueue>();
+
+    _parallelUpdate = sMapMgr->IsParallelUpdateEnabled(id);
+    _regionUpdateActive = false;
+    _regionUpdateDiff = 0;
+    _regionExclusivePending = 0;
+    _pendingRegionUpdates = 0;
+    _updateRegionCount = 0;
+    _gridPrefetchTimer = 0;
+    _procEvents = 0;
+    _procCandidates = 0;
+    _procSkippedAuras = 0;
+
     for (unsigned int idx = 0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
     {
         for (unsigned int j = 0; j < MAX_NUMBER_OF_GRIDS; ++j)
@@ -445,6 +528,7 @@ void Map::EnsureGridCreated(const GridCoord& p)
 {
     if (getNGrid(p.x_coord, p.y_coord)) // pussywizard
         return;
+    RegionExclusiveGuard exclusive(*this, true);
     std::lock_guard<std::mutex> guard(GridLock);
     EnsureGridCreated_i(p);
 }
@@ -484,6 +568,11 @@ bool Map::EnsureGridLoaded(const Cell& cell)
     ASSERT(grid);
     if (!isGridObjectDataLoaded(cell.GridX(), cell.GridY()))
     {
+        // the other regions were running until now, another one may have loaded it meanwhile
+        RegionExclusiveGuard exclusive(*this, true);
+        if (isGridObjectDataLoaded(cell.GridX(), cell.GridY()))
+            return false;
+
         //if (!isGridObjectDataLoaded(cell.GridX(), cell.GridY()))
         //{
         LOG_DEBUG("maps", "Loading grid[{}, {}] for map {} instance {}", cell.GridX(), cell.GridY(), GetId(), i_InstanceId);
@@ -566,6 +655,8 @@ void Map::InitializeObject(GameObject*  /*obj*/)
 template<class T>
 bool Map::AddToMap(T* obj, bool checkTransport)
 {
+    auto guard = LockForRegionUpdate();
+
     //TODO: Needs clean up. An object should not be added to map twice.
     if (obj->IsInWorld())
     {
@@ -587,6 +678,7 @@ bool Map::AddToMap(T* obj, bool checkTransport)
     }
 
     Cell cell(cellCoord);
+    RegionExclusiveGuard exclusive(*this, !IsGridOwnedByCurrentRegion(GridCoord(cell.GridX(), cell.GridY())));
     if (obj->isActiveObject())
         EnsureGridLoaded(cell);
     else
@@ -666,6 +758,8 @@ bool Map::AddToMap(MotionTransport* obj, bool /*checkTransport*/)
 }
 
 bool Map::AddATToMap(AreaTrigger* at) {
+    auto guard = LockForRegionUpdate();
+
     //TODO: Needs clean up. An object should not be added to map twice.
     if (at->IsInWorld())
     {
@@ -687,6 +781,7 @@ bool Map::AddATToMap(AreaTrigger* at) {
     }
 
     Cell cell(cellCoord);
+    RegionExclusiveGuard exclusive(*this, !IsGridOwnedByCurrentRegion(GridCoord(cell.GridX(), cell.GridY())));
     if (at->isActiveObject())
         EnsureGridLoaded(cell);
     else
@@ -793,6 +888,388 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Acore::Objec
     }
 }
 
+void Map::MarkNearbyCellsForUpdate(WorldObject const* obj)
+{
+    // same cells as VisitNearbyCellsOf, collected to be visited later by the region they belong to
+    if (!obj->IsPositionValid())
+        return;
+
+    if (obj->GetGridActivationRange() <= 0.0f)
+        return;
+
+    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), obj->GetGridActivationRange());
+
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
+            if (isCellMarked(cell_id))
+                continue;
+
+            markCell(cell_id);
+            _cellsToUpdate.push_back(cell_id);
+
+            if (!isCellMarkedLarge(cell_id))
+            {
+                markCellLarge(cell_id);
+                _largeCellsToUpdate.push_back(cell_id);
+            }
+        }
+    }
+}
+
+void Map::MarkNearbyCellsForUpdateOfPlayer(Player const* player)
+{
+    if (!player->IsPositionValid())
+        return;
+
+    MarkNearbyCellsForUpdate(player);
+
+    CellArea area = Cell::CalculateCellArea(player->GetPositionX(), player->GetPositionY(), MAX_VISIBILITY_DISTANCE);
+
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
+            if (isCellMarkedLarge(cell_id))
+                continue;
+
+            markCellLarge(cell_id);
+            _largeCellsToUpdate.push_back(cell_id);
+        }
+    }
+}
+
+void Map::BuildUpdateRegions()
+{
+    auto gridOfCell = [](uint32 cell_id)
+    {
+        uint32 const x = (cell_id % TOTAL_NUMBER_OF_CELLS_PER_MAP) / MAX_NUMBER_OF_CELLS;
+        uint32 const y = (cell_id / TOTAL_NUMBER_OF_CELLS_PER_MAP) / MAX_NUMBER_OF_CELLS;
+        return x * MAX_NUMBER_OF_GRIDS + y;
+    };
+
+    std::vector<uint32> grids;
+    grids.reserve(_cellsToUpdate.size() + _largeCellsToUpdate.size());
+    for (uint32 cell_id : _cellsToUpdate)
+        grids.push_back(gridOfCell(cell_id));
+    for (uint32 cell_id : _largeCellsToUpdate)
+        grids.push_back(gridOfCell(cell_id));
+
+    std::sort(grids.begin(), grids.end());
+    grids.erase(std::unique(grids.begin(), grids.end()), grids.end());
+
+    // grid -> index + 1 in grids while the regions are built, region index + 1 once they are
+    _gridRegions.assign(MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS, 0);
+    for (uint32 i = 0; i < grids.size(); ++i)
+        _gridRegions[grids[i]] = i + 1;
+
+    auto indexOfGrid = [this](uint32 grid)
+    {
+        return _gridRegions[grid] - 1;
+    };
+
+    std::vector<uint32> parent(grids.size());
+    for (uint32 i = 0; i < parent.size(); ++i)
+        parent[i] = i;
+
+    auto findRoot = [&parent](uint32 i)
+    {
+        while (parent[i] != i)
+            i = parent[i] = parent[parent[i]];
+        return i;
+    };
+
+    auto unite = [&](uint32 a, uint32 b)
+    {
+        a = findRoot(a);
+        b = findRoot(b);
+        if (a != b)
+            parent[std::max(a, b)] = std::min(a, b);
+    };
+
+    // Grids closer than what an object can see or search for may interact within one tick, keep them together
+    float const interactionRange = std::max(GetVisibilityRange(), MAX_VISIBILITY_DISTANCE) + MAX_SEARCHER_DISTANCE;
+    uint32 const linkDistance = uint32(std::ceil(interactionRange / SIZE_OF_GRIDS));
+
+    // only the updated grids in the square around each grid are looked at, not every pair
+    for (uint32 i = 0; i < grids.size(); ++i)
+    {
+        uint32 const xi = grids[i] / MAX_NUMBER_OF_GRIDS;
+        uint32 const yi = grids[i] % MAX_NUMBER_OF_GRIDS;
+        uint32 const xEnd = std::min<uint32>(xi + linkDistance, MAX_NUMBER_OF_GRIDS - 1);
+        uint32 const yEnd = std::min<uint32>(yi + linkDistance, MAX_NUMBER_OF_GRIDS - 1);
+        for (uint32 x = xi > linkDistance ? xi - linkDistance : 0; x <= xEnd; ++x)
+            for (uint32 y = yi > linkDistance ? yi - linkDistance : 0; y <= yEnd; ++y)
+                if (uint32 j = _gridRegions[x * MAX_NUMBER_OF_GRIDS + y]; j > i + 1)
+                    unite(i, j - 1);
+    }
+
+    for (auto const& [first, second] : _linkedUpdateGrids)
+        if (_gridRegions[first] && _gridRegions[second])
+            unite(indexOfGrid(first), indexOfGrid(second));
+
+    std::vector<uint32> regionOfGrid(grids.size());
+    uint32 regionCount = 0;
+    for (uint32 i = 0; i < grids.size(); ++i)
+        regionOfGrid[i] = (findRoot(i) == i) ? regionCount++ : regionOfGrid[findRoot(i)];
+
+    if (_updateRegions.size() < regionCount)
+        _updateRegions.resize(regionCount);
+
+    for (UpdateRegionCells& region : _updateRegions)
+    {
+        region.cells.clear();
+        region.largeCells.clear();
+    }
+
+    _updateRegionCount = regionCount;
+
+    for (uint32 cell_id : _cellsToUpdate)
+        _updateRegions[regionOfGrid[indexOfGrid(gridOfCell(cell_id))]].cells.push_back(cell_id);
+    for (uint32 cell_id : _largeCellsToUpdate)
+        _updateRegions[regionOfGrid[indexOfGrid(gridOfCell(cell_id))]].largeCells.push_back(cell_id);
+
+    for (uint32 i = 0; i < grids.size(); ++i)
+        _gridRegions[grids[i]] = regionOfGrid[i] + 1;
+}
+
+void Map::UpdateActiveCellsParallel(uint32 t_diff, uint32 s_diff)
+{
+    _cellsToUpdate.clear();
+    _largeCellsToUpdate.clear();
+    _linkedUpdateGrids.clear();
+
+    auto linkGrids = [this](WorldObject const* first, WorldObject const* second)
+    {
+        GridCoord const a = Acore::ComputeGridCoord(first->GetPositionX(), first->GetPositionY());
+        GridCoord const b = Acore::ComputeGridCoord(second->GetPositionX(), second->GetPositionY());
+        _linkedUpdateGrids.emplace_back(a.x_coord * MAX_NUMBER_OF_GRIDS + a.y_coord, b.x_coord * MAX_NUMBER_OF_GRIDS + b.y_coord);
+    };
+
+    // Serial phase: same walk as the single threaded update, but the cells are only collected
+    for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
+    {
+        WorldObject* obj = *m_activeNonPlayersIter;
+        ++m_activeNonPlayersIter;
+
+        if (!obj || !obj->IsInWorld())
+            continue;
+
+        MarkNearbyCellsForUpdate(obj);
+    }
+
+    for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
+    {
+        Player* player = m_mapRefIter->GetSource();
+
+        if (!player || !player->IsInWorld())
+            continue;
+
+        // update players at tick
+        player->Update(s_diff);
+
+        MarkNearbyCellsForUpdateOfPlayer(player);
+
+        // far sight objects and far away creatures in combat with the player act on it, they must share its region
+        if (WorldObject* viewPoint = player->GetViewpoint())
+        {
+            if (viewPoint->ToCreature() || viewPoint->ToDynObject())
+            {
+                MarkNearbyCellsForUpdate(viewPoint);
+                linkGrids(player, viewPoint);
+            }
+        }
+
+        if (player->IsInCombat())
+        {
+            for (auto const& pair : player->GetCombatManager().GetPvECombatRefs())
+            {
+                if (Creature* unit = pair.second->GetOther(player)->ToCreature())
+                {
+                    if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
+                    {
+                        MarkNearbyCellsForUpdate(unit);
+                        linkGrids(player, unit);
+                    }
+                }
+            }
+        }
+    }
+
+    // grid loading touches the whole map, do it before going parallel
+    for (uint32 cell_id : _cellsToUpdate)
+        EnsureGridLoaded(Cell(CellCoord(cell_id % TOTAL_NUMBER_OF_CELLS_PER_MAP, cell_id / TOTAL_NUMBER_OF_CELLS_PER_MAP)));
+    for (uint32 cell_id : _largeCellsToUpdate)
+        EnsureGridLoaded(Cell(CellCoord(cell_id % TOTAL_NUMBER_OF_CELLS_PER_MAP, cell_id / TOTAL_NUMBER_OF_CELLS_PER_MAP)));
+
+    BuildUpdateRegions();
+
+    if (!_updateRegionCount)
+        return;
+
+    _regionUpdateDiff = t_diff;
+    _pendingRegionUpdates = _updateRegionCount;
+
+    if (_updateRegionCount == 1)
+    {
+        UpdateRegion(0);
+        return;
+    }
+
+    // Parallel phase: the other regions go to the pool, this thread takes the first one and then helps with the rest.
+    // Only regions of this map are picked up meanwhile, a whole map update must not run nested on this thread.
+    MapUpdater* mapUpdater = sMapMgr->GetMapUpdater();
+    _regionUpdateActive = true;
+
+    for (uint32 i = 1; i < _updateRegionCount; ++i)
+        mapUpdater->schedule_region_update(*this, i);
+
+    UpdateRegion(0);
+
+    while (_pendingRegionUpdates > 0)
+        if (!mapUpdater->run_pending_region_update(*this))
+            std::this_thread::yield();
+
+    // Merge phase: relocations, removals and object updates queued by the regions are handled
+    // by the regular serial steps of Map::Update / Map::DelayedUpdate
+    _regionUpdateActive = false;
+
+    METRIC_VALUE("map_update_regions", uint64(_updateRegionCount),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+}
+
+void Map::UpdateRegion(uint32 index)
+{
+    UpdateRegionCells const& region = _updateRegions[index];
+
+    bool const parallel = _regionUpdateActive;
+    if (parallel)
+    {
+        t_regionMap = this;
+        t_region = index + 1;
+        _regionRunLock.lock_shared();
+    }
+
+    Acore::ObjectUpdater updater(_regionUpdateDiff, false);
+    TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
+    TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+
+    Acore::ObjectUpdater largeObjectUpdater(_regionUpdateDiff, true);
+    TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer  > grid_large_object_update(largeObjectUpdater);
+    TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer  > world_large_object_update(largeObjectUpdater);
+
+    for (uint32 cell_id : region.cells)
+    {
+        if (parallel)
+            ParkRegionIfRequested();
+
+        Cell cell(CellCoord(cell_id % TOTAL_NUMBER_OF_CELLS_PER_MAP, cell_id / TOTAL_NUMBER_OF_CELLS_PER_MAP));
+        Visit(cell, grid_object_update);
+        Visit(cell, world_object_update);
+    }
+
+    for (uint32 cell_id : region.largeCells)
+    {
+        if (parallel)
+            ParkRegionIfRequested();
+
+        Cell cell(CellCoord(cell_id % TOTAL_NUMBER_OF_CELLS_PER_MAP, cell_id / TOTAL_NUMBER_OF_CELLS_PER_MAP));
+        Visit(cell, grid_large_object_update);
+        Visit(cell, world_large_object_update);
+    }
+
+    if (parallel)
+    {
+        _regionRunLock.unlock_shared();
+        t_regionMap = nullptr;
+        t_region = 0;
+    }
+
+    --_pendingRegionUpdates;
+}
+
+std::unique_lock<std::recursive_mutex> Map::LockForRegionUpdate() const
+{
+    if (!_regionUpdateActive)
+        return std::unique_lock<std::recursive_mutex>();
+
+    std::unique_lock<std::recursive_mutex> lock(_regionUpdateLock, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        // the holder may be waiting for the running regions to park, don't keep ours running while blocked
+        bool const running = t_regionMap == this && !t_regionExclusive;
+        if (running)
+            _regionRunLock.unlock_shared();
+
+        lock.lock();
+
+        if (running)
+            _regionRunLock.lock_shared();
+    }
+
+    return lock;
+}
+
+bool Map::IsGridOwnedByCurrentRegion(GridCoord const& p) const
+{
+    if (!_regionUpdateActive)
+        return true;
+
+    if (t_regionMap != this || !p.IsCoordValid())
+        return false;
+
+    return _gridRegions[p.x_coord * MAX_NUMBER_OF_GRIDS + p.y_coord] == t_region;
+}
+
+bool Map::IsObjectUpdatedByCurrentThread(WorldObject const* obj) const
+{
+    if (!_regionUpdateActive)
+        return true;
+
+    return IsGridOwnedByCurrentRegion(Acore::ComputeGridCoord(obj->GetPositionX(), obj->GetPositionY()));
+}
+
+void Map::ParkRegionIfRequested()
+{
+    if (!_regionExclusivePending)
+        return;
+
+    _regionRunLock.unlock_shared();
+    while (_regionExclusivePending)
+        std::this_thread::yield();
+    _regionRunLock.lock_shared();
+}
+
+void Map::BeginRegionExclusive()
+{
+    // called with the region lock held, so there is a single exclusive requester at a time
+    if (t_regionExclusive++)
+        return;
+
+    ++_regionExclusivePending;
+
+    if (t_regionMap == this)
+        _regionRunLock.unlock_shared();
+
+    _regionRunLock.lock();
+}
+
+void Map::EndRegionExclusive()
+{
+    if (--t_regionExclusive)
+        return;
+
+    _regionRunLock.unlock();
+    --_regionExclusivePending;
+
+    if (t_regionMap == this)
+        _regionRunLock.lock_shared();
+}
+
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 {
     if (t_diff)
@@ -811,6 +1288,18 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
+    /// run the anticheat detectors over the movement received from the sessions
+    sAnticheatMgr->AnalyzeMoveQueue(this);
+
+    /// read the terrain players are heading to before their grids have to be created
+    if (_gridPrefetchTimer <= t_diff)
+    {
+        _gridPrefetchTimer = GRID_PREFETCH_INTERVAL;
+        PrefetchGridsAhead();
+    }
+    else
+        _gridPrefetchTimer -= t_diff;
+
     _creatureRespawnScheduler.Update(t_diff);
 
     if (!t_diff)
@@ -850,56 +1339,61 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     std::vector<Creature*> updateList;
     updateList.reserve(10);
 
-    // non-player active objects, increasing iterator in the loop in case of object removal
-    for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
+    if (_parallelUpdate && sMapMgr->GetMapUpdater()->activated())
+        UpdateActiveCellsParallel(t_diff, s_diff);
+    else
     {
-        WorldObject* obj = *m_activeNonPlayersIter;
-        ++m_activeNonPlayersIter;
+        // non-player active objects, increasing iterator in the loop in case of object removal
+        for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
+        {
+            WorldObject* obj = *m_activeNonPlayersIter;
+            ++m_activeNonPlayersIter;
 
-        if (!obj || !obj->IsInWorld())
-            continue;
+            if (!obj || !obj->IsInWorld())
+                continue;
 
-        VisitNearbyCellsOf(obj, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
-    }
+            VisitNearbyCellsOf(obj, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
+        }
 
-    // the player iterator is stored in the map object
-    // to make sure calls to Map::Remove don't invalidate it
-    for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
-    {
-        Player* player = m_mapRefIter->GetSource();
+        // the player iterator is stored in the map object
+        // to make sure calls to Map::Remove don't invalidate it
+        for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
+        {
+            Player* player = m_mapRefIter->GetSource();
 
-        if (!player || !player->IsInWorld())
-            continue;
+            if (!player || !player->IsInWorld())
+                continue;
 
-        // update players at tick
-        player->Update(s_diff);
+            // update players at tick
+            player->Update(s_diff);
 
-        VisitNearbyCellsOfPlayer(player, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
+            VisitNearbyCellsOfPlayer(player, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
 
-        // If player is using far sight, visit that object too
-        if (WorldObject* viewPoint = player->GetViewpoint())
-        {
-            if (Creature* viewCreature = viewPoint->ToCreature())
-            {
-                VisitNearbyCellsOf(viewCreature, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
-            }
-            else if (DynamicObject* viewObject = viewPoint->ToDynObject())
+            // If player is using far sight, visit that object too
+            if (WorldObject* viewPoint = player->GetViewpoint())
             {
-                VisitNearbyCellsOf(viewObject, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
+                if (Creature* viewCreature = viewPoint->ToCreature())
+                {
+                    VisitNearbyCellsOf(viewCreature, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
+                }
+                else if (DynamicObject* viewObject = viewPoint->ToDynObject())
+                {
+                    VisitNearbyCellsOf(viewObject, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
+                }
             }
-        }
 
-        // handle updates for creatures in combat with player and are more than 60 yards away
-        if (player->IsInCombat())
-        {
-            std::vector<Unit*> toVisit;
-            for (auto const& pair : player->GetCombatManager().GetPvECombatRefs())
-                if (Creature* unit = pair.second->GetOther(player)->ToCreature())
-                    if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
-                        toVisit.push_back(unit);
+            // handle updates for creatures in combat with player and are more than 60 yards away
+            if (player->IsInCombat())
+            {
+                std::vector<Unit*> toVisit;
+                for (auto const& pair : player->GetCombatManager().GetPvECombatRefs())
+                    if (Creature* unit = pair.second->GetOther(player)->ToCreature())
+                        if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
+                            toVisit.push_back(unit);
                     
-            for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
+                for (Unit* unit : toVisit)
+                    VisitNearbyCellsOf(unit, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
+            }
         }
     }
 
@@ -939,6 +1433,24 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_proc_events", _procEvents.exchange(0),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_proc_candidates", _procCandidates.exchange(0),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_proc_skipped_auras", _procSkippedAuras.exchange(0),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+}
+
+void Map::AddToDelayedVisibility(Unit* unit)
+{
+    auto guard = LockForRegionUpdate();
+    i_objectsForDelayedVisibility.insert(unit);
 }
 
 void Map::HandleDelayedVisibility()
@@ -992,6 +1504,13 @@ void Map::AfterPlayerUnlinkFromMap()
 template<class T>
 void Map::RemoveFromMap(T* obj, bool remove)
 {
+    // corpses do not move, the others may already be relocated to a cell they are not linked to yet
+    GridCoord grid = Acore::ComputeGridCoord(obj->GetPositionX(), obj->GetPositionY());
+    if constexpr (!std::is_same_v<T, Corpse>)
+        grid = GridCoord(obj->GetCurrentCell().GridX(), obj->GetCurrentCell().GridY());
+
+    RegionExclusiveGuard exclusive(*this, !IsGridOwnedByCurrentRegion(grid));
+
     bool inWorld = obj->IsInWorld() && obj->GetTypeId() >= TYPEID_UNIT && obj->GetTypeId() <= TYPEID_GAMEOBJECT;
     obj->RemoveFromWorld();
 
@@ -1171,6 +1690,7 @@ void Map::AreaTriggerRelocation(AreaTrigger* at, float x, float y, float z, floa
 
 void Map::AddCreatureToMoveList(Creature* c)
 {
+    auto guard = LockForRegionUpdate();
     if (c->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
         _creaturesToMove.push_back(c);
     c->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
@@ -1184,6 +1704,7 @@ void Map::RemoveCreatureFromMoveList(Creature* c)
 
 void Map::AddGameObjectToMoveList(GameObject* go)
 {
+    auto guard = LockForRegionUpdate();
     if (go->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
         _gameObjectsToMove.push_back(go);
     go->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
@@ -1197,6 +1718,7 @@ void Map::RemoveGameObjectFromMoveList(GameObject* go)
 
 void Map::AddDynamicObjectToMoveList(DynamicObject* dynObj)
 {
+    auto guard = LockForRegionUpdate();
     if (dynObj->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
         _dynamicObjectsToMove.push_back(dynObj);
     dynObj->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
@@ -1210,6 +1732,8 @@ void Map::RemoveDynamicObjectFromMoveList(DynamicObject* dynObj)
 
 void Map::AddAreaTriggerToMoveList(AreaTrigger* at, float x, float y, float z, float ang)
 {
+    auto guard = LockForRegionUpdate();
+
     if (_areaTriggersToMoveLock) //can this happen?
         return;
 
@@ -2217,7 +2741,11 @@ bool Map::GetAreaInfo(uint32 phaseMask, float x, float y, float z, uint32& flags
     int32 dgroupId;
 
     bool hasVmapAreaInfo = vmgr->GetAreaInfo(GetId(), x, y, vmap_z, vflags, vadtId, vrootId, vgroupId);
-    bool hasDynamicAreaInfo = _dynamicTree.GetAreaInfo(x, y, dynamic_z, phaseMask, dflags, dadtId, drootId, dgroupId);
+    bool hasDynamicAreaInfo;
+    {
+        auto guard = LockDynamicTreeForRead();
+        hasDynamicAreaInfo = _dynamicTree.GetAreaInfo(x, y, dynamic_z, phaseMask, dflags, dadtId, drootId, dgroupId);
+    }
     auto useVmap = [&]() { check_z = vmap_z; flags = vflags; adtId = vadtId; rootId = vrootId; groupId = vgroupId; };
     auto useDyn = [&]() { check_z = dynamic_z; flags = dflags; adtId = dadtId; rootId = drootId; groupId = dgroupId; };
 
@@ -2564,6 +3092,7 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
             ignoreFlags = VMAP::ModelIgnoreFlags::M2;
         }
 
+        auto guard = LockDynamicTreeForRead();
         if (!_dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, ignoreFlags))
         {
             return false;
@@ -2579,6 +3108,7 @@ bool Map::GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float
     G3D::Vector3 dstPos(x2, y2, z2);
 
     G3D::Vector3 resultPos;
+    auto guard = LockDynamicTreeForRead();
     bool result = _dynamicTree.GetObjectHitPos(phasemask, startPos, dstPos, resultPos, modifyDist);
 
     rx = resultPos.x;
@@ -2591,7 +3121,7 @@ float Map::GetHeight(uint32 phasemask, float x, float y, float z, bool vmap/*=tr
 {
     float h1, h2;
     h1 = GetHeight(x, y, z, vmap, maxSearchDist);
-    h2 = _dynamicTree.getHeight(x, y, z, maxSearchDist, phasemask);
+    h2 = GetGameObjectFloor(phasemask, x, y, z, maxSearchDist);
     return std::max<float>(h1, h2);
 }
 
@@ -2750,6 +3280,8 @@ void Map::AddObjectToRemoveList(WorldObject* obj)
 {
     ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
 
+    auto guard = LockForRegionUpdate();
+
     obj->CleanupsBeforeDelete(false);                            // remove or simplify at least cross referenced links
 
     i_objectsToRemove.insert(obj);
@@ -2764,6 +3296,8 @@ void Map::AddObjectToSwitchList(WorldObject* obj, bool on)
     if (obj->GetTypeId() != TYPEID_UNIT && obj->GetTypeId() != TYPEID_GAMEOBJECT)
         return;
 
+    auto guard = LockForRegionUpdate();
+
     std::map<WorldObject*, bool>::iterator itr = i_objectsToSwitch.find(obj);
     if (itr == i_objectsToSwitch.end())
         i_objectsToSwitch.insert(itr, std::make_pair(obj, on));
@@ -3408,21 +3942,25 @@ void BattlegroundMap::RemoveAllPlayers()
 
 Corpse* Map::GetCorpse(ObjectGuid const guid)
 {
+    auto guard = LockObjectStoresForRead();
     return _objectsStore.Find<Corpse>(guid);
 }
 
 Creature* Map::GetCreature(ObjectGuid const guid)
 {
+    auto guard = LockObjectStoresForRead();
     return _objectsStore.Find<Creature>(guid);
 }
 
 GameObject* Map::GetGameObject(ObjectGuid const guid)
 {
+    auto guard = LockObjectStoresForRead();
     return _objectsStore.Find<GameObject>(guid);
 }
 
 Pet* Map::GetPet(ObjectGuid const guid)
 {
+    auto guard = LockObjectStoresForRead();
     return _objectsStore.Find<Pet>(guid);
 }
 
@@ -3437,6 +3975,7 @@ Transport* Map::GetTransport(ObjectGuid guid)
 
 DynamicObject* Map::GetDynamicObject(ObjectGuid guid)
 {
+    auto guard = LockObjectStoresForRead();
     return _objectsStore.Find<DynamicObject>(guid);
 }
 
@@ -3448,6 +3987,8 @@ void Map::UpdateIteratorBack(Player* player)
 
 void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
 {
+    auto guard = LockForRegionUpdate();
+
     if (!respawnTime)
     {
         // Delete only
@@ -3471,6 +4012,8 @@ void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTi
 
 void Map::RemoveCreatureRespawnTime(ObjectGuid::LowType spawnId)
 {
+    auto guard = LockForRegionUpdate();
+
     _creatureRespawnTimes.erase(spawnId);
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
@@ -3482,6 +4025,8 @@ void Map::RemoveCreatureRespawnTime(ObjectGuid::LowType spawnId)
 
 void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
 {
+    auto guard = LockForRegionUpdate();
+
     if (!respawnTime)
     {
         // Delete only
@@ -3505,6 +4050,8 @@ void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
 
 void Map::RemoveGORespawnTime(ObjectGuid::LowType spawnId)
 {
+    auto guard = LockForRegionUpdate();
+
     _goRespawnTimes.erase(spawnId);
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
@@ -4196,6 +4743,7 @@ std::string InstanceMap::GetDebugInfo() const
 // hater: dynamic spawns
 void Map::ApplyDynamicModeRespawnScaling(WorldObject const* obj, ObjectGuid::LowType spawnId, uint32& respawnDelay) const
 {
+    auto guard = LockForRegionUpdate();
     auto it = _zonePlayerCountMap.find(obj->GetZoneId());
     
     if (it == _zonePlayerCountMap.end())
@@ -4219,6 +4767,8 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
     if (oldZone == newZone)
         return;
 
+    auto guard = LockForRegionUpdate();
+
     if (oldZone != MAP_INVALID_ZONE)
     {
         uint32& oldZoneCount = _zonePlayerCountMap[oldZone];
@@ -34,6 +34,7 @@
 #include "SharedDefines.h"
 #include "TaskScheduler.h"
 #include "Timer.h"
+#include <atomic>
 #include <bitset>
 #include <list>
 #include <memory>
@@ -62,6 +63,7 @@ class StaticTransport;
 class MotionTransport;
 class PathGenerator;
 class AreaTrigger;
+class AnticheatMoveQueue;
 
 enum WeatherState : uint32;
 
@@ -393,8 +395,20 @@ public:
     [[nodiscard]] std::shared_mutex& GetMMapLock() const { return *(const_cast<std::shared_mutex*>(&MMapLock)); }
     // pussywizard:
     std::unordered_set<Unit*> i_objectsForDelayedVisibility;
+    void AddToDelayedVisibility(Unit* unit);
     void HandleDelayedVisibility();
 
+    // Proc dispatch cost of the current update, reported through the metric system once per update
+    void AddProcEventStats(uint32 candidates, uint32 appliedAuras)
+    {
+        ++_procEvents;
+        _procCandidates.fetch_add(candidates, std::memory_order_relaxed);
+        _procSkippedAuras.fetch_add(appliedAuras - candidates, std::memory_order_relaxed);
+    }
+
+    // Parallel update of independent grid regions, see MapUpdate.Parallel.Maps
+    void UpdateRegion(uint32 index);
+
     // some calls like isInWater should not use vmaps due to processor power
     // can return INVALID_HEIGHT if under z+2 z coord not found height
     [[nodiscard]] float GetHeight(float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
@@ -522,6 +536,21 @@ public:
 
     MapStoredObjectTypesContainer& GetObjectsStore() { return _objectsStore; }
 
+    // Always true outside of a parallel region update, else only for the thread running the region of the object's grid
+    [[nodiscard]] bool IsObjectUpdatedByCurrentThread(WorldObject const* obj) const;
+
+    // The object stores (guid and spawn id) are shared by the grid regions updated in parallel: lookups take the read lock,
+    // AddToWorld / RemoveFromWorld the write lock. Both are no-ops outside of the parallel phase.
+    [[nodiscard]] std::shared_lock<std::shared_mutex> LockObjectStoresForRead() const
+    {
+        return _regionUpdateActive ? std::shared_lock<std::shared_mutex>(_objectStoresLock) : std::shared_lock<std::shared_mutex>();
+    }
+
+    [[nodiscard]] std::unique_lock<std::shared_mutex> LockObjectStoresForWrite()
+    {
+        return _regionUpdateActive ? std::unique_lock<std::shared_mutex>(_objectStoresLock) : std::unique_lock<std::shared_mutex>();
+    }
+
     typedef std::unordered_multimap<ObjectGuid::LowType, Creature*> CreatureBySpawnIdContainer;
     CreatureBySpawnIdContainer& GetCreatureBySpawnIdStore() { return _creatureBySpawnIdStore; }
 
@@ -566,16 +595,24 @@ public:
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CheckCollisionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true) const;
-    void Balance() { _dynamicTree.balance(); }
-    void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); }
-    void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
-    [[nodiscard]] bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
+    void Balance() { auto guard = LockDynamicTreeForWrite(); _dynamicTree.balance(); }
+    void RemoveGameObjectModel(const GameObjectModel& model) { auto guard = LockDynamicTreeForWrite(); _dynamicTree.remove(model); }
+    void InsertGameObjectModel(const GameObjectModel& model) { auto guard = LockDynamicTreeForWrite(); _dynamicTree.insert(model); }
+    [[nodiscard]] bool ContainsGameObjectModel(const GameObjectModel& model) const { auto guard = LockDynamicTreeForRead(); return _dynamicTree.contains(model);}
+    // Direct readers must hold LockDynamicTreeForRead() when called from an object update
     [[nodiscard]] DynamicMapTree const& GetDynamicMapTree() const { return _dynamicTree; }
     bool GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist);
     [[nodiscard]] float GetGameObjectFloor(uint32 phasemask, float x, float y, float z, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const
     {
+        auto guard = LockDynamicTreeForRead();
         return _dynamicTree.getHeight(x, y, z, maxSearchDist, phasemask);
     }
+
+    // Same as the object stores, the dynamic tree is changed by objects of one region while the others query it
+    [[nodiscard]] std::shared_lock<std::shared_mutex> LockDynamicTreeForRead() const
+    {
+        return _regionUpdateActive ? std::shared_lock<std::shared_mutex>(_dynamicTreeLock) : std::shared_lock<std::shared_mutex>();
+    }
     /*
         RESPAWN TIMES
     */
@@ -606,6 +643,8 @@ public:
     void DeleteRespawnTimes();
     [[nodiscard]] time_t GetInstanceResetPeriod() const { return _instanceResetPeriod; }
 
+    AnticheatMoveQueue& GetAnticheatMoveQueue() { return *_anticheatMoveQueue; }
+
     TaskScheduler _creatureRespawnScheduler;
 
     void ScheduleCreatureRespawn(ObjectGuid /*creatureGuid*/, Milliseconds /*respawnTimer*/);
@@ -648,16 +687,19 @@ public:
     inline ObjectGuid::LowType GenerateLowGuid()
     {
         static_assert(ObjectGuidTraits<high>::MapSpecific, "Only map specific guid can be generated in Map context");
+        auto guard = LockForRegionUpdate();
         return GetGuidSequenceGenerator<high>().Generate();
     }
 
     void AddUpdateObject(Object* obj)
     {
+        auto guard = LockForRegionUpdate();
         _updateObjects.insert(obj);
     }
 
     void RemoveUpdateObject(Object* obj)
     {
+        auto guard = LockForRegionUpdate();
         _updateObjects.erase(obj);
     }
 
@@ -668,8 +710,21 @@ public:
 
     virtual std::string GetDebugInfo() const;
 
+    // Smoothed wall clock time (microseconds) of this map's recent updates, used by MapUpdater to start the most expensive maps first
+    [[nodiscard]] virtual uint32 GetUpdateCost() const { return _updateCost; }
+    void RecordUpdateCost(uint32 costUs) { _updateCost = (_updateCost * 3 + costUs) / 4; }
+
     // hater: dynamic spawns
     void UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone);
+
+    // Zone scripts, outdoor PvP and battlefields are shared by every grid region, their callbacks
+    // run while the other regions are parked. Runs the callback directly outside of the parallel phase.
+    template<class Callback>
+    void RunRegionExclusive(Callback&& callback)
+    {
+        RegionExclusiveGuard exclusive(*this, true);
+        callback();
+    }
     void ApplyDynamicModeRespawnScaling(WorldObject const* obj, ObjectGuid::LowType spawnId, uint32& respawnDelay) const;
 
 private:
@@ -719,8 +774,86 @@ private:
 
     void SendObjectUpdates();
 
+    // Cells visited by the object updaters of one group of grids that cannot interact with the other groups within a tick
+    struct UpdateRegionCells
+    {
+        std::vector<uint32> cells;
+        std::vector<uint32> largeCells;
+    };
+
+    void UpdateActiveCellsParallel(uint32 t_diff, uint32 s_diff);
+    void MarkNearbyCellsForUpdate(WorldObject const* obj);
+    void MarkNearbyCellsForUpdateOfPlayer(Player const* player);
+    void BuildUpdateRegions();
+
+    // Serializes the map wide containers while regions are updated in parallel, no-op otherwise
+    std::unique_lock<std::recursive_mutex> LockForRegionUpdate() const;
+
+    [[nodiscard]] std::unique_lock<std::shared_mutex> LockDynamicTreeForWrite()
+    {
+        return _regionUpdateActive ? std::unique_lock<std::shared_mutex>(_dynamicTreeLock) : std::unique_lock<std::shared_mutex>();
+    }
+
+    // A region only reads the grids within interaction range of its own cells and only changes its own grids. Changes
+    // to any other grid (creating, loading, adding or removing objects) are made while the other regions are parked
+    // between two cells, see RegionExclusiveGuard.
+    [[nodiscard]] bool IsGridOwnedByCurrentRegion(GridCoord const& p) const;
+    void ParkRegionIfRequested();
+    void BeginRegionExclusive();
+    void EndRegionExclusive();
+
+    class RegionExclusiveGuard
+    {
+    public:
+        RegionExclusiveGuard(Map& map, bool engage) : _map(map), _lock(map.LockForRegionUpdate()), _engaged(engage && map._regionUpdateActive)
+        {
+            if (_engaged)
+                _map.BeginRegionExclusive();
+        }
+
+        ~RegionExclusiveGuard()
+        {
+            if (_engaged)
+                _map.EndRegionExclusive();
+        }
+
+        RegionExclusiveGuard(RegionExclusiveGuard const&) = delete;
+        RegionExclusiveGuard& operator=(RegionExclusiveGuard const&) = delete;
+
+    private:
+        Map& _map;
+        std::unique_lock<std::recursive_mutex> _lock;
+        bool _engaged;
+    };
+
+    bool _parallelUpdate;
+    std::atomic<bool> _regionUpdateActive;
+    uint32 _regionUpdateDiff;
+    mutable std::recursive_mutex _regionUpdateLock;
+    mutable std::shared_mutex _regionRunLock;           // held shared by every running region, exclusively by RegionExclusiveGuard
+    std::atomic<uint32> _regionExclusivePending;
+    mutable std::shared_mutex _objectStoresLock;
+    mutable std::shared_mutex _dynamicTreeLock;
+    std::atomic<uint32> _pendingRegionUpdates;
+    std::vector<uint32> _cellsToUpdate;
+    std::vector<uint32> _largeCellsToUpdate;
+    std::vector<std::pair<uint32, uint32>> _linkedUpdateGrids;
+    std::vector<UpdateRegionCells> _updateRegions;
+    std::vector<uint32> _gridRegions;                   // region index + 1 of every grid, 0 for the grids not updated
+    uint32 _updateRegionCount;
+
     std::unordered_map<uint32, uint32> _zonePlayerCountMap;
 
+    // Queues the vmap and mmap tiles ahead of moving players to the GridPrefetcher
+    void PrefetchGridsAhead();
+    void PrefetchGrid(float x, float y);
+
+    uint32 _gridPrefetchTimer;
+
+    std::atomic<uint64> _procEvents;
+    std::atomic<uint64> _procCandidates;
+    std::atomic<uint64> _procSkippedAuras;
+
 protected:
     std::mutex Lock;
     std::mutex GridLock;
@@ -737,6 +870,9 @@ protected:
     MapRefMgr m_mapRefMgr;
     MapRefMgr::iterator m_mapRefIter;
 
+    // movement of the players on the map, analyzed by the anticheat once their sessions are updated
+    std::unique_ptr<AnticheatMoveQueue> _anticheatMoveQueue;
+
     typedef std::set<WorldObject*> ActiveNonPlayers;
     ActiveNonPlayers m_activeNonPlayers;
     ActiveNonPlayers::iterator m_activeNonPlayersIter;
@@ -781,11 +917,14 @@ private:
 
     void AddToActiveHelper(WorldObject* obj)
     {
+        auto guard = LockForRegionUpdate();
         m_activeNonPlayers.insert(obj);
     }
 
     void RemoveFromActiveHelper(WorldObject* obj)
     {
+        auto guard = LockForRegionUpdate();
+
         // Map::Update for active object in proccess
         if (m_activeNonPlayersIter != m_activeNonPlayers.end())
         {
@@ -805,6 +944,7 @@ private:
 
     ZoneDynamicInfoMap _zoneDynamicInfo;
     uint32 _defaultLight;
+    uint32 _updateCost;
 
     template<HighGuid high>
     inline ObjectGuidGeneratorBase& GetGuidSequenceGenerator()
@@ -71,6 +71,15 @@ void MapInstanced::Update(const uint32 t, const uint32 s_diff, bool /*thread*/)
     }
 }
 
+uint32 MapInstanced::GetUpdateCost() const
+{
+    uint32 cost = Map::GetUpdateCost();
+    for (InstancedMaps::const_iterator i = m_InstancedMaps.begin(); i != m_InstancedMaps.end(); ++i)
+        cost += i->second->GetUpdateCost();
+
+    return cost;
+}
+
 void MapInstanced::DelayedUpdate(const uint32 diff)
 {
     for (InstancedMaps::iterator i = m_InstancedMaps.begin(); i != m_InstancedMaps.end(); ++i)
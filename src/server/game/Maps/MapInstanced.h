@@ -34,6 +34,8 @@ public:
     // functions overwrite Map versions
     void Update(const uint32, const uint32, bool thread = true) override;
     void DelayedUpdate(const uint32 diff) override;
+    // The instances are only queued once this map ran, so it is as expensive as all of them together
+    [[nodiscard]] uint32 GetUpdateCost() const override;
     //void RelocationNotify();
     void UnloadAll() override;
     EnterState CannotEnter(Player* player, bool loginCheck = false) override;
@@ -17,6 +17,7 @@
 
 #include "MapMgr.h"
 #include "Chat.h"
+#include "Config.h"
 #include "DatabaseEnv.h"
 #include "GridDefines.h"
 #include "Group.h"
@@ -30,6 +31,8 @@
 #include "Opcodes.h"
 #include "Player.h"
 #include "ScriptMgr.h"
+#include "StringConvert.h"
+#include "Tokenize.h"
 #include "Transport.h"
 #include "World.h"
 #include "WorldPacket.h"
@@ -58,6 +61,17 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    // Read terrain tiles ahead of moving players
+    int32 prefetchThreads = sConfigMgr->GetOption<int32>("MapUpdate.Prefetch.Threads", 1);
+    if (prefetchThreads > 0)
+        m_prefetcher.activate(prefetchThreads);
+
+    _parallelUpdateMaps.clear();
+    std::string const parallelUpdateMaps = sConfigMgr->GetOption<std::string>("MapUpdate.Parallel.Maps", "");
+    for (std::string_view mapId : Acore::Tokenize(parallelUpdateMaps, ',', false))
+        if (Optional<uint32> id = Acore::StringTo<uint32>(mapId))
+            _parallelUpdateMaps.insert(*id);
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -337,6 +351,9 @@ void MapMgr::UnloadAll()
 
     if (m_updater.activated())
         m_updater.deactivate();
+
+    if (m_prefetcher.activated())
+        m_prefetcher.deactivate();
 }
 
 void MapMgr::GetNumInstances(uint32& dungeons, uint32& battlegrounds, uint32& arenas)
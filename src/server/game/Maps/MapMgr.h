@@ -20,6 +20,7 @@
 
 #include "Common.h"
 #include "Define.h"
+#include "GridPrefetcher.h"
 #include "Map.h"
 #include "MapInstanced.h"
 #include "MapUpdater.h"
@@ -27,6 +28,7 @@
 
 #include <boost/dynamic_bitset.hpp>
 #include <mutex>
+#include <unordered_set>
 
 class Transport;
 class StaticTransport;
@@ -153,6 +155,10 @@ public:
     void RegisterInstanceId(uint32 instanceId);
 
     MapUpdater* GetMapUpdater() { return &m_updater; }
+    GridPrefetcher* GetGridPrefetcher() { return &m_prefetcher; }
+
+    // maps whose independent grid regions are updated in parallel, see MapUpdate.Parallel.Maps
+    [[nodiscard]] bool IsParallelUpdateEnabled(uint32 mapId) const { return _parallelUpdateMaps.find(mapId) != _parallelUpdateMaps.end(); }
 
     template<typename Worker>
     void DoForAllMaps(Worker&& worker);
@@ -178,6 +184,8 @@ private:
     InstanceIds _instanceIds;
     uint32 _nextInstanceId;
     MapUpdater m_updater;
+    GridPrefetcher m_prefetcher;
+    std::unordered_set<uint32> _parallelUpdateMaps;
 };
 
 template<typename Worker>
@@ -17,66 +17,41 @@
 
 #include "MapUpdater.h"
 #include "DatabaseEnv.h"
+#include "Duration.h"
 #include "LFGMgr.h"
 #include "Map.h"
 #include "Metric.h"
+#include <algorithm>
+#include <limits>
 
-class UpdateRequest
+namespace
 {
-public:
-    UpdateRequest() = default;
-    virtual ~UpdateRequest() = default;
-
-    virtual void call() = 0;
-};
+    // Set on pool threads, so requests scheduled from inside a map update (instances of a MapInstanced) stay on the scheduling worker
+    thread_local MapUpdater const* t_updater = nullptr;
+    thread_local size_t t_workerIndex = 0;
+
+    // lfg compatibles are processed from the very beginning of the tick
+    constexpr uint32 LFG_UPDATE_COST = std::numeric_limits<uint32>::max();
+    // a map update is blocked until its grid regions are done, run them before anything else
+    constexpr uint32 REGION_UPDATE_COST = LFG_UPDATE_COST - 1;
+}
 
-class MapUpdateRequest : public UpdateRequest
+MapUpdater::MapUpdater() : _cancelationToken(false), _queuedRequests(0), _idleWorkers(0), _pendingRequests(0)
 {
-public:
-    MapUpdateRequest(Map& m, MapUpdater& u, uint32 d, uint32 sd)
-        : m_map(m), m_updater(u), m_diff(d), s_diff(sd)
-    {
-    }
-
-    void call() override
-    {
-        METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(m_map.GetId())));
-        m_map.Update(m_diff, s_diff);
-        m_updater.update_finished();
-    }
-
-private:
-    Map& m_map;
-    MapUpdater& m_updater;
-    uint32 m_diff;
-    uint32 s_diff;
-};
+}
 
-class LFGUpdateRequest : public UpdateRequest
+void MapUpdater::activate(size_t num_threads)
 {
-public:
-    LFGUpdateRequest(MapUpdater& u, uint32 d) : m_updater(u), m_diff(d) {}
-
-    void call() override
+    _queues.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i)
     {
-        sLFGMgr->Update(m_diff, 1);
-        m_updater.update_finished();
+        _queues.push_back(std::make_unique<WorkerQueue>());
     }
-private:
-    MapUpdater& m_updater;
-    uint32 m_diff;
-};
 
-MapUpdater::MapUpdater(): pending_requests(0)
-{
-}
-
-void MapUpdater::activate(size_t num_threads)
-{
     _workerThreads.reserve(num_threads);
     for (size_t i = 0; i < num_threads; ++i)
     {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this, i));
     }
 }
 
@@ -86,7 +61,10 @@ void MapUpdater::deactivate()
 
     wait();
 
-    _queue.Cancel();
+    {
+        std::lock_guard<std::mutex> guard(_idleLock);
+        _idleCondition.notify_all();
+    }
 
     for (auto& thread : _workerThreads)
     {
@@ -99,30 +77,55 @@ void MapUpdater::deactivate()
 
 void MapUpdater::wait()
 {
-    std::unique_lock<std::mutex> guard(_lock);
+    Dispatch();
+
+    if (_pendingRequests == 0)
+        return;
 
-    while (pending_requests > 0)
-        _condition.wait(guard);
+    std::unique_lock<std::mutex> guard(_lock);
 
-    guard.unlock();
+    _condition.wait(guard, [this] { return _pendingRequests == 0; });
 }
 
 void MapUpdater::schedule_update(Map& map, uint32 diff, uint32 s_diff)
 {
-    std::lock_guard<std::mutex> guard(_lock);
+    UpdateRequest request{ UpdateRequest::MAP_UPDATE, &map, diff, s_diff, map.GetUpdateCost() };
 
-    ++pending_requests;
+    ++_pendingRequests;
 
-    _queue.Push(new MapUpdateRequest(map, *this, diff, s_diff));
+    // scheduled from a map update, the world thread is already waiting for us
+    if (t_updater == this)
+        Push(t_workerIndex, request);
+    else
+        _scheduled.push_back(request);
 }
 
 void MapUpdater::schedule_lfg_update(uint32 diff)
 {
-    std::lock_guard<std::mutex> guard(_lock);
+    ++_pendingRequests;
 
-    ++pending_requests;
+    _scheduled.push_back({ UpdateRequest::LFG_UPDATE, nullptr, diff, 0, LFG_UPDATE_COST });
+}
+
+void MapUpdater::schedule_region_update(Map& map, uint32 region)
+{
+    // only called by a map being updated on one of our workers, which waits for its regions
+    // before finishing, so these are not accounted in the pending requests
+    ASSERT(t_updater == this);
+
+    Push(t_workerIndex, { UpdateRequest::REGION_UPDATE, &map, region, 0, REGION_UPDATE_COST });
+}
+
+bool MapUpdater::run_pending_region_update(Map& map)
+{
+    ASSERT(t_updater == this);
+
+    UpdateRequest request;
+    if (!PopRegion(&map, request))
+        return false;
 
-    _queue.Push(new LFGUpdateRequest(*this, diff));
+    Execute(request);
+    return true;
 }
 
 bool MapUpdater::activated()
@@ -132,29 +135,163 @@ bool MapUpdater::activated()
 
 void MapUpdater::update_finished()
 {
-    std::lock_guard<std::mutex> lock(_lock);
+    if (--_pendingRequests > 0)
+        return;
 
-    --pending_requests;
+    std::lock_guard<std::mutex> guard(_lock);
 
     _condition.notify_all();
 }
 
-void MapUpdater::WorkerThread()
+void MapUpdater::Dispatch()
+{
+    if (_scheduled.empty())
+        return;
+
+    // Longest job first: deal the requests out round robin starting from the most expensive one,
+    // so every worker begins with one of the heaviest maps and stealing evens out the cheap tail
+    std::sort(_scheduled.begin(), _scheduled.end());
+
+    size_t const count = _scheduled.size();
+    size_t const workers = _queues.size();
+
+    _queuedRequests += count;
+
+    for (size_t worker = 0; worker < workers; ++worker)
+    {
+        WorkerQueue& queue = *_queues[worker];
+        std::lock_guard<std::mutex> guard(queue.lock);
+
+        for (size_t i = 0; i < count; ++i)
+            if ((count - 1 - i) % workers == worker)
+                queue.requests.push_back(_scheduled[i]);
+    }
+
+    _scheduled.clear();
+
+    if (_idleWorkers > 0)
+    {
+        std::lock_guard<std::mutex> guard(_idleLock);
+        _idleCondition.notify_all();
+    }
+}
+
+void MapUpdater::Push(size_t index, UpdateRequest const& request)
 {
+    ++_queuedRequests;
+
+    {
+        WorkerQueue& queue = *_queues[index];
+        std::lock_guard<std::mutex> guard(queue.lock);
+
+        queue.requests.insert(std::upper_bound(queue.requests.begin(), queue.requests.end(), request), request);
+    }
+
+    if (_idleWorkers > 0)
+    {
+        std::lock_guard<std::mutex> guard(_idleLock);
+        _idleCondition.notify_one();
+    }
+}
+
+bool MapUpdater::Pop(size_t index, UpdateRequest& request)
+{
+    // own queue first, then steal the most expensive request of the other workers
+    size_t const workers = _queues.size();
+    for (size_t i = 0; i < workers && _queuedRequests > 0; ++i)
+    {
+        WorkerQueue& queue = *_queues[(index + i) % workers];
+        std::lock_guard<std::mutex> guard(queue.lock);
+
+        if (queue.requests.empty())
+            continue;
+
+        request = queue.requests.back();
+        queue.requests.pop_back();
+        --_queuedRequests;
+        return true;
+    }
+
+    return false;
+}
+
+bool MapUpdater::PopRegion(Map const* map, UpdateRequest& request)
+{
+    // region requests are the most expensive after the lfg one, they sit at the back of the queues
+    size_t const workers = _queues.size();
+    for (size_t i = 0; i < workers && _queuedRequests > 0; ++i)
+    {
+        WorkerQueue& queue = *_queues[(t_workerIndex + i) % workers];
+        std::lock_guard<std::mutex> guard(queue.lock);
+
+        for (auto itr = queue.requests.rbegin(); itr != queue.requests.rend() && itr->cost >= REGION_UPDATE_COST; ++itr)
+        {
+            if (itr->type != UpdateRequest::REGION_UPDATE || itr->map != map)
+                continue;
+
+            request = *itr;
+            queue.requests.erase(std::next(itr).base());
+            --_queuedRequests;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void MapUpdater::Execute(UpdateRequest const& request)
+{
+    switch (request.type)
+    {
+        case UpdateRequest::LFG_UPDATE:
+            sLFGMgr->Update(request.diff, 1);
+            update_finished();
+            return;
+        case UpdateRequest::REGION_UPDATE:
+            request.map->UpdateRegion(request.diff);
+            return;
+        default:
+            break;
+    }
+
+    Map& map = *request.map;
+    {
+        METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(map.GetId())));
+
+        auto const start = std::chrono::steady_clock::now();
+        map.Update(request.diff, request.s_diff);
+        map.RecordUpdateCost(uint32(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start).count()));
+    }
+
+    update_finished();
+}
+
+void MapUpdater::WorkerThread(size_t index)
+{
+    t_updater = this;
+    t_workerIndex = index;
+
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
 
+    UpdateRequest request;
+
     while (1)
     {
-        UpdateRequest* request = nullptr;
+        if (Pop(index, request))
+        {
+            Execute(request);
+            continue;
+        }
 
-        _queue.WaitAndPop(request);
-        if (_cancelationToken)
-            return;
+        std::unique_lock<std::mutex> guard(_idleLock);
 
-        request->call();
+        ++_idleWorkers;
+        _idleCondition.wait(guard, [this] { return _queuedRequests > 0 || _cancelationToken; });
+        --_idleWorkers;
 
-        delete request;
+        if (_cancelationToken && _queuedRequests == 0)
+            return;
     }
 }
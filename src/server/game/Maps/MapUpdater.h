@@ -19,13 +19,14 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
-#include "PCQueue.h"
+#include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 class Map;
-class UpdateRequest;
 
 class MapUpdater
 {
@@ -35,6 +36,8 @@ public:
 
     void schedule_update(Map& map, uint32 diff, uint32 s_diff);
     void schedule_lfg_update(uint32 diff);
+    void schedule_region_update(Map& map, uint32 region);
+    bool run_pending_region_update(Map& map);
     void wait();
     void activate(size_t num_threads);
     void deactivate();
@@ -42,16 +45,53 @@ public:
     void update_finished();
 
 private:
-    void WorkerThread();
+    // Plain value stored inline in the worker queues, so scheduling a map never touches the allocator once the queues have warmed up
+    struct UpdateRequest
+    {
+        enum Type : uint8
+        {
+            MAP_UPDATE,
+            LFG_UPDATE,
+            REGION_UPDATE   // diff holds the index of the grid region, see Map::UpdateRegion
+        };
 
-    ProducerConsumerQueue<UpdateRequest*> _queue;
+        Type type;
+        Map* map;
+        uint32 diff;
+        uint32 s_diff;
+        uint32 cost;    // expected cost in microseconds, higher runs first
+
+        bool operator<(UpdateRequest const& other) const { return cost < other.cost; }
+    };
+
+    // Per worker queue, kept sorted by ascending cost so the most expensive request is always at the back
+    struct WorkerQueue
+    {
+        std::mutex lock;
+        std::vector<UpdateRequest> requests;
+    };
+
+    void WorkerThread(size_t index);
+    void Push(size_t index, UpdateRequest const& request);
+    bool Pop(size_t index, UpdateRequest& request);
+    bool PopRegion(Map const* map, UpdateRequest& request);
+    void Dispatch();
+    void Execute(UpdateRequest const& request);
+
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
+    std::vector<UpdateRequest> _scheduled;          // requests scheduled by the world thread, dispatched by cost in wait()
 
     std::vector<std::thread> _workerThreads;
     std::atomic<bool> _cancelationToken;
 
+    std::atomic<size_t> _queuedRequests;            // requests sitting in worker queues
+    std::atomic<size_t> _idleWorkers;
+    std::mutex _idleLock;
+    std::condition_variable _idleCondition;
+
+    std::atomic<size_t> _pendingRequests;           // requests not finished yet, including running ones
     std::mutex _lock;
     std::condition_variable _condition;
-    size_t pending_requests;
 };
 
 #endif //_MAP_UPDATER_H_INCLUDED
@@ -39,7 +39,6 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
     {
         MMAP::MMapMgr* mmap = MMAP::MMapFactory::createOrGetMMapMgr();
         _navMesh = mmap->GetNavMesh(mapId);
-        _navMeshQuery = mmap->GetNavMeshQuery(mapId, _source->GetInstanceId());
     }
 
     CreateFilter();
@@ -72,6 +71,9 @@ bool PathGenerator::CalculatePath(float x, float y, float z, float destX, float
 
     _forceDestination = forceDest;
 
+    // queries are bound to the calling thread, the owner may be updated by a different one next time
+    _navMeshQuery = _navMesh ? MMAP::MMapFactory::createOrGetMMapMgr()->GetNavMeshQuery(_source->GetMapId()) : nullptr;
+
     // make sure navMesh works - we can run on map w/o mmap
     // check if the start and end point have a .mmtile loaded (can we pass via not loaded tile on the way?)
     Unit const* _sourceUnit = _source->ToUnit();
@@ -476,15 +478,24 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         }
         else
         {
-            dtResult = _navMeshQuery->findPath(
-                startPoly,          // start polygon
-                endPoly,            // end polygon
-                startPoint,         // start position
-                endPoint,           // end position
-                &_filter,           // polygon search filter
-                _pathPolyRefs,     // [out] path
-                (int*)&_polyLength,
-                MAX_PATH_LENGTH);   // max number of polygons in output path
+            MMAP::MMapMgr* mmap = MMAP::MMapFactory::createOrGetMMapMgr();
+            if (mmap->GetCachedPath(_source->GetMapId(), _source->GetInstanceId(), startPoint, endPoint, _filter, startPoly, endPoly, _pathPolyRefs, &_polyLength, MAX_PATH_LENGTH))
+                dtResult = DT_SUCCESS;
+            else
+            {
+                dtResult = _navMeshQuery->findPath(
+                    startPoly,          // start polygon
+                    endPoly,            // end polygon
+                    startPoint,         // start position
+                    endPoint,           // end position
+                    &_filter,           // polygon search filter
+                    _pathPolyRefs,     // [out] path
+                    (int*)&_polyLength,
+                    MAX_PATH_LENGTH);   // max number of polygons in output path
+
+                if (_polyLength && dtStatusSucceed(dtResult))
+                    mmap->CachePath(_source->GetMapId(), _source->GetInstanceId(), startPoint, endPoint, _filter, startPoly, endPoly, _pathPolyRefs, _polyLength);
+            }
         }
 
         if (!_polyLength || dtStatusFailed(dtResult))
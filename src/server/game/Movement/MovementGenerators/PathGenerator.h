@@ -149,7 +149,7 @@ class PathGenerator
 
         WorldObject const* const _source;       // the object that is moving
         dtNavMesh const* _navMesh;              // the nav mesh
-        dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
+        dtNavMeshQuery const* _navMeshQuery;    // the calling thread's nav mesh query, refreshed by every CalculatePath
 
         dtQueryFilterExt _filter;  // use single filter for all movements, update it when needed
 
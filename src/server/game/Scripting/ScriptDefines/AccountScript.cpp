@@ -83,6 +83,22 @@ void ScriptMgr::OnFailedPasswordChange(uint32 accountId)
     });
 }
 
+void ScriptMgr::OnCharacterListRequest(uint32 accountId)
+{
+    ExecuteScript<AccountScript>([&](AccountScript* script)
+    {
+        script->OnCharacterListRequest(accountId);
+    });
+}
+
+void ScriptMgr::OnBeforeCharacterLogin(uint32 accountId)
+{
+    ExecuteScript<AccountScript>([&](AccountScript* script)
+    {
+        script->OnBeforeCharacterLogin(accountId);
+    });
+}
+
 bool ScriptMgr::CanAccountCreateCharacter(uint32 accountId, uint8 charRace, uint8 charClass)
 {
     auto ret = IsValidBoolScript<AccountScript>([&](AccountScript* script)
@@ -47,6 +47,12 @@ public:
     // Called when Password failed to change for Account
     virtual void OnFailedPasswordChange(uint32 /*accountId*/) { }
 
+    // Called on the world thread when the account requests its character list
+    virtual void OnCharacterListRequest(uint32 /*accountId*/) { }
+
+    // Called on the world thread before a character of the account is loaded from the DB to enter the world
+    virtual void OnBeforeCharacterLogin(uint32 /*accountId*/) { }
+
     // Called when creating a character on the Account
     [[nodiscard]] virtual bool CanAccountCreateCharacter(uint32 /*accountId*/, uint8 /*charRace*/, uint8 /*charClass*/) { return true;}
 };
@@ -198,7 +198,7 @@ void ScriptMgr::OnPlayerEnterMap(Map* map, Player* player)
         script->OnPlayerEnterAll(map, player);
     });
 
-    ExecuteScript<PlayerScript>([=](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_MAP_CHANGED, [=](PlayerScript* script)
     {
         script->OnMapChanged(player);
     });
@@ -21,7 +21,7 @@
 
 void ScriptMgr::OnNetworkStart()
 {
-    ExecuteScript<ServerScript>([&](ServerScript* script)
+    ExecuteScript<ServerScript>(SERVERHOOK_ON_NETWORK_START, [&](ServerScript* script)
     {
         script->OnNetworkStart();
     });
@@ -29,7 +29,7 @@ void ScriptMgr::OnNetworkStart()
 
 void ScriptMgr::OnNetworkStop()
 {
-    ExecuteScript<ServerScript>([&](ServerScript* script)
+    ExecuteScript<ServerScript>(SERVERHOOK_ON_NETWORK_STOP, [&](ServerScript* script)
     {
         script->OnNetworkStop();
     });
@@ -39,7 +39,7 @@ void ScriptMgr::OnSocketOpen(std::shared_ptr<WorldSocket> socket)
 {
     ASSERT(socket);
 
-    ExecuteScript<ServerScript>([&](ServerScript* script)
+    ExecuteScript<ServerScript>(SERVERHOOK_ON_SOCKET_OPEN, [&](ServerScript* script)
     {
         script->OnSocketOpen(socket);
     });
@@ -49,7 +49,7 @@ void ScriptMgr::OnSocketClose(std::shared_ptr<WorldSocket> socket)
 {
     ASSERT(socket);
 
-    ExecuteScript<ServerScript>([&](ServerScript* script)
+    ExecuteScript<ServerScript>(SERVERHOOK_ON_SOCKET_CLOSE, [&](ServerScript* script)
     {
         script->OnSocketClose(socket);
     });
@@ -57,12 +57,13 @@ void ScriptMgr::OnSocketClose(std::shared_ptr<WorldSocket> socket)
 
 bool ScriptMgr::CanPacketReceive(WorldSession* session, WorldPacket const& packet)
 {
-    if (ScriptRegistry<ServerScript>::ScriptPointerList.empty())
+    // the copy is made for every packet, skip it when no script looks at them
+    if (ScriptRegistry<ServerScript>::EnabledHooks[SERVERHOOK_CAN_PACKET_RECEIVE].empty())
         return true;
 
     WorldPacket copy(packet);
 
-    auto ret = IsValidBoolScript<ServerScript>([&](ServerScript* script)
+    auto ret = IsValidBoolScript<ServerScript>(SERVERHOOK_CAN_PACKET_RECEIVE, [&](ServerScript* script)
     {
         return !script->CanPacketReceive(session, copy);
     });
@@ -79,12 +80,13 @@ bool ScriptMgr::CanPacketSend(WorldSession* session, WorldPacket const& packet)
 {
     ASSERT(session);
 
-    if (ScriptRegistry<ServerScript>::ScriptPointerList.empty())
+    // the copy is made for every packet, skip it when no script looks at them
+    if (ScriptRegistry<ServerScript>::EnabledHooks[SERVERHOOK_CAN_PACKET_SEND].empty())
         return true;
 
     WorldPacket copy(packet);
 
-    auto ret = IsValidBoolScript<ServerScript>([&](ServerScript* script)
+    auto ret = IsValidBoolScript<ServerScript>(SERVERHOOK_CAN_PACKET_SEND, [&](ServerScript* script)
     {
         return !script->CanPacketSend(session, copy);
     });
@@ -97,10 +99,15 @@ bool ScriptMgr::CanPacketSend(WorldSession* session, WorldPacket const& packet)
     return true;
 }
 
-ServerScript::ServerScript(const char* name)
-    : ScriptObject(name)
+ServerScript::ServerScript(const char* name, std::vector<uint16> enabledHooks)
+    : ScriptObject(name, SERVERHOOK_END)
 {
-    ScriptRegistry<ServerScript>::AddScript(this);
+    // If empty - enable all available hooks.
+    if (enabledHooks.empty())
+        for (uint16 i = 0; i < SERVERHOOK_END; ++i)
+            enabledHooks.emplace_back(i);
+
+    ScriptRegistry<ServerScript>::AddScript(this, enabledHooks);
 }
 
 template class AC_GAME_API ScriptRegistry<ServerScript>;
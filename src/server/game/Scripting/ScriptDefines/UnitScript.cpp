@@ -21,12 +21,12 @@
 
 uint32 ScriptMgr::DealDamage(Unit* AttackerUnit, Unit* pVictim, uint32 damage, DamageEffectType damagetype)
 {
-    if (ScriptRegistry<UnitScript>::ScriptPointerList.empty())
+    if (ScriptRegistry<UnitScript>::EnabledHooks[UNITHOOK_DEAL_DAMAGE].empty())
     {
         return damage;
     }
 
-    for (auto const& [scriptID, script] : ScriptRegistry<UnitScript>::ScriptPointerList)
+    for (UnitScript* script : ScriptRegistry<UnitScript>::EnabledHooks[UNITHOOK_DEAL_DAMAGE])
     {
         auto const& dmg = script->DealDamage(AttackerUnit, pVictim, damage, damagetype);
         if (dmg != damage)
@@ -40,7 +40,7 @@ uint32 ScriptMgr::DealDamage(Unit* AttackerUnit, Unit* pVictim, uint32 damage, D
 
 void ScriptMgr::OnHeal(Unit* healer, Unit* reciever, uint32& gain)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_ON_HEAL, [&](UnitScript* script)
     {
         script->OnHeal(healer, reciever, gain);
     });
@@ -48,7 +48,7 @@ void ScriptMgr::OnHeal(Unit* healer, Unit* reciever, uint32& gain)
 
 void ScriptMgr::OnDamage(Unit* attacker, Unit* victim, uint32& damage)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_ON_DAMAGE, [&](UnitScript* script)
     {
         script->OnDamage(attacker, victim, damage);
     });
@@ -56,7 +56,7 @@ void ScriptMgr::OnDamage(Unit* attacker, Unit* victim, uint32& damage)
 
 void ScriptMgr::ModifyPeriodicDamageAurasTick(Unit* target, Unit* attacker, uint32& damage, SpellInfo const* spellInfo)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_MODIFY_PERIODIC_DAMAGE_AURAS_TICK, [&](UnitScript* script)
     {
         script->ModifyPeriodicDamageAurasTick(target, attacker, damage, spellInfo);
     });
@@ -64,7 +64,7 @@ void ScriptMgr::ModifyPeriodicDamageAurasTick(Unit* target, Unit* attacker, uint
 
 void ScriptMgr::ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_MODIFY_MELEE_DAMAGE, [&](UnitScript* script)
     {
         script->ModifyMeleeDamage(target, attacker, damage);
     });
@@ -72,7 +72,7 @@ void ScriptMgr::ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage)
 
 void ScriptMgr::ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& damage, SpellInfo const* spellInfo)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_MODIFY_SPELL_DAMAGE_TAKEN, [&](UnitScript* script)
     {
         script->ModifySpellDamageTaken(target, attacker, damage, spellInfo);
     });
@@ -80,7 +80,7 @@ void ScriptMgr::ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& dama
 
 void ScriptMgr::ModifyHealReceived(Unit* target, Unit* healer, uint32& heal, SpellInfo const* spellInfo)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_MODIFY_HEAL_RECEIVED, [&](UnitScript* script)
     {
         script->ModifyHealReceived(target, healer, heal, spellInfo);
     });
@@ -88,7 +88,7 @@ void ScriptMgr::ModifyHealReceived(Unit* target, Unit* healer, uint32& heal, Spe
 
 void ScriptMgr::OnBeforeRollMeleeOutcomeAgainst(Unit const* attacker, Unit const* victim, WeaponAttackType attType, int32& attackerMaxSkillValueForLevel, int32& victimMaxSkillValueForLevel, int32& attackerWeaponSkill, int32& victimDefenseSkill, int32& crit_chance, int32& miss_chance, int32& dodge_chance, int32& parry_chance, int32& block_chance)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_ON_BEFORE_ROLL_MELEE_OUTCOME_AGAINST, [&](UnitScript* script)
     {
         script->OnBeforeRollMeleeOutcomeAgainst(attacker, victim, attType, attackerMaxSkillValueForLevel, victimMaxSkillValueForLevel, attackerWeaponSkill, victimDefenseSkill, crit_chance, miss_chance, dodge_chance, parry_chance, block_chance);
     });
@@ -96,7 +96,7 @@ void ScriptMgr::OnBeforeRollMeleeOutcomeAgainst(Unit const* attacker, Unit const
 
 void ScriptMgr::OnAuraRemove(Unit* unit, AuraApplication* aurApp, AuraRemoveMode mode)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_ON_AURA_REMOVE, [&](UnitScript* script)
     {
         script->OnAuraRemove(unit, aurApp, mode);
     });
@@ -104,7 +104,7 @@ void ScriptMgr::OnAuraRemove(Unit* unit, AuraApplication* aurApp, AuraRemoveMode
 
 bool ScriptMgr::IfNormalReaction(Unit const* unit, Unit const* target, ReputationRank& repRank)
 {
-    auto ret = IsValidBoolScript<UnitScript>([&](UnitScript* script)
+    auto ret = IsValidBoolScript<UnitScript>(UNITHOOK_IF_NORMAL_REACTION, [&](UnitScript* script)
     {
         return !script->IfNormalReaction(unit, target, repRank);
     });
@@ -119,7 +119,7 @@ bool ScriptMgr::IfNormalReaction(Unit const* unit, Unit const* target, Reputatio
 
 bool ScriptMgr::IsNeedModSpellDamagePercent(Unit const* unit, AuraEffect* auraEff, float& doneTotalMod, SpellInfo const* spellProto)
 {
-    auto ret = IsValidBoolScript<UnitScript>([&](UnitScript* script)
+    auto ret = IsValidBoolScript<UnitScript>(UNITHOOK_IS_NEED_MOD_SPELL_DAMAGE_PERCENT, [&](UnitScript* script)
     {
         return !script->IsNeedModSpellDamagePercent(unit, auraEff, doneTotalMod, spellProto);
     });
@@ -134,7 +134,7 @@ bool ScriptMgr::IsNeedModSpellDamagePercent(Unit const* unit, AuraEffect* auraEf
 
 bool ScriptMgr::IsNeedModMeleeDamagePercent(Unit const* unit, AuraEffect* auraEff, float& doneTotalMod, SpellInfo const* spellProto)
 {
-    auto ret = IsValidBoolScript<UnitScript>([&](UnitScript* script)
+    auto ret = IsValidBoolScript<UnitScript>(UNITHOOK_IS_NEED_MOD_MELEE_DAMAGE_PERCENT, [&](UnitScript* script)
     {
         return !script->IsNeedModMeleeDamagePercent(unit, auraEff, doneTotalMod, spellProto);
     });
@@ -149,7 +149,7 @@ bool ScriptMgr::IsNeedModMeleeDamagePercent(Unit const* unit, AuraEffect* auraEf
 
 bool ScriptMgr::IsNeedModHealPercent(Unit const* unit, AuraEffect* auraEff, float& doneTotalMod, SpellInfo const* spellProto)
 {
-    auto ret = IsValidBoolScript<UnitScript>([&](UnitScript* script)
+    auto ret = IsValidBoolScript<UnitScript>(UNITHOOK_IS_NEED_MOD_HEAL_PERCENT, [&](UnitScript* script)
     {
         return !script->IsNeedModHealPercent(unit, auraEff, doneTotalMod, spellProto);
     });
@@ -164,7 +164,7 @@ bool ScriptMgr::IsNeedModHealPercent(Unit const* unit, AuraEffect* auraEff, floa
 
 bool ScriptMgr::CanSetPhaseMask(Unit const* unit, uint32 newPhaseMask, bool update)
 {
-    auto ret = IsValidBoolScript<UnitScript>([&](UnitScript* script)
+    auto ret = IsValidBoolScript<UnitScript>(UNITHOOK_CAN_SET_PHASE_MASK, [&](UnitScript* script)
     {
         return !script->CanSetPhaseMask(unit, newPhaseMask, update);
     });
@@ -179,7 +179,7 @@ bool ScriptMgr::CanSetPhaseMask(Unit const* unit, uint32 newPhaseMask, bool upda
 
 bool ScriptMgr::IsCustomBuildValuesUpdate(Unit const* unit, uint8 updateType, ByteBuffer& fieldBuffer, Player const* target, uint16 index)
 {
-    auto ret = IsValidBoolScript<UnitScript>([&](UnitScript* script)
+    auto ret = IsValidBoolScript<UnitScript>(UNITHOOK_IS_CUSTOM_BUILD_VALUES_UPDATE, [&](UnitScript* script)
     {
         return script->IsCustomBuildValuesUpdate(unit, updateType, fieldBuffer, target, index);
     });
@@ -194,7 +194,7 @@ bool ScriptMgr::IsCustomBuildValuesUpdate(Unit const* unit, uint8 updateType, By
 
 bool ScriptMgr::OnBuildValuesUpdate(Unit const* unit, uint8 updateType, ByteBuffer& fieldBuffer, Player* target, uint16 index)
 {
-    auto ret = IsValidBoolScript<UnitScript>([&](UnitScript* script) { return script->OnBuildValuesUpdate(unit, updateType, fieldBuffer, target, index); });
+    auto ret = IsValidBoolScript<UnitScript>(UNITHOOK_ON_BUILD_VALUES_UPDATE, [&](UnitScript* script) { return script->OnBuildValuesUpdate(unit, updateType, fieldBuffer, target, index); });
 
     if (ret && *ret)
     {
@@ -206,7 +206,7 @@ bool ScriptMgr::OnBuildValuesUpdate(Unit const* unit, uint8 updateType, ByteBuff
 
 void ScriptMgr::OnUnitUpdate(Unit* unit, uint32 diff)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_ON_UNIT_UPDATE, [&](UnitScript* script)
     {
         script->OnUnitUpdate(unit, diff);
     });
@@ -214,7 +214,7 @@ void ScriptMgr::OnUnitUpdate(Unit* unit, uint32 diff)
 
 void ScriptMgr::OnDisplayIdChange(Unit* unit, uint32 displayId)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_ON_DISPLAY_ID_CHANGE, [&](UnitScript* script)
     {
         script->OnDisplayIdChange(unit, displayId);
     });
@@ -222,7 +222,7 @@ void ScriptMgr::OnDisplayIdChange(Unit* unit, uint32 displayId)
 
 void ScriptMgr::OnUnitEnterEvadeMode(Unit* unit, uint8 evadeReason)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_ON_UNIT_ENTER_EVADE_MODE, [&](UnitScript* script)
     {
         script->OnUnitEnterEvadeMode(unit, evadeReason);
     });
@@ -230,7 +230,7 @@ void ScriptMgr::OnUnitEnterEvadeMode(Unit* unit, uint8 evadeReason)
 
 void ScriptMgr::OnUnitEnterCombat(Unit* unit, Unit* victim)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_ON_UNIT_ENTER_COMBAT, [&](UnitScript* script)
     {
         script->OnUnitEnterCombat(unit, victim);
     });
@@ -238,7 +238,7 @@ void ScriptMgr::OnUnitEnterCombat(Unit* unit, Unit* victim)
 
 void ScriptMgr::OnUnitDeath(Unit* unit, Unit* killer)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_ON_UNIT_DEATH, [&](UnitScript* script)
     {
         script->OnUnitDeath(unit, killer);
     });
@@ -246,17 +246,22 @@ void ScriptMgr::OnUnitDeath(Unit* unit, Unit* killer)
 
 void ScriptMgr::OnAuraApply(Unit* unit, Aura* aura)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteScript<UnitScript>(UNITHOOK_ON_AURA_APPLY, [&](UnitScript* script)
     {
         script->OnAuraApply(unit, aura);
     });
 }
 
-UnitScript::UnitScript(const char* name, bool addToScripts) :
-    ScriptObject(name)
+UnitScript::UnitScript(const char* name, bool addToScripts, std::vector<uint16> enabledHooks) :
+    ScriptObject(name, UNITHOOK_END)
 {
+    // If empty - enable all available hooks.
+    if (enabledHooks.empty())
+        for (uint16 i = 0; i < UNITHOOK_END; ++i)
+            enabledHooks.emplace_back(i);
+
     if (addToScripts)
-        ScriptRegistry<UnitScript>::AddScript(this);
+        ScriptRegistry<UnitScript>::AddScript(this, enabledHooks);
 }
 
 template class AC_GAME_API ScriptRegistry<UnitScript>;
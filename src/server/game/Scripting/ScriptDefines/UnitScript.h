@@ -19,14 +19,46 @@
 #define SCRIPT_OBJECT_UNIT_SCRIPT_H_
 
 #include "ScriptObject.h"
+#include <vector>
 
 enum ReputationRank : uint8;
 class ByteBuffer;
 
+enum UnitHook
+{
+    UNITHOOK_ON_HEAL,
+    UNITHOOK_ON_DAMAGE,
+    UNITHOOK_MODIFY_PERIODIC_DAMAGE_AURAS_TICK,
+    UNITHOOK_MODIFY_MELEE_DAMAGE,
+    UNITHOOK_MODIFY_SPELL_DAMAGE_TAKEN,
+    UNITHOOK_MODIFY_HEAL_RECEIVED,
+    UNITHOOK_DEAL_DAMAGE,
+    UNITHOOK_ON_BEFORE_ROLL_MELEE_OUTCOME_AGAINST,
+    UNITHOOK_ON_AURA_APPLY,
+    UNITHOOK_ON_AURA_REMOVE,
+    UNITHOOK_IF_NORMAL_REACTION,
+    UNITHOOK_IS_NEED_MOD_SPELL_DAMAGE_PERCENT,
+    UNITHOOK_IS_NEED_MOD_MELEE_DAMAGE_PERCENT,
+    UNITHOOK_IS_NEED_MOD_HEAL_PERCENT,
+    UNITHOOK_CAN_SET_PHASE_MASK,
+    UNITHOOK_IS_CUSTOM_BUILD_VALUES_UPDATE,
+    UNITHOOK_ON_BUILD_VALUES_UPDATE,
+    UNITHOOK_ON_UNIT_UPDATE,
+    UNITHOOK_ON_DISPLAY_ID_CHANGE,
+    UNITHOOK_ON_UNIT_ENTER_EVADE_MODE,
+    UNITHOOK_ON_UNIT_ENTER_COMBAT,
+    UNITHOOK_ON_UNIT_DEATH,
+    UNITHOOK_END
+};
+
 class UnitScript : public ScriptObject
 {
 protected:
-    UnitScript(const char* name, bool addToScripts = true);
+    /**
+     * @param enabledHooks Hooks (UnitHook) the script overrides, only those get dispatched to it.
+     *                     Leave empty to subscribe to every hook.
+     */
+    UnitScript(const char* name, bool addToScripts = true, std::vector<uint16> enabledHooks = std::vector<uint16>());
 
 public:
     // Called when a unit deals healing to another unit
@@ -36,6 +36,10 @@ namespace
         }
 
         ScriptRegistry<T>::ScriptPointerList.clear();
+
+        // keep the per hook lists sized, dispatch indexes them without bounds checks
+        for (auto& hookScripts : ScriptRegistry<T>::EnabledHooks)
+            hookScripts.clear();
     }
 }
 
@@ -64,6 +68,11 @@ void ScriptMgr::Initialize()
     LOG_INFO("server.loading", "> Loading C++ scripts");
     LOG_INFO("server.loading", " ");
 
+    // hook dispatch indexes these lists directly, size them even if no script of the type gets registered
+    ScriptRegistry<PlayerScript>::InitEnabledHooksIfNeeded(PLAYERHOOK_END);
+    ScriptRegistry<UnitScript>::InitEnabledHooksIfNeeded(UNITHOOK_END);
+    ScriptRegistry<ServerScript>::InitEnabledHooksIfNeeded(SERVERHOOK_END);
+
     AddSC_SmartScripts();
 
     // LFGScripts
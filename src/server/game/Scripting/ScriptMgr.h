@@ -475,6 +475,8 @@ public: /* AccountScript */
     void OnFailedEmailChange(uint32 accountId);
     void OnPasswordChange(uint32 accountId);
     void OnFailedPasswordChange(uint32 accountId);
+    void OnCharacterListRequest(uint32 accountId);
+    void OnBeforeCharacterLogin(uint32 accountId);
     bool CanAccountCreateCharacter(uint32 accountId, uint8 charRace, uint8 charClass);
 
 public: /* GuildScript */
@@ -729,8 +731,17 @@ public:
     static ScriptMap ScriptPointerList;
     // After database load scripts
     static ScriptVector ALScripts;
+    // Scripts subscribed to each hook, indexed by the hook enum of the script type.
+    // Only used by script types constructed with a hook count; like ScriptPointerList it must not change after startup.
+    static std::vector<ScriptVector> EnabledHooks;
 
-    static void AddScript(TScript* const script)
+    static void InitEnabledHooksIfNeeded(uint16 totalAvailableHooks)
+    {
+        if (EnabledHooks.size() < totalAvailableHooks)
+            EnabledHooks.resize(totalAvailableHooks);
+    }
+
+    static void AddScript(TScript* const script, std::vector<uint16> const& enabledHooks = {})
     {
         ASSERT(script);
 
@@ -748,6 +759,14 @@ public:
             // We're dealing with a code-only script; just add it.
             ScriptPointerList[_scriptIdCounter++] = script;
             sScriptMgr->IncreaseScriptCount();
+
+            InitEnabledHooksIfNeeded(script->GetTotalAvailableHooks());
+
+            for (uint16 hook : enabledHooks)
+            {
+                ASSERT(hook < EnabledHooks.size(), "Script '{}' enables unknown hook {}", script->GetName(), hook);
+                EnabledHooks[hook].push_back(script);
+            }
         }
     }
 
@@ -854,6 +873,7 @@ private:
 // Instantiate static members of ScriptRegistry.
 template<class TScript> std::map<uint32, TScript*> ScriptRegistry<TScript>::ScriptPointerList;
 template<class TScript> std::vector<TScript*> ScriptRegistry<TScript>::ALScripts;
+template<class TScript> std::vector<std::vector<TScript*>> ScriptRegistry<TScript>::EnabledHooks;
 template<class TScript> uint32 ScriptRegistry<TScript>::_scriptIdCounter = 0;
 
 #endif
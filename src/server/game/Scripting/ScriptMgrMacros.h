@@ -64,6 +64,39 @@ inline void ExecuteScript(std::function<void(ScriptName*)> executeHook)
     }
 }
 
+// Hook aware variants for script types that register per hook subscribers (ScriptRegistry::EnabledHooks).
+// Only scripts that enabled the hook are visited, and a hook nobody subscribed to costs a single empty check.
+template<typename ScriptName, typename Hook>
+inline Optional<bool> IsValidBoolScript(uint16 hookType, Hook&& executeHook)
+{
+    auto const& scripts = ScriptRegistry<ScriptName>::EnabledHooks[hookType];
+
+    if (scripts.empty())
+        return {};
+
+    for (ScriptName* script : scripts)
+    {
+        if (executeHook(script))
+            return true;
+    }
+
+    return false;
+}
+
+template<typename ScriptName, typename Hook>
+inline void ExecuteScript(uint16 hookType, Hook&& executeHook)
+{
+    auto const& scripts = ScriptRegistry<ScriptName>::EnabledHooks[hookType];
+
+    if (scripts.empty())
+        return;
+
+    for (ScriptName* script : scripts)
+    {
+        executeHook(script);
+    }
+}
+
 inline bool ReturnValidBool(Optional<bool> ret, bool need = false)
 {
     return ret && *ret ? need : !need;
@@ -53,8 +53,11 @@ public:
 
     [[nodiscard]] const std::string& GetName() const { return _name; }
 
+    // Number of hooks the script type dispatches through ScriptRegistry::EnabledHooks, 0 if it does not use them.
+    [[nodiscard]] uint16 GetTotalAvailableHooks() const { return _totalAvailableHooks; }
+
 protected:
-    ScriptObject(const char* name) : _name(std::string(name))
+    ScriptObject(const char* name, uint16 totalAvailableHooks = 0) : _name(std::string(name)), _totalAvailableHooks(totalAvailableHooks)
     {
     }
 
@@ -62,6 +65,7 @@ protected:
 
 private:
     const std::string _name;
+    const uint16 _totalAvailableHooks;
 };
 
 template<class TObject>
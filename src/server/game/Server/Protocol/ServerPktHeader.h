@@ -43,9 +43,14 @@ struct ServerPktHeader
     }
 
     uint8 getHeaderLength()
+    {
+        return getHeaderLength(size);
+    }
+
+    static uint8 getHeaderLength(uint32 size)
     {
         // cmd = 2 bytes, size= 2||3bytes
-        return 2 + (isLargePacket() ? 3 : 2);
+        return 2 + (size > 0x7FFF ? 3 : 2);
     }
 
     bool isLargePacket() const
@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "Duration.h"
 #include "Opcodes.h"
+#include <memory>
 
 class WorldPacket : public ByteBuffer
 {
@@ -83,4 +84,7 @@ protected:
     TimePoint m_receivedTime; // only set for a specific set of opcodes, for performance reasons.
 };
 
+/// Serialized packet sent to several sessions, every socket encrypts its own header and references the same payload
+typedef std::shared_ptr<WorldPacket const> SharedWorldPacket;
+
 #endif
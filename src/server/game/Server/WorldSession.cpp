@@ -261,6 +261,20 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     m_Socket->SendPacket(*packet);
 }
 
+/// Send a packet shared with other sessions, the socket references it instead of copying it
+void WorldSession::SendPacket(SharedWorldPacket const& packet)
+{
+    if (!m_Socket)
+        return;
+
+    if (!sScriptMgr->CanPacketSend(this, *packet))
+    {
+        return;
+    }
+
+    m_Socket->SendPacket(packet);
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
@@ -35,7 +35,7 @@
 using boost::asio::ip::tcp;
 
 WorldSocket::WorldSocket(tcp::socket&& socket)
-    : Socket(std::move(socket)), _OverSpeedPings(0), _worldSession(nullptr), _authed(false), _sendBufferSize(4096)
+    : Socket(std::move(socket)), _OverSpeedPings(0), _worldSession(nullptr), _authed(false)
 {
     Acore::Crypto::GetRandomBytes(_authSeed);
     _headerBuffer.Resize(sizeof(ClientPktHeader));
@@ -81,48 +81,67 @@ void WorldSocket::CheckIpCallback(PreparedQueryResult result)
 
 bool WorldSocket::Update()
 {
-    EncryptablePacket* queued;
-    MessageBuffer buffer(_sendBufferSize);
-    while (_bufferQueue.Dequeue(queued))
+    // buffers of the previous write are referenced by the write queue until it drains
+    if (IsWriteQueueEmpty())
+        WritePendingPackets();
+
+    if (!BaseSocket::Update())
+        return false;
+
+    _queryProcessor.ProcessReadyCallbacks();
+
+    return true;
+}
+
+void WorldSocket::WritePendingPackets()
+{
+    _sendingPackets.clear();
+    _sendingPayload.clear();
+
     {
-        ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
-        if (queued->NeedsEncryption())
+        std::lock_guard<std::mutex> guard(_sendLock);
+        _sendingPackets.swap(_pendingPackets);
+        _sendingPayload.swap(_pendingPayload);
+    }
+
+    if (_sendingPackets.empty())
+        return;
+
+    std::size_t sharedCount = 0;
+    for (PendingPacket const& packet : _sendingPackets)
+        if (packet.Shared)
+            ++sharedCount;
+
+    // sized up front, queued headers must not move
+    _sendingHeaders.resize(sharedCount * sizeof(ServerPktHeader::header));
+
+    std::size_t blockStart = 0;
+    uint8* sharedHeader = _sendingHeaders.data();
+
+    for (PendingPacket const& packet : _sendingPackets)
+    {
+        ServerPktHeader header(packet.Size + 2, packet.Opcode);
+        if (packet.Encrypt)
             _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-        if (buffer.GetRemainingSpace() < queued->size() + header.getHeaderLength())
+        if (!packet.Shared)
         {
-            QueuePacket(std::move(buffer));
-            buffer.Resize(_sendBufferSize);
+            std::memcpy(&_sendingPayload[packet.Offset], header.header, header.getHeaderLength());
+            continue;
         }
 
-        if (buffer.GetRemainingSpace() >= queued->size() + header.getHeaderLength())
-        {
-            buffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                buffer.Write(queued->contents(), queued->size());
-        }
-        else    // single packet larger than 4096 bytes
-        {
-            MessageBuffer packetBuffer(queued->size() + header.getHeaderLength());
-            packetBuffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                packetBuffer.Write(queued->contents(), queued->size());
+        QueueBuffer(_sendingPayload.data() + blockStart, packet.Offset - blockStart);
+        blockStart = packet.Offset;
 
-            QueuePacket(std::move(packetBuffer));
-        }
+        std::memcpy(sharedHeader, header.header, header.getHeaderLength());
+        QueueBuffer(sharedHeader, header.getHeaderLength());
+        sharedHeader += header.getHeaderLength();
 
-        delete queued;
+        if (!packet.Shared->empty())
+            QueueBuffer(packet.Shared->contents(), packet.Shared->size());
     }
 
-    if (buffer.GetActiveSize() > 0)
-        QueuePacket(std::move(buffer));
-
-    if (!BaseSocket::Update())
-        return false;
-
-    _queryProcessor.ProcessReadyCallbacks();
-
-    return true;
+    QueueBuffer(_sendingPayload.data() + blockStart, _sendingPayload.size() - blockStart);
 }
 
 void WorldSocket::HandleSendAuthSession()
@@ -427,7 +446,28 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     if (sPacketLog->CanLogPacket())
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
-    _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
+    uint8 const headerLength = ServerPktHeader::getHeaderLength(packet.size() + 2);
+
+    std::lock_guard<std::mutex> guard(_sendLock);
+
+    std::size_t const offset = _pendingPayload.size();
+    _pendingPayload.resize(offset + headerLength);
+    if (!packet.empty())
+        _pendingPayload.insert(_pendingPayload.end(), packet.contents(), packet.contents() + packet.size());
+
+    _pendingPackets.push_back({ nullptr, offset, uint32(packet.size()), packet.GetOpcode(), _authCrypt.IsInitialized() });
+}
+
+void WorldSocket::SendPacket(SharedWorldPacket const& packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    std::lock_guard<std::mutex> guard(_sendLock);
+    _pendingPackets.push_back({ packet, _pendingPayload.size(), uint32(packet->size()), packet->GetOpcode(), _authCrypt.IsInitialized() });
 }
 
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
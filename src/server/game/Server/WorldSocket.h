@@ -20,7 +20,6 @@
 
 #include "AuthCrypt.h"
 #include "Common.h"
-#include "MPSCQueue.h"
 #include "ServerPktHeader.h"
 #include "Socket.h"
 #include "Util.h"
@@ -30,22 +29,6 @@
 
 using boost::asio::ip::tcp;
 
-class EncryptablePacket : public WorldPacket
-{
-public:
-    EncryptablePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
-    {
-        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
-    }
-
-    bool NeedsEncryption() const { return _encrypt; }
-
-    std::atomic<EncryptablePacket*> SocketQueueLink;
-
-private:
-    bool _encrypt;
-};
-
 namespace WorldPackets
 {
     class ServerPacket;
@@ -79,8 +62,11 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    /// Sends a packet other sockets may send too, its payload is referenced until written instead of copied
+    void SendPacket(SharedWorldPacket const& packet);
 
-    void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
+    /// Only valid before the socket is started
+    void SetSendBufferSize(std::size_t sendBufferSize) { _pendingPayload.reserve(sendBufferSize); }
 
 protected:
     void OnClose() override;
@@ -99,6 +85,9 @@ protected:
 private:
     void CheckIpCallback(PreparedQueryResult result);
 
+    /// Encrypts the headers of everything sent since the last call and queues it for a single scatter-gather write
+    void WritePendingPackets();
+
     /// writes network.opcode log
     /// accessing WorldSession is not threadsafe, only do it when holding _worldSessionLock
     void LogOpcodeText(OpcodeClient opcode, std::unique_lock<std::mutex> const& guard) const;
@@ -125,8 +114,26 @@ private:
 
     MessageBuffer _headerBuffer;
     MessageBuffer _packetBuffer;
-    MPSCQueue<EncryptablePacket, &EncryptablePacket::SocketQueueLink> _bufferQueue;
-    std::size_t _sendBufferSize;
+
+    struct PendingPacket
+    {
+        SharedWorldPacket Shared;                  // null when the payload was copied into the payload stream
+        std::size_t Offset;                        // position of the header in the payload stream
+        uint32 Size;
+        uint16 Opcode;
+        bool Encrypt;
+    };
+
+    /// Packets sent from any thread since the last write, guarded by _sendLock.
+    /// Copied payloads are appended to the stream behind room for their header, so consecutive packets go out as one block.
+    std::mutex _sendLock;
+    std::vector<PendingPacket> _pendingPackets;
+    std::vector<uint8> _pendingPayload;
+
+    /// Packets of the write in flight, only touched by the network thread
+    std::vector<PendingPacket> _sendingPackets;
+    std::vector<uint8> _sendingPayload;
+    std::vector<uint8> _sendingHeaders; // headers of shared packets, their payload has no room in front of it
 
     QueryCallbackProcessor _queryProcessor;
     std::string _ipCountry;
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_AURAMODIFIERTOTALS_H
+#define ACORE_AURAMODIFIERTOTALS_H
+
+#include "Define.h"
+#include "SpellAuraDefines.h"
+#include "Util.h"
+#include <algorithm>
+#include <vector>
+
+// Sum, multiplier and extremes of the amounts of every registered effect of one aura type
+struct AuraModifierTotals
+{
+    int32 Total = 0;
+    float Multiplier = 1.0f;
+    int32 MaxPositive = 0;
+    int32 MaxNegative = 0;
+
+    // EffectList holds pointers to objects with GetAmount(), such as Unit::AuraEffectList
+    template<class EffectList>
+    static AuraModifierTotals Compute(EffectList const& effects)
+    {
+        AuraModifierTotals totals;
+        for (auto const* effect : effects)
+        {
+            int32 amount = effect->GetAmount();
+            totals.Total += amount;
+            AddPct(totals.Multiplier, amount);
+            totals.MaxPositive = std::max(totals.MaxPositive, amount);
+            totals.MaxNegative = std::min(totals.MaxNegative, amount);
+        }
+
+        return totals;
+    }
+};
+
+/**
+ * Totals of the aura types queried since they last changed, see Unit::GetAuraModifierTotals.
+ *
+ * The owner must call Invalidate() whenever an effect of the type is registered, unregistered,
+ * changes its amount or is enabled / disabled. Not thread safe, the unit only uses it from the
+ * thread updating it. Other grid regions invalidate it while the map's regions are parked.
+ */
+class AuraModifierTotalsCache
+{
+public:
+    template<class EffectList>
+    AuraModifierTotals const& Get(AuraType auraType, EffectList const& effects)
+    {
+        for (Entry const& entry : _entries)
+            if (entry.Type == auraType)
+                return entry.Totals;
+
+        return _entries.emplace_back(Entry{ auraType, AuraModifierTotals::Compute(effects) }).Totals;
+    }
+
+    void Invalidate(AuraType auraType)
+    {
+        for (auto itr = _entries.begin(); itr != _entries.end(); ++itr)
+        {
+            if (itr->Type == auraType)
+            {
+                *itr = _entries.back();
+                _entries.pop_back();
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const { return _entries.size(); }
+
+private:
+    struct Entry
+    {
+        AuraType Type;
+        AuraModifierTotals Totals;
+    };
+
+    std::vector<Entry> _entries;
+};
+
+#endif
@@ -62,7 +62,7 @@ public:
     AuraType GetAuraType() const;
     int32 GetAmount() const { return m_isAuraEnabled ? m_amount : 0; }
     int32 GetForcedAmount() const { return m_amount; }
-    void SetAmount(int32 amount) { m_amount = amount; m_canBeRecalculated = false;}
+    void SetAmount(int32 amount);
     int64 GetStoredValue(int32 key) const { return m_storeValues.at(key); }
     void SetStoredValue(int32 key, int64 amount) { m_storeValues.insert_or_assign(key, amount); }
     uint32 GetTriggerSpell() const;
@@ -119,7 +119,7 @@ public:
     uint32 GetAuraGroup() const { return m_auraGroup; }
     int32 GetOldAmount() const { return m_oldAmount; }
     void SetOldAmount(int32 amount) { m_oldAmount = amount; }
-    void SetEnabled(bool enabled) { m_isAuraEnabled = enabled; }
+    void SetEnabled(bool enabled);
 
     float m_dmgRatio = 1;
     float m_tickCount = 0;
@@ -156,6 +156,7 @@ private:
     std::unordered_map<int32, int64> m_storeValues;
 private:
     float CalcPeriodicCritChance(Unit const* caster, Unit const* target) const;
+    void InvalidateTargetModifierTotals() const;
 
 public:
     // aura effect apply/remove handlers
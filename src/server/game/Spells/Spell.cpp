@@ -1224,9 +1224,15 @@ void Spell::SelectImplicitConeTargets(SpellEffIndex effIndex, SpellImplicitTarge
 
     if (uint32 containerTypeMask = GetSearcherTypeMask(objectType, condList))
     {
+        Acore::ScopedWorldObjectCandidates candidates;
+        Acore::WorldObjectCandidateCollector collector(*candidates, containerTypeMask);
+        SearchTargets<Acore::WorldObjectCandidateCollector>(collector, containerTypeMask, m_caster, m_caster, radius);
+        candidates->FilterInRange(*m_caster, radius);
+
         Acore::WorldObjectSpellConeTargetCheck check(coneAngle, radius, m_caster, m_spellInfo, selectionType, condList);
-        Acore::WorldObjectListSearcher<Acore::WorldObjectSpellConeTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
-        SearchTargets<Acore::WorldObjectListSearcher<Acore::WorldObjectSpellConeTargetCheck> >(searcher, containerTypeMask, m_caster, m_caster, radius);
+        for (WorldObject* target : *candidates)
+            if (check(target))
+                targets.push_back(target);
 
         CallScriptObjectAreaTargetSelectHandlers(targets, effIndex, targetType);
 
@@ -2188,9 +2194,16 @@ void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Pos
     uint32 containerTypeMask = GetSearcherTypeMask(objectType, condList);
     if (!containerTypeMask)
         return;
+    // collect first and prefilter by distance, the full checks then only run for objects in range
+    Acore::ScopedWorldObjectCandidates candidates;
+    Acore::WorldObjectCandidateCollector collector(*candidates, containerTypeMask);
+    SearchTargets<Acore::WorldObjectCandidateCollector>(collector, containerTypeMask, m_caster, position, range);
+    candidates->FilterInRange(*position, range);
+
     Acore::WorldObjectSpellAreaTargetCheck check(range, position, m_caster, referer, m_spellInfo, selectionType, condList);
-    Acore::WorldObjectListSearcher<Acore::WorldObjectSpellAreaTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
-    SearchTargets<Acore::WorldObjectListSearcher<Acore::WorldObjectSpellAreaTargetCheck> > (searcher, containerTypeMask, m_caster, position, range);
+    for (WorldObject* target : *candidates)
+        if (check(target))
+            targets.push_back(target);
 }
 
 void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, SpellTargetSelectionCategories  /*selectCategory*/, ConditionList* condList, bool isChainHeal)
@@ -352,7 +352,7 @@ bool IsDiminishingReturnsGroupDurationLimited(DiminishingGroup group)
     }
 }
 
-SpellMgr::SpellMgr()
+SpellMgr::SpellMgr() : mSpellProcGeneration(0)
 {
 }
 
@@ -939,44 +939,53 @@ SpellAreaForAreaMapBounds SpellMgr::GetSpellAreaForAreaMapBounds(uint32 area_id)
     return mSpellAreaForAreaMap.equal_range(area_id);
 }
 
-std::vector<SpellInfo*> SpellMgr::GetSpellInfosForDummyId(uint32 dummyId, uint32 enchanceId) const
+void DummySpellIndex::Build(EntryList& entries)
 {
-    auto const valItt = mDummySpellMap.find(dummyId);
+    std::stable_sort(entries.begin(), entries.end(), [](EntryList::value_type const& a, EntryList::value_type const& b) { return a.first < b.first; });
 
-    if (valItt != mDummySpellMap.end())
-    {
-        auto const enchItt = valItt->second.find(enchanceId);
+    _keys.clear();
+    _spells.clear();
+    _keys.reserve(entries.size());
+    _spells.reserve(entries.size());
 
-        if (enchItt != valItt->second.end())
-            return enchItt->second;
+    for (auto const& [key, spellInfo] : entries)
+    {
+        _keys.push_back(key);
+        _spells.push_back(spellInfo);
     }
-
-    return std::vector<SpellInfo*>();
 }
 
-std::vector<SpellInfo*> SpellMgr::GetSpellInfosForDummyA(uint32 dummyId) const
+void DummySpellIndex::clear()
 {
-    auto const valItt = mDummySpellMapA.find(dummyId);
-
-    if (valItt != mDummySpellMapA.end())
-        return valItt->second;
+    _keys.clear();
+    _spells.clear();
+}
 
-    return std::vector<SpellInfo*>();
+DummySpellInfoRange DummySpellIndex::FindRange(uint64 first, uint64 last) const
+{
+    auto lower = std::lower_bound(_keys.begin(), _keys.end(), first);
+    auto upper = std::lower_bound(lower, _keys.end(), last);
+    return DummySpellInfoRange(_spells.data() + (lower - _keys.begin()), upper - lower);
 }
 
-std::vector<SpellInfo*> SpellMgr::GetSpellInfosForDummyB(uint32 enchanceId) const
+DummySpellInfoRange SpellMgr::GetSpellInfosForDummyId(uint32 dummyId, uint32 enchanceId) const
 {
-    auto const valItt = mDummySpellMapB.find(enchanceId);
+    return mDummySpellIndex.Find(MAKE_PAIR64(enchanceId, dummyId));
+}
 
-    if (valItt != mDummySpellMapB.end())
-        return valItt->second;
+DummySpellInfoRange SpellMgr::GetSpellInfosForDummyId(uint32 dummyId) const
+{
+    return mDummySpellIndex.FindRange(MAKE_PAIR64(0, dummyId), (uint64(dummyId) + 1) << 32);
+}
 
-    return std::vector<SpellInfo*>();
+DummySpellInfoRange SpellMgr::GetSpellInfosForDummyA(uint32 dummyId) const
+{
+    return mDummySpellIndexA.Find(dummyId);
 }
 
-DummySpellMap SpellMgr::GetDummyMap() const
+DummySpellInfoRange SpellMgr::GetSpellInfosForDummyB(uint32 enchanceId) const
 {
-    return mDummySpellMap;
+    return mDummySpellIndexB.Find(enchanceId);
 }
 
 bool SpellArea::IsFitToRequirements(Player const* player, uint32 newZone, uint32 newArea) const
@@ -1644,6 +1653,7 @@ void SpellMgr::LoadSpellProcs()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcMap.clear();                             // need for reload case
+    ++mSpellProcGeneration;
 
     //                                                 0        1           2                3                 4                 5                 6          7              8              9         10              11             12      13        14
     QueryResult result = WorldDatabase.Query("SELECT SpellId, SchoolMask, SpellFamilyName, SpellFamilyMask0, SpellFamilyMask1, SpellFamilyMask2, ProcFlags, SpellTypeMask, SpellPhaseMask, HitMask, AttributesMask, ProcsPerMinute, Chance, Cooldown, Charges FROM spell_proc");
@@ -2685,10 +2695,12 @@ void SpellMgr::LoadSpellInfoStore()
     uint32 oldMSTime = getMSTime();
 
     UnloadSpellInfoStore();
-    mSpellInfoMap.resize(sSpellStore.GetNumRows(), nullptr);
+    mSpellInfoMap.Resize(sSpellStore.GetNumRows());
 
     for (SpellEntry const* spellEntry : sSpellStore)
-        mSpellInfoMap[spellEntry->Id] = new SpellInfo(spellEntry);
+        mSpellInfoMap.Set(spellEntry->Id, new SpellInfo(spellEntry));
+
+    DummySpellIndex::EntryList dummyEntries, dummyEntriesA, dummyEntriesB;
 
     for (uint32 spellIndex = 0; spellIndex < GetSpellInfoStoreSize(); ++spellIndex)
     {
@@ -2709,17 +2721,24 @@ void SpellMgr::LoadSpellInfoStore()
 
         if (effects.size() > 0)
         {
-            if (effects[0].MiscValue != 0 )
-                mDummySpellMapA[effects[0].MiscValue].push_back(si);
+            uint32 dummyId = effects[0].MiscValue;
+            uint32 enchanceId = effects[0].MiscValueB;
 
-            if (effects[0].MiscValueB != 0)
-                mDummySpellMapB[effects[0].MiscValueB].push_back(si);
+            if (dummyId != 0)
+                dummyEntriesA.emplace_back(dummyId, si);
 
-            if(effects[0].MiscValue != 0 && effects[0].MiscValueB != 0)
-                mDummySpellMap[effects[0].MiscValue][effects[0].MiscValueB].push_back(si);
+            if (enchanceId != 0)
+                dummyEntriesB.emplace_back(enchanceId, si);
+
+            if (dummyId != 0 && enchanceId != 0)
+                dummyEntries.emplace_back(MAKE_PAIR64(enchanceId, dummyId), si);
         }
     }
 
+    mDummySpellIndex.Build(dummyEntries);
+    mDummySpellIndexA.Build(dummyEntriesA);
+    mDummySpellIndexB.Build(dummyEntriesB);
+
     LOG_INFO("server.loading", ">> Loaded Spell Custom Attributes in {} ms", GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -2768,10 +2787,13 @@ SpellCooldownOverride SpellMgr::GetSpellCooldownOverride(uint32 spellId) const
 
 void SpellMgr::UnloadSpellInfoStore()
 {
-    for (uint32 i = 0; i < GetSpellInfoStoreSize(); ++i)
-        delete mSpellInfoMap[i];
+    for (SpellInfo* spellInfo : mSpellInfoMap)
+        delete spellInfo;
 
     mSpellInfoMap.clear();
+    mDummySpellIndex.clear();
+    mDummySpellIndexA.clear();
+    mDummySpellIndexB.clear();
 }
 
 void SpellMgr::UnloadSpellInfoImplicitTargetConditionLists()
@@ -24,7 +24,9 @@
 #include "IteratorPair.h"
 #include "Log.h"
 #include "SharedDefines.h"
+#include "SparseIndex.h"
 #include "Unit.h"
+#include <span>
 
 class SpellInfo;
 class Player;
@@ -579,11 +581,30 @@ typedef std::map<int32, PetDefaultSpellsEntry> PetDefaultSpellsMap;
 typedef std::vector<uint32> SpellCustomAttribute;
 typedef std::vector<bool> EnchantCustomAttribute;
 
-typedef std::vector<SpellInfo*> SpellInfoMap;
+typedef SparseIndex<SpellInfo> SpellInfoMap;
 
-typedef std::unordered_map<uint32, std::unordered_map<uint32, std::vector<SpellInfo*>>> DummySpellMap;
-typedef std::unordered_map<uint32, std::vector<SpellInfo*>> DummySpellMapA;
-typedef std::unordered_map<uint32, std::vector<SpellInfo*>> DummySpellMapB;
+typedef std::span<SpellInfo* const> DummySpellInfoRange;
+
+// Immutable lookup from a Forge dummy key to the spells carrying it, built once per spell store load.
+// Keys and spells live in two parallel sorted vectors, so a lookup is a binary search that hands out
+// a view into the shared storage instead of a copy.
+class DummySpellIndex
+{
+public:
+    typedef std::vector<std::pair<uint64, SpellInfo*>> EntryList;
+
+    // entries must be in spell id order, the order is kept for spells sharing a key
+    void Build(EntryList& entries);
+    void clear();
+
+    [[nodiscard]] DummySpellInfoRange Find(uint64 key) const { return FindRange(key, key + 1); }
+    // all spells with first <= key < last
+    [[nodiscard]] DummySpellInfoRange FindRange(uint64 first, uint64 last) const;
+
+private:
+    std::vector<uint64> _keys;
+    std::vector<SpellInfo*> _spells;
+};
 
 typedef std::map<int32, std::vector<int32>> SpellLinkedMap;
 
@@ -672,6 +693,8 @@ public:
 
     // Spell proc table
     [[nodiscard]] SpellProcEntry const* GetSpellProcEntry(uint32 spellId) const;
+    // bumped on every spell_proc (re)load, units rebuild their proc aura index when it changes
+    [[nodiscard]] uint32 GetSpellProcGeneration() const { return mSpellProcGeneration; }
     static bool CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo);
 
     // Spell bonus data table
@@ -703,7 +726,7 @@ public:
     [[nodiscard]] SpellAreaForAreaMapBounds GetSpellAreaForAreaMapBounds(uint32 area_id) const;
 
     // SpellInfo object management
-    [[nodiscard]] SpellInfo const* GetSpellInfo(uint32 spellId) const { return spellId < GetSpellInfoStoreSize() ?  mSpellInfoMap[spellId] : nullptr; }
+    [[nodiscard]] SpellInfo const* GetSpellInfo(uint32 spellId) const { return mSpellInfoMap[spellId]; }
     // Use this only with 100% valid spellIds
     [[nodiscard]] SpellInfo const* AssertSpellInfo(uint32 spellId) const
     {
@@ -713,10 +736,11 @@ public:
         return spellInfo;
     }
 
-    [[nodiscard]] std::vector<SpellInfo*> GetSpellInfosForDummyId(uint32 dummyId, uint32 enchanceId) const;
-    [[nodiscard]] std::vector<SpellInfo*> GetSpellInfosForDummyA(uint32 dummyId) const;
-    [[nodiscard]] std::vector<SpellInfo*> GetSpellInfosForDummyB(uint32 enchanceId) const;
-    DummySpellMap GetDummyMap() const;
+    // Forge dummy lookups, the returned ranges stay valid until the spell store is reloaded
+    [[nodiscard]] DummySpellInfoRange GetSpellInfosForDummyId(uint32 dummyId, uint32 enchanceId) const;
+    [[nodiscard]] DummySpellInfoRange GetSpellInfosForDummyId(uint32 dummyId) const;
+    [[nodiscard]] DummySpellInfoRange GetSpellInfosForDummyA(uint32 dummyId) const;
+    [[nodiscard]] DummySpellInfoRange GetSpellInfosForDummyB(uint32 enchanceId) const;
 
     // use this instead of AssertSpellInfo to have the problem logged instead of crashing the server
     [[nodiscard]] SpellInfo const* CheckSpellInfo(uint32 spellId) const
@@ -743,7 +767,7 @@ public:
     [[nodiscard]] SpellCooldownOverride GetSpellCooldownOverride(uint32 spellId) const;
 
 private:
-    SpellInfo* _GetSpellInfo(uint32 spellId) { return spellId < GetSpellInfoStoreSize() ? mSpellInfoMap[spellId] : nullptr; }
+    SpellInfo* _GetSpellInfo(uint32 spellId) { return mSpellInfoMap[spellId]; }
 
     // Modifiers
 public:
@@ -786,6 +810,7 @@ private:
     SpellGroupMap              mSpellGroupMap;
     SpellGroupStackMap         mSpellGroupStackMap;
     SpellProcMap               mSpellProcMap;
+    uint32                     mSpellProcGeneration;
     SpellBonusMap              mSpellBonusMap;
     SpellThreatMap             mSpellThreatMap;
     SpellMixologyMap           mSpellMixologyMap;
@@ -802,9 +827,9 @@ private:
     PetLevelupSpellMap         mPetLevelupSpellMap;
     PetDefaultSpellsMap        mPetDefaultSpellsMap;           // only spells not listed in related mPetLevelupSpellMap entry
     SpellInfoMap               mSpellInfoMap;
-    DummySpellMap              mDummySpellMap;
-    DummySpellMapA             mDummySpellMapA;
-    DummySpellMapB             mDummySpellMapB;
+    DummySpellIndex            mDummySpellIndex;               // keyed by MAKE_PAIR64(enchanceId, dummyId)
+    DummySpellIndex            mDummySpellIndexA;
+    DummySpellIndex            mDummySpellIndexB;
     SpellCooldownOverrideMap   mSpellCooldownOverrideMap;
     TalentAdditionalSet        mTalentSpellAdditionalSet;
 };
@@ -223,6 +223,8 @@ enum WorldBoolConfigs
     CONFIG_STRICT_NAMES_RESERVED,
     CONFIG_STRICT_NAMES_PROFANITY,
     CONFIG_ALLOWS_RANK_MOD_FOR_PET_HEALTH,
+    CONFIG_STATS_LIMITS_ENABLE,
+    CONFIG_GUILD_ALLOW_MULTIPLE_GUILD_MASTER,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -241,6 +243,10 @@ enum WorldFloatConfigs
     CONFIG_ARENA_WIN_RATING_MODIFIER_2,
     CONFIG_ARENA_LOSE_RATING_MODIFIER,
     CONFIG_ARENA_MATCHMAKER_RATING_MODIFIER,
+    CONFIG_STATS_LIMITS_DODGE,
+    CONFIG_STATS_LIMITS_PARRY,
+    CONFIG_STATS_LIMITS_BLOCK,
+    CONFIG_STATS_LIMITS_CRIT,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -466,6 +472,8 @@ enum WorldIntConfigs
     CONFIG_WATER_BREATH_TIMER,
     CONFIG_AUCTION_HOUSE_SEARCH_TIMEOUT,
     CONFIG_DAILY_RBG_MIN_LEVEL_AP_REWARD,
+    CONFIG_GROUP_RAID_LEVEL_RESTRICTION,
+    CONFIG_GUILD_MEMBER_LIMIT,
     INT_CONFIG_VALUE_COUNT
 };
 
@@ -0,0 +1,140 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupLoader.h"
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+uint32 StartupLoader::AddLoader(std::string name, LoaderFunction loader, std::initializer_list<uint32> dependencies)
+{
+    uint32 id = uint32(_loaders.size());
+
+    Loader& entry = _loaders.emplace_back();
+    entry.Name = std::move(name);
+    entry.Function = std::move(loader);
+
+    for (uint32 dependency : dependencies)
+    {
+        ASSERT(dependency < id, "StartupLoader: loader {} depends on a loader added after it", entry.Name);
+        _loaders[dependency].Dependents.push_back(id);
+        ++entry.PendingDependencies;
+    }
+
+    return id;
+}
+
+void StartupLoader::Run(size_t num_threads)
+{
+    uint32 oldMSTime = getMSTime();
+
+    auto runLoader = [](Loader& loader)
+    {
+        uint32 loaderMSTime = getMSTime();
+        loader.Function();
+        loader.Duration = GetMSTimeDiffToNow(loaderMSTime);
+    };
+
+    // dependencies always precede their dependents, so insertion order is a valid serial order
+    if (num_threads <= 1)
+    {
+        for (Loader& loader : _loaders)
+            runLoader(loader);
+
+        _totalDuration = GetMSTimeDiffToNow(oldMSTime);
+        return;
+    }
+
+    std::mutex lock;
+    std::condition_variable condition;
+    std::vector<uint32> ready;
+    size_t remaining = _loaders.size();
+
+    for (uint32 i = 0; i < _loaders.size(); ++i)
+        if (!_loaders[i].PendingDependencies)
+            ready.push_back(i);
+
+    // loaders are started in insertion order among the ready ones, which keeps the log readable
+    std::reverse(ready.begin(), ready.end());
+
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> guard(lock);
+
+        for (;;)
+        {
+            condition.wait(guard, [&] { return !ready.empty() || !remaining; });
+
+            if (ready.empty())
+                return;
+
+            uint32 id = ready.back();
+            ready.pop_back();
+
+            guard.unlock();
+            runLoader(_loaders[id]);
+            guard.lock();
+
+            --remaining;
+
+            for (uint32 dependent : _loaders[id].Dependents)
+                if (!--_loaders[dependent].PendingDependencies)
+                    ready.insert(ready.begin(), dependent);
+
+            condition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+
+    for (size_t i = 0; i < num_threads; ++i)
+        threads.emplace_back(worker);
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    _totalDuration = GetMSTimeDiffToNow(oldMSTime);
+}
+
+void StartupLoader::LogTimings() const
+{
+    std::vector<Loader const*> sorted;
+    sorted.reserve(_loaders.size());
+
+    uint32 serialDuration = 0;
+
+    for (Loader const& loader : _loaders)
+    {
+        sorted.push_back(&loader);
+        serialDuration += loader.Duration;
+    }
+
+    std::sort(sorted.begin(), sorted.end(), [](Loader const* left, Loader const* right) { return left->Duration > right->Duration; });
+
+    LOG_INFO("server.loading", "Startup loader timings:");
+
+    for (Loader const* loader : sorted)
+        LOG_INFO("server.loading", "    {:>7} ms  {}", loader->Duration, loader->Name);
+
+    LOG_INFO("server.loading", ">> {} loaders finished in {} ms ({} ms if run one after another)", _loaders.size(), _totalDuration, serialDuration);
+    LOG_INFO("server.loading", " ");
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STARTUP_LOADER_H_INCLUDED
+#define _STARTUP_LOADER_H_INCLUDED
+
+#include "Define.h"
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// Runs startup data loaders as a dependency graph: a loader starts as soon as every loader it depends on
+// has finished, so independent tables are read concurrently, each worker taking its own synchronous
+// database connection. Loaders sharing a container must declare a dependency on each other.
+class StartupLoader
+{
+public:
+    typedef std::function<void()> LoaderFunction;
+
+    // returns an id other loaders can depend on, dependencies must have been added before
+    uint32 AddLoader(std::string name, LoaderFunction loader, std::initializer_list<uint32> dependencies = {});
+
+    // blocks until every loader has run, num_threads <= 1 runs them in insertion order on the calling thread
+    void Run(size_t num_threads);
+
+    // logs the wall time of each loader, slowest first, and the time spent on the whole graph
+    void LogTimings() const;
+
+private:
+    struct Loader
+    {
+        std::string Name;
+        LoaderFunction Function;
+        std::vector<uint32> Dependents;
+        uint32 PendingDependencies = 0;
+        uint32 Duration = 0;
+    };
+
+    std::vector<Loader> _loaders;
+    uint32 _totalDuration = 0;
+};
+
+#endif //_STARTUP_LOADER_H_INCLUDED
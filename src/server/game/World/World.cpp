@@ -73,12 +73,14 @@
 #include "Player.h"
 #include "PlayerDump.h"
 #include "PoolMgr.h"
+#include "QuerySnapshot.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
 #include "SkillDiscovery.h"
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
+#include "StartupLoader.h"
 #include "TaskScheduler.h"
 #include "TicketMgr.h"
 #include "Transport.h"
@@ -1333,6 +1335,16 @@ void World::LoadConfigSettings(bool reload)
 
     _int_configs[CONFIG_AUCTION_HOUSE_SEARCH_TIMEOUT] = sConfigMgr->GetOption<uint32>("AuctionHouse.SearchTimeout", 1000);
 
+    _bool_configs[CONFIG_STATS_LIMITS_ENABLE] = sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false);
+    _float_configs[CONFIG_STATS_LIMITS_DODGE] = sConfigMgr->GetOption<float>("Stats.Limits.Dodge", 95.0f);
+    _float_configs[CONFIG_STATS_LIMITS_PARRY] = sConfigMgr->GetOption<float>("Stats.Limits.Parry", 95.0f);
+    _float_configs[CONFIG_STATS_LIMITS_BLOCK] = sConfigMgr->GetOption<float>("Stats.Limits.Block", 95.0f);
+    _float_configs[CONFIG_STATS_LIMITS_CRIT]  = sConfigMgr->GetOption<float>("Stats.Limits.Crit", 95.0f);
+
+    _int_configs[CONFIG_GROUP_RAID_LEVEL_RESTRICTION] = sConfigMgr->GetOption<int32>("Group.Raid.LevelRestriction", 10);
+    _int_configs[CONFIG_GUILD_MEMBER_LIMIT] = sConfigMgr->GetOption<uint32>("Guild.MemberLimit", 0);
+    _bool_configs[CONFIG_GUILD_ALLOW_MULTIPLE_GUILD_MASTER] = sConfigMgr->GetOption<bool>("Guild.AllowMultipleGuildMaster", false);
+
     ///- Read the "Data" directory from the config file
     std::string dataPath = sConfigMgr->GetOption<std::string>("DataDir", "./");
     if (dataPath.empty() || (dataPath.at(dataPath.length() - 1) != '/' && dataPath.at(dataPath.length() - 1) != '\\'))
@@ -1431,6 +1443,8 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_PDUMP_NO_OVERWRITE] = sConfigMgr->GetOption<bool>("PlayerDump.DisallowOverwrite", true);
     _bool_configs[CONFIG_ENABLE_MMAPS]       = sConfigMgr->GetOption<bool>("MoveMaps.Enable", true);
     MMAP::MMapFactory::InitializeDisabledMaps();
+    MMAP::MMapFactory::createOrGetMMapMgr()->SetPathCacheSize(sConfigMgr->GetOption<uint32>("MoveMaps.PathCacheSize", 4096));
+    MMAP::MMapFactory::createOrGetMMapMgr()->SetMemoryMappedTiles(sConfigMgr->GetOption<bool>("MoveMaps.MemoryMapped", false));
 
     // ANTICHEAT
     _bool_configs[CONFIG_ANTICHEAT_ENABLE] = sConfigMgr->GetOption<bool>("Anticheat.Enable", false);
@@ -1718,80 +1732,59 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading Instance Saved Gameobject State Data...");
     sObjectMgr->LoadInstanceSavedGameobjectStateData();
 
-    LOG_INFO("server.loading", "Loading Character Cache...");
-    sCharacterCache->LoadCharacterCacheStorage();
-
-    // Must be called before `creature_respawn`/`gameobject_respawn` tables
-    LOG_INFO("server.loading", "Loading Instances...");
-    sInstanceSaveMgr->LoadInstances();
+    ///- Tables below only depend on each other as declared, so independent ones are read concurrently
+    StartupLoader startupLoader;
 
-    LOG_INFO("server.loading", "Loading Broadcast Texts...");
-    sObjectMgr->LoadBroadcastTexts();
-    sObjectMgr->LoadBroadcastTextLocales();
+    uint32 characterCacheLoader = startupLoader.AddLoader("Character Cache", [] { sCharacterCache->LoadCharacterCacheStorage(); });
 
-    LOG_INFO("server.loading", "Loading Localization Strings...");
-    uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadItemSetNameLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadQuestOfferRewardLocale();
-    sObjectMgr->LoadQuestRequestItemsLocale();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
-    sObjectMgr->LoadPetNamesLocales();
+    // Must be called before `creature_respawn`/`gameobject_respawn` tables
+    startupLoader.AddLoader("Instances", [] { sInstanceSaveMgr->LoadInstances(); }, { characterCacheLoader });
+
+    uint32 broadcastTextLoader = startupLoader.AddLoader("Broadcast Texts", []
+    {
+        sObjectMgr->LoadBroadcastTexts();
+        sObjectMgr->LoadBroadcastTextLocales();
+    });
+
+    startupLoader.AddLoader("Creature Locales", [] { sObjectMgr->LoadCreatureLocales(); });
+    startupLoader.AddLoader("GameObject Locales", [] { sObjectMgr->LoadGameObjectLocales(); });
+    startupLoader.AddLoader("Item Locales", [] { sObjectMgr->LoadItemLocales(); });
+    startupLoader.AddLoader("Item Set Name Locales", [] { sObjectMgr->LoadItemSetNameLocales(); });
+    startupLoader.AddLoader("Quest Locales", [] { sObjectMgr->LoadQuestLocales(); });
+    startupLoader.AddLoader("Quest Offer Reward Locales", [] { sObjectMgr->LoadQuestOfferRewardLocale(); });
+    startupLoader.AddLoader("Quest Request Items Locales", [] { sObjectMgr->LoadQuestRequestItemsLocale(); });
+    startupLoader.AddLoader("NPC Text Locales", [] { sObjectMgr->LoadNpcTextLocales(); });
+    startupLoader.AddLoader("Page Text Locales", [] { sObjectMgr->LoadPageTextLocales(); });
+    startupLoader.AddLoader("Gossip Menu Items Locales", [] { sObjectMgr->LoadGossipMenuItemsLocales(); });
+    startupLoader.AddLoader("Point Of Interest Locales", [] { sObjectMgr->LoadPointOfInterestLocales(); });
+    startupLoader.AddLoader("Pet Names Locales", [] { sObjectMgr->LoadPetNamesLocales(); });
+
+    uint32 pageTextLoader = startupLoader.AddLoader("Page Texts", [] { sObjectMgr->LoadPageTexts(); });
+    uint32 gameObjectTemplateLoader = startupLoader.AddLoader("Game Object Templates", [] { sObjectMgr->LoadGameObjectTemplate(); }, { pageTextLoader });
+    startupLoader.AddLoader("Game Object Template Addons", [] { sObjectMgr->LoadGameObjectTemplateAddons(); }, { gameObjectTemplateLoader });
+    startupLoader.AddLoader("Transport Templates", [] { sTransportMgr->LoadTransportTemplates(); }, { gameObjectTemplateLoader });
+
+    startupLoader.AddLoader("Spell Required Data", [] { sSpellMgr->LoadSpellRequired(); });
+    uint32 spellGroupLoader = startupLoader.AddLoader("Spell Group Types", [] { sSpellMgr->LoadSpellGroups(); });
+    startupLoader.AddLoader("Spell Learn Skills", [] { sSpellMgr->LoadSpellLearnSkills(); });  // must be after LoadSpellRanks
+    startupLoader.AddLoader("Spell Proc Conditions and data", [] { sSpellMgr->LoadSpellProcs(); });
+    startupLoader.AddLoader("Spell Bonus Data", [] { sSpellMgr->LoadSpellBonuses(); });
+    startupLoader.AddLoader("Aggro Spells Definitions", [] { sSpellMgr->LoadSpellThreats(); });
+    startupLoader.AddLoader("Mixology Bonuses", [] { sSpellMgr->LoadSpellMixology(); });
+    startupLoader.AddLoader("Spell Group Stack Rules", [] { sSpellMgr->LoadSpellGroupStackRules(); }, { spellGroupLoader });
+    startupLoader.AddLoader("NPC Texts", [] { sObjectMgr->LoadGossipText(); }, { broadcastTextLoader });
+    startupLoader.AddLoader("Enchant Spells Proc Datas", [] { sSpellMgr->LoadSpellEnchantProcData(); });
+    startupLoader.AddLoader("Item Random Enchantments Table", [] { LoadRandomEnchantmentsTable(); });
+
+    int32 startupLoaderThreads = sConfigMgr->GetOption<int32>("StartupLoader.Threads", 0);
+    if (startupLoaderThreads <= 0)
+        startupLoaderThreads = sConfigMgr->GetOption<int32>("WorldDatabase.SynchThreads", 1);
+
+    LOG_INFO("server.loading", "Loading Instances, Localization Strings, Templates and Spell Data ({} threads)...", startupLoaderThreads);
+    startupLoader.Run(startupLoaderThreads);
+    startupLoader.LogTimings();
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    LOG_INFO("server.loading", ">> Localization Strings loaded in {} ms", GetMSTimeDiffToNow(oldMSTime));
-    LOG_INFO("server.loading", " ");
-
-    LOG_INFO("server.loading", "Loading Page Texts...");
-    sObjectMgr->LoadPageTexts();
-
-    LOG_INFO("server.loading", "Loading Game Object Templates...");         // must be after LoadPageTexts
-    sObjectMgr->LoadGameObjectTemplate();
-
-    LOG_INFO("server.loading", "Loading Game Object Template Addons...");
-    sObjectMgr->LoadGameObjectTemplateAddons();
-
-    LOG_INFO("server.loading", "Loading Transport Templates...");
-    sTransportMgr->LoadTransportTemplates();
-
-    LOG_INFO("server.loading", "Loading Spell Required Data...");
-    sSpellMgr->LoadSpellRequired();
-
-    LOG_INFO("server.loading", "Loading Spell Group Types...");
-    sSpellMgr->LoadSpellGroups();
-
-    LOG_INFO("server.loading", "Loading Spell Learn Skills...");
-    sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
-
-    LOG_INFO("server.loading", "Loading Spell Proc Conditions and data...");
-    sSpellMgr->LoadSpellProcs();
-
-    LOG_INFO("server.loading", "Loading Spell Bonus Data...");
-    sSpellMgr->LoadSpellBonuses();
-
-    LOG_INFO("server.loading", "Loading Aggro Spells Definitions...");
-    sSpellMgr->LoadSpellThreats();
-
-    LOG_INFO("server.loading", "Loading Mixology Bonuses...");
-    sSpellMgr->LoadSpellMixology();
-
-    LOG_INFO("server.loading", "Loading Spell Group Stack Rules...");
-    sSpellMgr->LoadSpellGroupStackRules();
-
-    LOG_INFO("server.loading", "Loading NPC Texts...");
-    sObjectMgr->LoadGossipText();
-
-    LOG_INFO("server.loading", "Loading Enchant Spells Proc Datas...");
-    sSpellMgr->LoadSpellEnchantProcData();
-
-    LOG_INFO("server.loading", "Loading Item Random Enchantments Table...");
-    LoadRandomEnchantmentsTable();
 
     LOG_INFO("server.loading", "Loading Disables");
     DisableMgr::LoadDisables();                                  // must be before loading quests and items
@@ -2298,6 +2291,23 @@ void World::SetInitialWorldSettings()
         }
     }
 
+    if (sWorldDatabaseSnapshot->IsEnabled())
+    {
+        // later loads come from reload commands and must see the current table contents
+        sWorldDatabaseSnapshot->SetEnabled(false);
+        LOG_INFO("server.loading", ">> {} world database queries served from snapshots, {} read from the database", sWorldDatabaseSnapshot->GetHits(), sWorldDatabaseSnapshot->GetMisses());
+    }
+
+    std::vector<std::string> missingOptions = sConfigMgr->GetMissingOptions();
+    if (!missingOptions.empty())
+    {
+        std::string optionList;
+        for (std::string const& option : missingOptions)
+            optionList += (optionList.empty() ? "" : ", ") + option;
+
+        LOG_WARN("server.loading", ">> {} options were read but are not set in any config file, their defaults are used: {}", missingOptions.size(), optionList);
+    }
+
     uint32 startupDuration = GetMSTimeDiffToNow(startupBegin);
 
     LOG_INFO("server.loading", " ");
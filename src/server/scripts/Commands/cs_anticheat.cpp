@@ -186,25 +186,25 @@ public:
             return false;
         }
 
-        uint32 guid = player->GetGUID().GetCounter();
-
-        float average = sAnticheatMgr->GetAverage(guid);
-        uint32 total_reports = sAnticheatMgr->GetTotalReports(guid);
-        uint32 speed_reports = sAnticheatMgr->GetTypeReports(guid,0);
-        uint32 fly_reports = sAnticheatMgr->GetTypeReports(guid,1);
-        uint32 jump_reports = sAnticheatMgr->GetTypeReports(guid,3);
-        uint32 waterwalk_reports = sAnticheatMgr->GetTypeReports(guid,2);
-        uint32 teleportplane_reports = sAnticheatMgr->GetTypeReports(guid,4);
-        uint32 climb_reports = sAnticheatMgr->GetTypeReports(guid,5);
-        uint32 teleport_reports = sAnticheatMgr->GetTypeReports(guid, 6);
-        uint32 ignorecontrol_reports = sAnticheatMgr->GetTypeReports(guid, 7);
-        uint32 zaxis_reports = sAnticheatMgr->GetTypeReports(guid, 8);
-        uint32 antiswim_reports = sAnticheatMgr->GetTypeReports(guid, 9);
-        uint32 gravity_reports = sAnticheatMgr->GetTypeReports(guid, 10);
-        uint32 antiknockback_reports = sAnticheatMgr->GetTypeReports(guid, 11);
-        uint32 no_fall_damage_reports = sAnticheatMgr->GetTypeReports(guid, 12);
-        uint32 op_ack_reports = sAnticheatMgr->GetTypeReports(guid, 13);
-        uint32 counter_measures_reports = sAnticheatMgr->GetTypeReports(guid, 14);
+        Player* target = player->GetConnectedPlayer();
+
+        float average = sAnticheatMgr->GetAverage(target);
+        uint32 total_reports = sAnticheatMgr->GetTotalReports(target);
+        uint32 speed_reports = sAnticheatMgr->GetTypeReports(target, 0);
+        uint32 fly_reports = sAnticheatMgr->GetTypeReports(target, 1);
+        uint32 jump_reports = sAnticheatMgr->GetTypeReports(target, 3);
+        uint32 waterwalk_reports = sAnticheatMgr->GetTypeReports(target, 2);
+        uint32 teleportplane_reports = sAnticheatMgr->GetTypeReports(target, 4);
+        uint32 climb_reports = sAnticheatMgr->GetTypeReports(target, 5);
+        uint32 teleport_reports = sAnticheatMgr->GetTypeReports(target, 6);
+        uint32 ignorecontrol_reports = sAnticheatMgr->GetTypeReports(target, 7);
+        uint32 zaxis_reports = sAnticheatMgr->GetTypeReports(target, 8);
+        uint32 antiswim_reports = sAnticheatMgr->GetTypeReports(target, 9);
+        uint32 gravity_reports = sAnticheatMgr->GetTypeReports(target, 10);
+        uint32 antiknockback_reports = sAnticheatMgr->GetTypeReports(target, 11);
+        uint32 no_fall_damage_reports = sAnticheatMgr->GetTypeReports(target, 12);
+        uint32 op_ack_reports = sAnticheatMgr->GetTypeReports(target, 13);
+        uint32 counter_measures_reports = sAnticheatMgr->GetTypeReports(target, 14);
 
         uint32 latency = 0;
         latency = player->GetConnectedPlayer()->GetSession()->GetLatency();
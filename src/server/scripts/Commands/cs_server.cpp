@@ -30,6 +30,7 @@
 #include "MotdMgr.h"
 #include "MySQLThreading.h"
 #include "Player.h"
+#include "QuerySnapshot.h"
 #include "Realm.h"
 #include "StringConvert.h"
 #include "UpdateTime.h"
@@ -81,6 +82,11 @@ public:
             { "closed",       HandleServerSetClosedCommand,      SEC_CONSOLE,       Console::Yes },
         };
 
+        static ChatCommandTable serverSnapshotCommandTable =
+        {
+            { "rebuild",      HandleServerSnapshotRebuildCommand, SEC_CONSOLE,      Console::Yes }
+        };
+
         static ChatCommandTable serverCommandTable =
         {
             { "corpses",      HandleServerCorpsesCommand,        SEC_GAMEMASTER1,    Console::Yes },
@@ -92,7 +98,8 @@ public:
             { "motd",         HandleServerMotdCommand,           SEC_PLAYER,        Console::Yes },
             { "restart",      serverRestartCommandTable },
             { "shutdown",     serverShutdownCommandTable },
-            { "set",          serverSetCommandTable }
+            { "set",          serverSetCommandTable },
+            { "snapshot",     serverSnapshotCommandTable }
         };
 
         static ChatCommandTable commandTable =
@@ -242,6 +249,11 @@ public:
         handler->PSendSysMessage("CharacterDatabase queue size: %zu", CharacterDatabase.QueueSize());
         handler->PSendSysMessage("WorldDatabase queue size: %zu", WorldDatabase.QueueSize());
 
+        std::vector<DatabaseShardStats> characterShards = CharacterDatabase.GetShardStats();
+        for (size_t i = 0; i < characterShards.size(); ++i)
+            handler->PSendSysMessage("CharacterDatabase connection %zu: queue %zu, completed %llu, batches %llu, avg latency %u ms", i, characterShards[i].QueueSize,
+                (unsigned long long)characterShards[i].Completed, (unsigned long long)characterShards[i].Batches, characterShards[i].AverageLatency);
+
         if (Acore::Module::GetEnableModulesList().empty())
             handler->SendSysMessage("No modules enabled");
         else
@@ -513,6 +525,29 @@ public:
         return true;
     }
 
+    // Rewrite the world database snapshots used by the next startup from the current table contents
+    static bool HandleServerSnapshotRebuildCommand(ChatHandler* handler)
+    {
+        if (!sWorldDatabaseSnapshot->IsConfigured())
+        {
+            handler->SendSysMessage("World database snapshots are disabled (WorldDatabase.Snapshot.Directory is empty).");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        if (sWorldDatabaseSnapshot->IsRebuilding())
+        {
+            handler->SendSysMessage("World database snapshots are already being rebuilt.");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        // rereads whole tables, kept off the world thread; the result is logged to sql.snapshot
+        uint32 count = sWorldDatabaseSnapshot->StartRebuild();
+        handler->PSendSysMessage("Rebuilding %u world database query snapshots in the background.", count);
+        return true;
+    }
+
     // Define the 'Message of the day' for the realm
     static bool HandleServerSetMotdCommand(ChatHandler* handler, std::string realmId, Tail motd)
     {
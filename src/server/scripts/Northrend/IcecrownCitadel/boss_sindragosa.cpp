@@ -1256,6 +1256,7 @@ public:
         // for players and pets check only dynamic los (ice block gameobjects)
         float ox, oy, oz;
         _caster->GetPosition(ox, oy, oz);
+        auto guard = unit->GetMap()->LockDynamicTreeForRead();
         DynamicMapTree const& dTree = unit->GetMap()->GetDynamicMapTree();
         return !dTree.isInLineOfSight(unit->GetPositionX(), unit->GetPositionY(), unit->GetPositionZ() + 2.f, ox, oy, oz + 2.f, unit->GetPhaseMask(), VMAP::ModelIgnoreFlags::Nothing);
     }
@@ -19,6 +19,7 @@
 #define DBCStorageIterator_h__
 
 #include "Define.h"
+#include "SparseIndex.h"
 #include <iterator>
 
 template <class T>
@@ -32,30 +33,17 @@ public:
     using reference = T&;
 
     DBCStorageIterator() : _index(nullptr) { }
-    DBCStorageIterator(T** index, uint32 size, uint32 pos = 0) : _index(index), _pos(pos), _end(size)
-    {
-        if (_pos < _end)
-        {
-            while (_pos < _end && !_index[_pos])
-                ++_pos;
-        }
-    }
+    DBCStorageIterator(SparseIndex<T> const* index, uint32 pos) : _index(index), _pos(index->FindNext(pos)) { }
 
-    T const* operator->() { return _index[_pos]; }
-    T const* operator*() { return _index[_pos]; }
+    T const* operator->() { return (*_index)[_pos]; }
+    T const* operator*() { return (*_index)[_pos]; }
 
     bool operator==(DBCStorageIterator const& right) const { /*ASSERT(_index == right._index, "Iterator belongs to a different container")*/ return _pos == right._pos; }
     bool operator!=(DBCStorageIterator const& right) const { return !(*this == right); }
 
     DBCStorageIterator& operator++()
     {
-        if (_pos < _end)
-        {
-            do
-                ++_pos;
-            while (_pos < _end && !_index[_pos]);
-        }
-
+        _pos = _index->FindNext(_pos + 1);
         return *this;
     }
 
@@ -67,9 +55,8 @@ public:
     }
 
 private:
-    T** _index;
+    SparseIndex<T> const* _index;
     uint32 _pos{0};
-    uint32 _end{0};
 };
 
 #endif // DBCStorageIterator_h__
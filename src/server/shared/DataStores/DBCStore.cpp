@@ -18,7 +18,7 @@
 #include "DBCStore.h"
 #include "DBCDatabaseLoader.h"
 
-DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _indexTableSize(0)
+DBCStorageBase::DBCStorageBase(char const* fmt) : _loaded(false), _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _indexTableSize(0)
 {
 }
 
@@ -41,6 +41,15 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
 
     _fieldCount = dbc.GetCols();
 
+    // without strings the file records may already match the structure, no need to copy them then
+    if (dbc.HasStructLayout(_fileFormat))
+    {
+        _mappedFile = dbc.GetMapping();
+        dbc.AutoProduceDataInPlace(_fileFormat, _indexTableSize, indexTable);
+        _loaded = indexTable != nullptr;
+        return _loaded;
+    }
+
     // load raw non-string data
     _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
 
@@ -49,15 +58,20 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
         _stringPool.push_back(stringBlock);
 
     // error in dbc file at loading if nullptr
-    return indexTable != nullptr;
+    _loaded = indexTable != nullptr;
+    return _loaded;
 }
 
-bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
+bool DBCStorageBase::LoadStringsFrom(char const* path)
 {
     // DBC must be already loaded using Load
-    if (!indexTable)
+    if (!_loaded)
         return false;
 
+    // nothing to localize in records used in place
+    if (_mappedFile)
+        return true;
+
     DBCFileLoader dbc;
 
     // Check if load was successful, only then continue
@@ -71,7 +85,7 @@ bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
     return true;
 }
 
-void DBCStorageBase::LoadFromDB(char const* table, char const* format, char**& indexTable)
+void DBCStorageBase::LoadFromDB(char const* table, char const* format, uint32& records, char**& indexTable)
 {
-    _stringPool.push_back(DBCDatabaseLoader(table, format, _stringPool).Load(_indexTableSize, indexTable));
+    _stringPool.push_back(DBCDatabaseLoader(table, format, _stringPool).Load(records, indexTable));
 }
@@ -22,6 +22,7 @@
 #include "DBCStorageIterator.h"
 #include "Errors.h"
 #include <cstring>
+#include <memory>
 #include <vector>
 
 /// Interface class for common access
@@ -35,17 +36,18 @@ public:
     [[nodiscard]] uint32 GetFieldCount() const { return _fieldCount; }
 
     virtual bool Load(char const* path) = 0;
-    virtual bool LoadStringsFrom(char const* path) = 0;
+    virtual bool LoadStringsFrom(char const* path);
     virtual void LoadFromDB(char const* table, char const* format) = 0;
 
 protected:
     bool Load(char const* path, char**& indexTable);
-    bool LoadStringsFrom(char const* path, char** indexTable);
-    void LoadFromDB(char const* table, char const* format, char**& indexTable);
+    void LoadFromDB(char const* table, char const* format, uint32& records, char**& indexTable);
 
+    bool _loaded;
     uint32 _fieldCount;
     char const* _fileFormat;
     char* _dataTable;
+    std::shared_ptr<void> _mappedFile;          // set instead of _dataTable when the records are used in place from the file
     std::vector<char*> _stringPool;
     uint32 _indexTableSize;
 };
@@ -56,65 +58,57 @@ class DBCStorage : public DBCStorageBase
 public:
     typedef DBCStorageIterator<T> iterator;
 
-    explicit DBCStorage(char const* fmt) : DBCStorageBase(fmt)
-    {
-        _indexTable.AsT = nullptr;
-    }
-
-    ~DBCStorage() override
-    {
-        delete[] reinterpret_cast<char*>(_indexTable.AsT);
-    }
+    explicit DBCStorage(char const* fmt) : DBCStorageBase(fmt) { }
 
-    [[nodiscard]] T const* LookupEntry(uint32 id) const { return (id >= _indexTableSize) ? nullptr : _indexTable.AsT[id]; }
+    [[nodiscard]] T const* LookupEntry(uint32 id) const { return _index[id]; }
     [[nodiscard]] T const* AssertEntry(uint32 id) const { return ASSERT_NOTNULL(LookupEntry(id)); }
 
     void SetEntry(uint32 id, T* t)
     {
-        if (id >= _indexTableSize)
-        {
-            // Resize
-            typedef char* ptr;
-            size_t newSize = id + 1;
-            ptr* newArr = new ptr[newSize];
-            memset(newArr, 0, newSize * sizeof(ptr));
-            memcpy(newArr, _indexTable.AsChar, _indexTableSize * sizeof(ptr));
-            delete[] reinterpret_cast<char*>(_indexTable.AsT);
-            _indexTable.AsChar = newArr;
-            _indexTableSize = newSize;
-        }
-
-        delete _indexTable.AsT[id];
-        _indexTable.AsT[id] = t;
+        delete _index[id];
+        _index.Set(id, t);
+        _indexTableSize = _index.size();
     }
 
     [[nodiscard]] uint32 GetNumRows() const { return _indexTableSize; }
 
     bool Load(char const* path) override
     {
-        return DBCStorageBase::Load(path, _indexTable.AsChar);
-    }
-
-    bool LoadStringsFrom(char const* path) override
-    {
-        return DBCStorageBase::LoadStringsFrom(path, _indexTable.AsChar);
+        char** indexTable = nullptr;
+        bool loaded = DBCStorageBase::Load(path, indexTable);
+        AddToIndex(indexTable, _indexTableSize);
+        return loaded;
     }
 
     void LoadFromDB(char const* table, char const* format) override
     {
-        DBCStorageBase::LoadFromDB(table, format, _indexTable.AsChar);
+        uint32 records = 0;
+        char** indexTable = nullptr;
+        DBCStorageBase::LoadFromDB(table, format, records, indexTable);
+        AddToIndex(indexTable, records);
     }
 
-    iterator begin() { return iterator(_indexTable.AsT, _indexTableSize); }
-    iterator end() { return iterator(_indexTable.AsT, _indexTableSize, _indexTableSize); }
+    iterator begin() const { return iterator(&_index, 0); }
+    iterator end() const { return iterator(&_index, _index.size()); }
 
 private:
-    union
+    // the loaders produce a plain array indexed by id, only its entries are kept.
+    // Custom spells far above the client range would otherwise leave over a million empty slots.
+    void AddToIndex(char** indexTable, uint32 records)
     {
-        T** AsT;
-        char** AsChar;
+        if (!indexTable)
+            return;
+
+        for (uint32 i = 0; i < records; ++i)
+            if (indexTable[i])
+                _index.Set(i, reinterpret_cast<T*>(indexTable[i]));
+
+        _index.Resize(records);
+        _indexTableSize = _index.size();
+        delete[] indexTable;
     }
-    _indexTable;
+
+    SparseIndex<T> _index;
 
     DBCStorage(DBCStorage const& right) = delete;
     DBCStorage& operator=(DBCStorage const& right) = delete;
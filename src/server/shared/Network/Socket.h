@@ -22,14 +22,17 @@
 #include "MessageBuffer.h"
 #include <atomic>
 #include <boost/asio/ip/tcp.hpp>
+#include <deque>
 #include <functional>
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+// asio ignores any buffer past this count in a single scatter-gather operation
+#define WRITE_GATHER_COUNT 64
 #ifdef BOOST_ASIO_HAS_IOCP
 #define AC_SOCKET_USE_IOCP
 #endif
@@ -113,7 +116,10 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        if (!buffer.GetActiveSize())
+            return;
+
+        _writeQueue.emplace_back(std::move(buffer));
 
 #ifdef AC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -143,6 +149,22 @@ public:
     MessageBuffer& GetReadBuffer() { return _readBuffer; }
 
 protected:
+    /// Queues memory owned by the derived socket without copying it.
+    /// The memory must stay valid and unchanged until IsWriteQueueEmpty() returns true again.
+    void QueueBuffer(uint8 const* data, std::size_t size)
+    {
+        if (!size)
+            return;
+
+        _writeQueue.emplace_back(data, size);
+
+#ifdef AC_SOCKET_USE_IOCP
+        AsyncProcessQueue();
+#endif
+    }
+
+    bool IsWriteQueueEmpty() const { return _writeQueue.empty(); }
+
     virtual void OnClose() { }
     virtual void ReadHandler() = 0;
 
@@ -154,8 +176,8 @@ protected:
         _isWritingAsync = true;
 
 #ifdef AC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
+        GatherWriteBuffers();
+        _socket.async_write_some(_writeBuffers, std::bind(&Socket<T>::WriteHandler,
             this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
 #else
         _socket.async_write_some(boost::asio::null_buffers(), std::bind(&Socket<T>::WriteHandlerWrapper,
@@ -175,6 +197,51 @@ protected:
     }
 
 private:
+    /// Block of outgoing data, either owned by the queue (QueuePacket) or referencing memory of the derived socket (QueueBuffer)
+    struct WriteBuffer
+    {
+        explicit WriteBuffer(MessageBuffer&& buffer) : Storage(std::move(buffer)), Data(Storage.GetReadPointer()), Size(Storage.GetActiveSize()) { }
+        WriteBuffer(uint8 const* data, std::size_t size) : Storage(0), Data(data), Size(size) { }
+
+        MessageBuffer Storage;
+        uint8 const* Data;
+        std::size_t Size;
+    };
+
+    /// Collects the front of the write queue into one scatter-gather sequence, returns the number of bytes it covers
+    std::size_t GatherWriteBuffers()
+    {
+        std::size_t bytes = 0;
+        _writeBuffers.clear();
+
+        for (auto itr = _writeQueue.begin(); itr != _writeQueue.end() && _writeBuffers.size() < WRITE_GATHER_COUNT; ++itr)
+        {
+            _writeBuffers.emplace_back(itr->Data, itr->Size);
+            bytes += itr->Size;
+        }
+
+        return bytes;
+    }
+
+    /// Drops the bytes the last write sent from the front of the queue
+    void WriteCompleted(std::size_t bytes)
+    {
+        while (bytes && !_writeQueue.empty())
+        {
+            WriteBuffer& buffer = _writeQueue.front();
+
+            if (bytes < buffer.Size)
+            {
+                buffer.Data += bytes;
+                buffer.Size -= bytes;
+                return;
+            }
+
+            bytes -= buffer.Size;
+            _writeQueue.pop_front();
+        }
+    }
+
     void ReadHandlerInternal(boost::system::error_code error, size_t transferredBytes)
     {
         if (error)
@@ -193,10 +260,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            WriteCompleted(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -220,12 +284,10 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::size_t bytesToSend = GatherWriteBuffers();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_writeBuffers, error);
 
         if (error)
         {
@@ -234,9 +296,10 @@ private:
                 return AsyncProcessQueue();
             }
 
-            _writeQueue.pop();
+            // the stream can't be resumed past a failed write
+            _writeQueue.clear();
 
-            if (_closing && _writeQueue.empty())
+            if (_closing)
             {
                 CloseSocket();
             }
@@ -245,9 +308,9 @@ private:
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.clear();
 
-            if (_closing && _writeQueue.empty())
+            if (_closing)
             {
                 CloseSocket();
             }
@@ -256,11 +319,11 @@ private:
         }
         else if (bytesSent < bytesToSend) // now n > 0
         {
-            queuedMessage.ReadCompleted(bytesSent);
+            WriteCompleted(bytesSent);
             return AsyncProcessQueue();
         }
 
-        _writeQueue.pop();
+        WriteCompleted(bytesSent);
 
         if (_closing && _writeQueue.empty())
         {
@@ -277,7 +340,8 @@ private:
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<WriteBuffer> _writeQueue;
+    std::vector<boost::asio::const_buffer> _writeBuffers;
 
     std::atomic<bool> _closed;
     std::atomic<bool> _closing;
@@ -103,6 +103,8 @@ enum class ForgeTopic
     GET_LOADOUTS                    = 121,
     SAVE_LOADOUT                    = 122,
     DELETE_LOADOUT                  = 123,
+
+    MAX_FORGE_TOPIC
 };
 
 enum class ForgeError
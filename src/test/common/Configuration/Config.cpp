@@ -123,3 +123,23 @@ TEST_F(ConfigEnvTest, NotExistingInt)
 {
     EXPECT_EQ(sConfigMgr->GetOption<int>("NotFound.Int", 1), 1);
 }
+
+TEST_F(ConfigEnvTest, MissingOptionsAreCollectedOnce)
+{
+    // the fixture reloads the config, which forgets what earlier tests read
+    EXPECT_TRUE(sConfigMgr->GetMissingOptions().empty());
+
+    sConfigMgr->GetOption<int32>("Missing.Int", 1);
+    sConfigMgr->GetOption<std::string>("Missing.String", "none");
+    sConfigMgr->GetOption<bool>("Missing.Bool", false);
+    sConfigMgr->GetOption<int32>("Missing.Int", 2);
+    sConfigMgr->GetOption<int32>("Int.Nested", 10);
+
+    setenv("AC_MISSING_FROM_ENV", "1", 1);
+    sConfigMgr->GetOption<int32>("Missing.FromEnv", 0);
+
+    EXPECT_EQ(sConfigMgr->GetMissingOptions(), (std::vector<std::string>{ "Missing.Bool", "Missing.Int", "Missing.String" }));
+
+    sConfigMgr->LoadAppConfigs(true);
+    EXPECT_TRUE(sConfigMgr->GetMissingOptions().empty());
+}
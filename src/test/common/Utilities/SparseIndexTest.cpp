@@ -0,0 +1,144 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SparseIndex.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace
+{
+    // 16 ids per page keeps page boundaries easy to hit
+    typedef SparseIndex<int, 4> TestIndex;
+}
+
+TEST(SparseIndexTest, LookupsOnEmptyPagesReturnNull)
+{
+    TestIndex index;
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_EQ(index[0], nullptr);
+    EXPECT_EQ(index[12345], nullptr);
+
+    int value = 1;
+    index.Set(100, &value);
+    EXPECT_EQ(index.size(), 101u);
+    EXPECT_EQ(index[100], &value);
+
+    // every other page refers to the shared empty page
+    for (uint32 id = 0; id < 100; ++id)
+        EXPECT_EQ(index[id], nullptr) << "id " << id;
+
+    EXPECT_EQ(index[101], nullptr);
+    EXPECT_EQ(index[0xFFFFFFFF], nullptr);
+}
+
+TEST(SparseIndexTest, SetNullNeverAllocates)
+{
+    TestIndex index;
+    std::size_t const emptyUsage = index.GetMemoryUsage();
+
+    index.Set(500, nullptr);
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_EQ(index.GetMemoryUsage(), emptyUsage);
+
+    index.Resize(1000);
+    std::size_t const resizedUsage = index.GetMemoryUsage();
+    index.Set(500, nullptr);
+    EXPECT_EQ(index[500], nullptr);
+    EXPECT_EQ(index.GetMemoryUsage(), resizedUsage);
+
+    // clearing an entry keeps its page and the other entries on it
+    int a = 1, b = 2;
+    index.Set(32, &a);
+    index.Set(33, &b);
+    index.Set(32, nullptr);
+    EXPECT_EQ(index[32], nullptr);
+    EXPECT_EQ(index[33], &b);
+}
+
+TEST(SparseIndexTest, ResizeNeverShrinks)
+{
+    TestIndex index;
+    int value = 1;
+    index.Set(40, &value);
+
+    index.Resize(10);
+    EXPECT_EQ(index.size(), 41u);
+    EXPECT_EQ(index[40], &value);
+
+    index.Resize(200);
+    EXPECT_EQ(index.size(), 200u);
+    EXPECT_EQ(index[40], &value);
+    EXPECT_EQ(index[199], nullptr);
+
+    // setting below the size does not change it
+    index.Set(150, &value);
+    EXPECT_EQ(index.size(), 200u);
+
+    index.clear();
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_EQ(index[40], nullptr);
+}
+
+TEST(SparseIndexTest, FindNextAcrossPages)
+{
+    TestIndex index;
+    int a = 1, b = 2, c = 3;
+    index.Set(15, &a);     // last id of page 0
+    index.Set(16, &b);     // first id of page 1
+    index.Set(80, &c);     // page 5, pages 2 to 4 are empty
+    index.Resize(100);
+
+    EXPECT_EQ(index.FindNext(0), 15u);
+    EXPECT_EQ(index.FindNext(15), 15u);
+    EXPECT_EQ(index.FindNext(16), 16u);
+    EXPECT_EQ(index.FindNext(17), 80u);
+    EXPECT_EQ(index.FindNext(33), 80u);
+    EXPECT_EQ(index.FindNext(81), index.size());
+    EXPECT_EQ(index.FindNext(index.size()), index.size());
+    EXPECT_EQ(index.FindNext(index.size() + 1000), index.size());
+}
+
+TEST(SparseIndexTest, IteratesInIdOrder)
+{
+    TestIndex index;
+    std::vector<int> values = { 0, 1, 2, 3, 4, 5 };
+    std::vector<uint32> const ids = { 300, 3, 47, 16, 48, 0 };
+    for (std::size_t i = 0; i < ids.size(); ++i)
+        index.Set(ids[i], &values[i]);
+
+    std::vector<uint32> visited;
+    for (auto itr = index.begin(); itr != index.end(); ++itr)
+    {
+        EXPECT_EQ(*itr, index[itr.GetId()]);
+        visited.push_back(itr.GetId());
+    }
+
+    EXPECT_EQ(visited, (std::vector<uint32>{ 0, 3, 16, 47, 48, 300 }));
+
+    index.Set(47, nullptr);
+    uint32 count = 0;
+    for (int* value : index)
+    {
+        EXPECT_NE(value, nullptr);
+        ++count;
+    }
+
+    EXPECT_EQ(count, 5u);
+
+    TestIndex empty;
+    EXPECT_EQ(empty.begin(), empty.end());
+}
@@ -0,0 +1,39 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MySQLConnection.h"
+#include "gtest/gtest.h"
+
+TEST(MySQLConnectionTest, ImplicitCommitStatements)
+{
+    EXPECT_TRUE(MySQLConnection::CausesImplicitCommit("TRUNCATE TABLE daily_players_reports;"));
+    EXPECT_TRUE(MySQLConnection::CausesImplicitCommit("truncate guild_member_withdraw"));
+    EXPECT_TRUE(MySQLConnection::CausesImplicitCommit("  \n\tALTER TABLE characters ADD COLUMN x INT"));
+    EXPECT_TRUE(MySQLConnection::CausesImplicitCommit("DROP TABLE IF EXISTS tmp"));
+    EXPECT_TRUE(MySQLConnection::CausesImplicitCommit("CREATE TEMPORARY TABLE tmp (id INT)"));
+    EXPECT_TRUE(MySQLConnection::CausesImplicitCommit("LOCK TABLES characters WRITE"));
+}
+
+TEST(MySQLConnectionTest, BatchableStatements)
+{
+    EXPECT_FALSE(MySQLConnection::CausesImplicitCommit("DELETE FROM gm_ticket WHERE id = ?"));
+    EXPECT_FALSE(MySQLConnection::CausesImplicitCommit("INSERT INTO character_settings VALUES (?, ?, ?)"));
+    EXPECT_FALSE(MySQLConnection::CausesImplicitCommit("UPDATE characters SET online = 0"));
+    EXPECT_FALSE(MySQLConnection::CausesImplicitCommit("(SELECT 1)"));
+    EXPECT_FALSE(MySQLConnection::CausesImplicitCommit("TRUNCATED_TABLE_NAME"));
+    EXPECT_FALSE(MySQLConnection::CausesImplicitCommit(""));
+}
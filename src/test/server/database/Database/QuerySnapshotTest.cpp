@@ -0,0 +1,235 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QueryResult.h"
+#include "QuerySnapshot.h"
+#include "gtest/gtest.h"
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr char const* SNAPSHOT_SQL = "SELECT entry, name, subname FROM creature_template";
+    constexpr char const* SNAPSHOT_VERSION_KEY = "applied-updates-hash";
+
+    QueryResultFieldMetadata MakeField(std::string name, DatabaseFieldTypes type, std::string typeName)
+    {
+        QueryResultFieldMetadata meta;
+        meta.TableName = "creature_template";
+        meta.TableAlias = "creature_template";
+        meta.Name = name;
+        meta.Alias = std::move(name);
+        meta.TypeName = std::move(typeName);
+        meta.Type = type;
+        return meta;
+    }
+
+    std::shared_ptr<QuerySnapshot> CreateTestSnapshot()
+    {
+        return QuerySnapshot::Create(
+            { MakeField("entry", DatabaseFieldTypes::Int32, "LONG"), MakeField("name", DatabaseFieldTypes::Binary, "VAR_STRING"), MakeField("subname", DatabaseFieldTypes::Binary, "VAR_STRING") },
+            {
+                { "1", "Waypoint", std::nullopt },
+                { "68", "Stormwind City Guard", "" },
+                { "4294967295", std::string("embedded\0nul", 12), "Quartermaster" },
+            });
+    }
+
+    void ExpectSameSnapshot(QuerySnapshot const& expected, QuerySnapshot const& actual)
+    {
+        ASSERT_EQ(expected.GetFieldCount(), actual.GetFieldCount());
+        ASSERT_EQ(expected.GetRowCount(), actual.GetRowCount());
+
+        for (uint32 field = 0; field < expected.GetFieldCount(); ++field)
+        {
+            QueryResultFieldMetadata const& left = expected.GetFieldMetadata(field);
+            QueryResultFieldMetadata const& right = actual.GetFieldMetadata(field);
+            EXPECT_EQ(left.TableName, right.TableName);
+            EXPECT_EQ(left.TableAlias, right.TableAlias);
+            EXPECT_EQ(left.Name, right.Name);
+            EXPECT_EQ(left.Alias, right.Alias);
+            EXPECT_EQ(left.TypeName, right.TypeName);
+            EXPECT_EQ(left.Type, right.Type);
+            EXPECT_EQ(right.Index, field);
+        }
+
+        for (uint64 row = 0; row < expected.GetRowCount(); ++row)
+        {
+            for (uint32 field = 0; field < expected.GetFieldCount(); ++field)
+            {
+                std::pair<char const*, uint32> left = expected.GetValue(row, field);
+                std::pair<char const*, uint32> right = actual.GetValue(row, field);
+                ASSERT_EQ(left.first == nullptr, right.first == nullptr) << "row " << row << " field " << field;
+                if (!left.first)
+                    continue;
+
+                EXPECT_EQ(std::string(left.first, left.second), std::string(right.first, right.second)) << "row " << row << " field " << field;
+                // values are NUL terminated like the ones libmysqlclient hands out
+                EXPECT_EQ(right.first[right.second], '\0');
+            }
+        }
+    }
+
+    class QuerySnapshotTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            fileName = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("deleteme-%%%%-%%%%.qsnp")).string();
+        }
+
+        void TearDown() override
+        {
+            std::remove(fileName.c_str());
+            std::remove((fileName + ".tmp").c_str());
+        }
+
+        std::vector<char> ReadFile() const
+        {
+            std::ifstream file(fileName, std::ios::binary);
+            return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        }
+
+        void WriteFile(std::vector<char> const& contents) const
+        {
+            std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+            file.write(contents.data(), contents.size());
+        }
+
+        std::string fileName;
+    };
+}
+
+TEST_F(QuerySnapshotTest, WriteOpenRoundTrip)
+{
+    std::shared_ptr<QuerySnapshot> snapshot = CreateTestSnapshot();
+    ASSERT_TRUE(snapshot);
+    EXPECT_EQ(snapshot->GetRowCount(), 3u);
+    EXPECT_EQ(snapshot->GetFieldCount(), 3u);
+
+    ASSERT_TRUE(snapshot->Write(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+
+    std::shared_ptr<QuerySnapshot> opened = QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY);
+    ASSERT_TRUE(opened);
+    ExpectSameSnapshot(*snapshot, *opened);
+
+    EXPECT_EQ(opened->GetValue(0, 2).first, nullptr);
+    EXPECT_EQ(opened->GetValue(1, 2).second, 0u);
+    EXPECT_NE(opened->GetValue(1, 2).first, nullptr);
+    EXPECT_EQ(opened->GetValue(2, 1).second, 12u);
+}
+
+TEST_F(QuerySnapshotTest, EmptySnapshotRoundTrip)
+{
+    // what WorldDatabaseSnapshot records for a query without rows
+    QuerySnapshot empty;
+    ASSERT_TRUE(empty.Write(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+
+    std::shared_ptr<QuerySnapshot> opened = QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY);
+    ASSERT_TRUE(opened);
+    EXPECT_EQ(opened->GetRowCount(), 0u);
+    EXPECT_EQ(opened->GetFieldCount(), 0u);
+
+    std::shared_ptr<QuerySnapshot> noRows = QuerySnapshot::Create({ MakeField("entry", DatabaseFieldTypes::Int32, "LONG") }, {});
+    ASSERT_TRUE(noRows);
+    ASSERT_TRUE(noRows->Write(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+    opened = QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY);
+    ASSERT_TRUE(opened);
+    ExpectSameSnapshot(*noRows, *opened);
+}
+
+TEST_F(QuerySnapshotTest, RecordReadsResultSet)
+{
+    std::shared_ptr<QuerySnapshot> snapshot = CreateTestSnapshot();
+    ASSERT_TRUE(snapshot);
+
+    // positioned on the first row like every QueryResult handed out by a pool
+    ResultSet result(snapshot);
+    ASSERT_TRUE(result.NextRow());
+    EXPECT_EQ(result.Fetch()[0].Get<uint32>(), 1u);
+    EXPECT_EQ(result.Fetch()[1].Get<std::string>(), "Waypoint");
+    EXPECT_TRUE(result.Fetch()[2].IsNull());
+
+    std::shared_ptr<QuerySnapshot> recorded = QuerySnapshot::Record(result);
+    ASSERT_TRUE(recorded);
+    ExpectSameSnapshot(*snapshot, *recorded);
+
+    ASSERT_TRUE(recorded->Write(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+    std::shared_ptr<QuerySnapshot> opened = QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY);
+    ASSERT_TRUE(opened);
+    ExpectSameSnapshot(*snapshot, *opened);
+
+    ResultSet reopened(opened);
+    ASSERT_TRUE(reopened.NextRow());
+    ASSERT_TRUE(reopened.NextRow());
+    ASSERT_TRUE(reopened.NextRow());
+    EXPECT_EQ(reopened.Fetch()[0].Get<uint32>(), 4294967295u);
+    EXPECT_EQ(reopened.Fetch()[2].Get<std::string>(), "Quartermaster");
+    EXPECT_FALSE(reopened.NextRow());
+}
+
+TEST_F(QuerySnapshotTest, RejectsOtherQueryOrVersion)
+{
+    ASSERT_TRUE(CreateTestSnapshot()->Write(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+
+    EXPECT_FALSE(QuerySnapshot::Open(fileName, "SELECT entry FROM creature_template", SNAPSHOT_VERSION_KEY));
+    EXPECT_FALSE(QuerySnapshot::Open(fileName, SNAPSHOT_SQL, "other-updates-hash"));
+    EXPECT_FALSE(QuerySnapshot::Open(fileName + ".missing", SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+    EXPECT_TRUE(QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+}
+
+TEST_F(QuerySnapshotTest, RejectsCorruptFiles)
+{
+    ASSERT_TRUE(CreateTestSnapshot()->Write(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+    std::vector<char> const original = ReadFile();
+    ASSERT_GT(original.size(), 16u);
+
+    // bad magic
+    std::vector<char> contents = original;
+    contents[0] = 'X';
+    WriteFile(contents);
+    EXPECT_FALSE(QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+
+    // flipped byte in the values at the end of the payload
+    contents = original;
+    contents[contents.size() - 2] ^= 0x20;
+    WriteFile(contents);
+    EXPECT_FALSE(QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+
+    // truncated payload
+    contents = original;
+    contents.resize(contents.size() - 5);
+    WriteFile(contents);
+    EXPECT_FALSE(QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+
+    // trailing garbage
+    contents = original;
+    contents.push_back('\0');
+    WriteFile(contents);
+    EXPECT_FALSE(QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+
+    // shorter than the header
+    contents.resize(8);
+    WriteFile(contents);
+    EXPECT_FALSE(QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+
+    WriteFile(original);
+    EXPECT_TRUE(QuerySnapshot::Open(fileName, SNAPSHOT_SQL, SNAPSHOT_VERSION_KEY));
+}
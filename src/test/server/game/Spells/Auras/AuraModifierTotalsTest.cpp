@@ -0,0 +1,193 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuraModifierTotals.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <memory>
+
+namespace
+{
+    // Stands in for AuraEffect registered on a unit: disabled effects count as 0 and
+    // every change invalidates the type, as AuraEffect::SetAmount / ChangeAmount / SetEnabled do
+    class TestAuraEffect
+    {
+    public:
+        TestAuraEffect(AuraModifierTotalsCache& cache, AuraType type, int32 amount) : _cache(cache), _type(type), _amount(amount) { }
+
+        int32 GetAmount() const { return _enabled ? _amount : 0; }
+
+        void SetAmount(int32 amount)
+        {
+            _amount = amount;
+            _cache.Invalidate(_type);
+        }
+
+        void ChangeAmount(int32 amount)
+        {
+            _amount = amount;
+            _cache.Invalidate(_type);
+        }
+
+        void SetEnabled(bool enabled)
+        {
+            _enabled = enabled;
+            _cache.Invalidate(_type);
+        }
+
+    private:
+        AuraModifierTotalsCache& _cache;
+        AuraType _type;
+        int32 _amount;
+        bool _enabled = true;
+    };
+
+    typedef std::list<TestAuraEffect*> TestAuraEffectList;
+
+    void ExpectSameTotals(AuraModifierTotals const& cached, AuraModifierTotals const& fresh)
+    {
+        EXPECT_EQ(cached.Total, fresh.Total);
+        EXPECT_FLOAT_EQ(cached.Multiplier, fresh.Multiplier);
+        EXPECT_EQ(cached.MaxPositive, fresh.MaxPositive);
+        EXPECT_EQ(cached.MaxNegative, fresh.MaxNegative);
+    }
+}
+
+TEST(AuraModifierTotalsTest, Compute)
+{
+    AuraModifierTotalsCache cache;
+    TestAuraEffect a(cache, SPELL_AURA_MOD_INCREASE_SPEED, 10);
+    TestAuraEffect b(cache, SPELL_AURA_MOD_INCREASE_SPEED, -20);
+    TestAuraEffect c(cache, SPELL_AURA_MOD_INCREASE_SPEED, 30);
+
+    AuraModifierTotals totals = AuraModifierTotals::Compute(TestAuraEffectList{ &a, &b, &c });
+    EXPECT_EQ(totals.Total, 20);
+    EXPECT_FLOAT_EQ(totals.Multiplier, 1.1f * 0.8f * 1.3f);
+    EXPECT_EQ(totals.MaxPositive, 30);
+    EXPECT_EQ(totals.MaxNegative, -20);
+
+    AuraModifierTotals empty = AuraModifierTotals::Compute(TestAuraEffectList());
+    EXPECT_EQ(empty.Total, 0);
+    EXPECT_FLOAT_EQ(empty.Multiplier, 1.0f);
+    EXPECT_EQ(empty.MaxPositive, 0);
+    EXPECT_EQ(empty.MaxNegative, 0);
+}
+
+TEST(AuraModifierTotalsTest, CachedMatchesFreshWalkAfterChanges)
+{
+    AuraType const type = SPELL_AURA_MOD_DAMAGE_PERCENT_DONE;
+    AuraModifierTotalsCache cache;
+    TestAuraEffect a(cache, type, 15);
+    TestAuraEffect b(cache, type, -5);
+    TestAuraEffectList effects{ &a, &b };
+
+    ExpectSameTotals(cache.Get(type, effects), AuraModifierTotals::Compute(effects));
+
+    a.SetAmount(40);
+    ExpectSameTotals(cache.Get(type, effects), AuraModifierTotals::Compute(effects));
+    EXPECT_EQ(cache.Get(type, effects).Total, 35);
+
+    b.ChangeAmount(-50);
+    ExpectSameTotals(cache.Get(type, effects), AuraModifierTotals::Compute(effects));
+    EXPECT_EQ(cache.Get(type, effects).MaxNegative, -50);
+
+    a.SetEnabled(false);
+    ExpectSameTotals(cache.Get(type, effects), AuraModifierTotals::Compute(effects));
+    EXPECT_EQ(cache.Get(type, effects).MaxPositive, 0);
+
+    a.SetEnabled(true);
+    ExpectSameTotals(cache.Get(type, effects), AuraModifierTotals::Compute(effects));
+    EXPECT_EQ(cache.Get(type, effects).MaxPositive, 40);
+
+    // unregistering, as Unit::_RegisterAuraEffect does
+    effects.remove(&b);
+    cache.Invalidate(type);
+    ExpectSameTotals(cache.Get(type, effects), AuraModifierTotals::Compute(effects));
+    EXPECT_EQ(cache.Get(type, effects).Total, 40);
+}
+
+TEST(AuraModifierTotalsTest, InvalidateKeepsOtherTypes)
+{
+    AuraModifierTotalsCache cache;
+    TestAuraEffect speed(cache, SPELL_AURA_MOD_INCREASE_SPEED, 30);
+    TestAuraEffect haste(cache, SPELL_AURA_MOD_MELEE_HASTE, 10);
+    TestAuraEffectList speedEffects{ &speed };
+    TestAuraEffectList hasteEffects{ &haste };
+
+    cache.Get(SPELL_AURA_MOD_INCREASE_SPEED, speedEffects);
+    cache.Get(SPELL_AURA_MOD_MELEE_HASTE, hasteEffects);
+    EXPECT_EQ(cache.size(), 2u);
+
+    speed.SetAmount(50);
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(cache.Get(SPELL_AURA_MOD_MELEE_HASTE, hasteEffects).Total, 10);
+    EXPECT_EQ(cache.Get(SPELL_AURA_MOD_INCREASE_SPEED, speedEffects).Total, 50);
+    EXPECT_EQ(cache.size(), 2u);
+
+    // invalidating a type that was never queried is a no-op
+    cache.Invalidate(SPELL_AURA_MOD_STAT);
+    EXPECT_EQ(cache.size(), 2u);
+}
+
+// Stat and speed recalculation query the same few types many times between two aura changes
+TEST(AuraModifierTotalsTest, QueryThroughput)
+{
+    constexpr AuraType types[] = { SPELL_AURA_MOD_STAT, SPELL_AURA_MOD_INCREASE_SPEED, SPELL_AURA_MOD_MELEE_HASTE,
+        SPELL_AURA_MOD_DAMAGE_PERCENT_DONE, SPELL_AURA_MOD_RESISTANCE };
+    constexpr uint32 effectsPerType = 12;
+    constexpr uint32 queries = 200000;
+
+    AuraModifierTotalsCache cache;
+    std::vector<std::unique_ptr<TestAuraEffect>> storage;
+    TestAuraEffectList effects[std::size(types)];
+    for (uint32 i = 0; i < std::size(types); ++i)
+    {
+        for (uint32 j = 0; j < effectsPerType; ++j)
+        {
+            storage.push_back(std::make_unique<TestAuraEffect>(cache, types[i], int32(j * 7 % 23) - 11));
+            effects[i].push_back(storage.back().get());
+        }
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    int64 freshSum = 0;
+    Clock::time_point start = Clock::now();
+    for (uint32 i = 0; i < queries; ++i)
+        freshSum += AuraModifierTotals::Compute(effects[i % std::size(types)]).Total;
+    Clock::duration fresh = Clock::now() - start;
+
+    int64 cachedSum = 0;
+    start = Clock::now();
+    for (uint32 i = 0; i < queries; ++i)
+    {
+        uint32 index = i % std::size(types);
+        cachedSum += cache.Get(types[index], effects[index]).Total;
+    }
+    Clock::duration cached = Clock::now() - start;
+
+    EXPECT_EQ(freshSum, cachedSum);
+
+    double const freshNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(fresh).count()) / queries;
+    double const cachedNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(cached).count()) / queries;
+    RecordProperty("fresh_walk_ns_per_query", std::to_string(freshNs));
+    RecordProperty("cached_ns_per_query", std::to_string(cachedNs));
+    std::cout << "[          ] aura modifier query, " << effectsPerType << " effects per type: fresh walk "
+              << freshNs << " ns, cached " << cachedNs << " ns" << std::endl;
+}
@@ -0,0 +1,137 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupLoader.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // start and end position of each loader in the order loaders started and finished
+    struct LoaderTrace
+    {
+        void Run(uint32 id)
+        {
+            Starts[id] = ++_sequence;
+            ++Runs[id];
+            std::this_thread::yield();
+            Ends[id] = ++_sequence;
+        }
+
+        explicit LoaderTrace(std::size_t count) : Starts(count), Ends(count), Runs(count) { }
+
+        std::vector<uint32> Starts;
+        std::vector<uint32> Ends;
+        std::vector<std::atomic<uint32>> Runs;
+
+    private:
+        std::atomic<uint32> _sequence = 0;
+    };
+}
+
+TEST(StartupLoaderTest, SerialRunsInInsertionOrder)
+{
+    for (size_t threads : { 0, 1 })
+    {
+        std::vector<uint32> order;
+        StartupLoader loader;
+        uint32 a = loader.AddLoader("a", [&] { order.push_back(0); });
+        uint32 b = loader.AddLoader("b", [&] { order.push_back(1); });
+        loader.AddLoader("c", [&] { order.push_back(2); }, { b, a });
+        loader.AddLoader("d", [&] { order.push_back(3); });
+
+        loader.Run(threads);
+        EXPECT_EQ(order, (std::vector<uint32>{ 0, 1, 2, 3 })) << threads << " threads";
+    }
+}
+
+TEST(StartupLoaderTest, ParallelRunsDependentsAfterDependencies)
+{
+    constexpr uint32 loaderCount = 64;
+    LoaderTrace trace(loaderCount);
+    std::vector<std::vector<uint32>> dependencies(loaderCount);
+
+    StartupLoader loader;
+    for (uint32 i = 0; i < loaderCount; ++i)
+    {
+        // a mix of roots, chains and fan-ins
+        if (i % 5 == 1)
+            dependencies[i] = { i - 1 };
+        else if (i % 5 == 3 && i >= 3)
+            dependencies[i] = { i - 3, i - 2, i / 2 };
+        else if (i % 7 == 6)
+            dependencies[i] = { 0 };
+
+        std::sort(dependencies[i].begin(), dependencies[i].end());
+        dependencies[i].erase(std::unique(dependencies[i].begin(), dependencies[i].end()), dependencies[i].end());
+
+        uint32 id;
+        switch (dependencies[i].size())
+        {
+            case 0: id = loader.AddLoader("loader", [&trace, i] { trace.Run(i); }); break;
+            case 1: id = loader.AddLoader("loader", [&trace, i] { trace.Run(i); }, { dependencies[i][0] }); break;
+            case 2: id = loader.AddLoader("loader", [&trace, i] { trace.Run(i); }, { dependencies[i][0], dependencies[i][1] }); break;
+            default: id = loader.AddLoader("loader", [&trace, i] { trace.Run(i); }, { dependencies[i][0], dependencies[i][1], dependencies[i][2] }); break;
+        }
+
+        EXPECT_EQ(id, i);
+    }
+
+    loader.Run(4);
+
+    for (uint32 i = 0; i < loaderCount; ++i)
+    {
+        EXPECT_EQ(trace.Runs[i], 1u) << "loader " << i;
+
+        for (uint32 dependency : dependencies[i])
+            EXPECT_LT(trace.Ends[dependency], trace.Starts[i]) << "loader " << i << " started before loader " << dependency << " finished";
+    }
+}
+
+TEST(StartupLoaderTest, IndependentLoadersRunConcurrently)
+{
+    std::atomic<uint32> started = 0;
+    std::atomic<uint32> overlapped = 0;
+
+    // each loader waits for the other one to start, which only happens if two workers run them
+    auto waitForOther = [&]
+    {
+        ++started;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (started < 2 && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+
+        if (started >= 2)
+            ++overlapped;
+    };
+
+    StartupLoader loader;
+    uint32 a = loader.AddLoader("a", waitForOther);
+    uint32 b = loader.AddLoader("b", waitForOther);
+
+    bool dependentRan = false;
+    loader.AddLoader("c", [&] { dependentRan = overlapped == 2; }, { a, b });
+
+    loader.Run(2);
+    EXPECT_EQ(overlapped, 2u);
+    EXPECT_TRUE(dependentRan);
+}